@@ -0,0 +1,267 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace orsf {
+namespace bench {
+
+// ============================================================================
+// Benchmark Harness
+// ============================================================================
+
+/// Keep a value alive so the computation producing it is not optimized away
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+struct BenchOptions {
+    size_t warmup = 3;                  ///< Untimed repetitions before measuring
+    size_t repetitions = 30;            ///< Timed repetitions
+    double min_repetition_seconds = 0.01;   ///< Batch size is calibrated to at least this
+    size_t tail_samples = 1000;         ///< Single calls timed for p99_ns (fewer if they
+                                        ///< outlast the timed repetitions)
+    std::string filter;                 ///< Run only benchmarks whose name contains this
+
+    /// Allocations made so far by the calling thread (optional); when set,
+    /// single-threaded results report allocations_per_op
+    std::function<uint64_t()> allocation_counter;
+};
+
+/// Timing of one benchmark
+///
+/// Each repetition times a batch of calls; median, mean, min and max are
+/// per-call averages of those repetitions. With several threads, a
+/// repetition lasts until the slowest thread is done and ops_per_sec counts
+/// calls on all threads. p99_ns is the tail of individually timed calls
+/// (on all threads at once when threaded), so it includes clock overhead
+/// of a few tens of ns; it needs more than 100 samples to differ from the
+/// slowest call and is not reported (-1) with fewer.
+struct BenchResult {
+    std::string name;
+    size_t threads = 1;
+    size_t repetitions = 0;
+    uint64_t batch_size = 0;            ///< Calls per thread per repetition
+    size_t tail_samples = 0;            ///< Individually timed calls behind p99_ns
+    double median_ns = 0.0;
+    double p99_ns = -1.0;               ///< -1 if not measured
+    double mean_ns = 0.0;
+    double min_ns = 0.0;
+    double max_ns = 0.0;
+    double ops_per_sec = 0.0;           ///< From the median
+    double bytes_per_sec = 0.0;         ///< From the median (0 if no byte count)
+    double allocations_per_op = -1.0;   ///< -1 if not measured
+
+    nlohmann::json to_json() const {
+        nlohmann::json j = {
+            {"name", name}, {"threads", threads}, {"repetitions", repetitions}, {"batch_size", batch_size},
+            {"median_ns", median_ns}, {"mean_ns", mean_ns},
+            {"min_ns", min_ns}, {"max_ns", max_ns},
+            {"ops_per_sec", ops_per_sec}, {"bytes_per_sec", bytes_per_sec}
+        };
+        if (p99_ns >= 0.0) {
+            j["p99_ns"] = p99_ns;
+            j["tail_samples"] = tail_samples;
+        }
+        if (allocations_per_op >= 0.0) j["allocations_per_op"] = allocations_per_op;
+        return j;
+    }
+};
+
+class BenchRunner {
+public:
+    explicit BenchRunner(BenchOptions options = {}) : options_(std::move(options)) {}
+
+    bool selected(const std::string& name) const {
+        return options_.filter.empty() || name.find(options_.filter) != std::string::npos;
+    }
+
+    /// Time op() on one thread
+    /// @param bytes_per_op Bytes processed per call (0 = no throughput in bytes)
+    template <typename Op>
+    void run(const std::string& name, size_t bytes_per_op, Op&& op) {
+        if (!selected(name)) return;
+
+        uint64_t batch = calibrate(op);
+        for (size_t i = 0; i < options_.warmup; ++i) time_batch(op, batch);
+
+        std::vector<double> per_op_ns;
+        per_op_ns.reserve(options_.repetitions);
+        for (size_t i = 0; i < options_.repetitions; ++i) {
+            per_op_ns.push_back(time_batch(op, batch) / static_cast<double>(batch));
+        }
+
+        std::vector<double> call_ns;
+        time_calls(op, options_.tail_samples, call_ns);
+        add(name, 1, batch, bytes_per_op, per_op_ns, call_ns);
+
+        // Counted outside the timed repetitions so the counter adds no overhead to them
+        if (options_.allocation_counter) {
+            constexpr uint64_t calls = 16;
+            uint64_t before = options_.allocation_counter();
+            for (uint64_t i = 0; i < calls; ++i) op();
+            results_.back().allocations_per_op =
+                static_cast<double>(options_.allocation_counter() - before) / static_cast<double>(calls);
+        }
+    }
+
+    /// Time single calls of a long op, each after an untimed prepare()
+    ///
+    /// For ops that take far longer than min_repetition_seconds or need
+    /// fresh state per call (dropping the page cache before a cold read).
+    /// Every repetition is one call, so p99_ns comes from the repetitions
+    /// and is only reported with more than 100 of them.
+    template <typename Prepare, typename Op>
+    void run_prepared(const std::string& name, size_t bytes_per_op, Prepare&& prepare, Op&& op) {
+        if (!selected(name)) return;
+
+        std::vector<double> per_op_ns;
+        per_op_ns.reserve(options_.repetitions);
+        for (size_t i = 0; i < options_.warmup + options_.repetitions; ++i) {
+            prepare();
+            double ns = time_batch(op, 1);
+            if (i >= options_.warmup) per_op_ns.push_back(ns);
+        }
+        std::vector<double> call_ns = per_op_ns;
+        add(name, 1, 1, bytes_per_op, per_op_ns, call_ns);
+    }
+
+    /// Time op(thread_index) on several threads at once
+    template <typename Op>
+    void run_threaded(const std::string& name, size_t threads, Op&& op) {
+        if (!selected(name)) return;
+
+        auto single = [&op] { op(size_t(0)); };
+        uint64_t batch = calibrate(single);
+        size_t rounds = options_.warmup + options_.repetitions;
+
+        // Threads meet at a barrier before each round and report their batch
+        // time, then time single calls together for the tail
+        std::atomic<size_t> arrived{0};
+        auto barrier = [&](size_t round) {
+            arrived.fetch_add(1, std::memory_order_acq_rel);
+            while (arrived.load(std::memory_order_acquire) < (round + 1) * threads) {
+                std::this_thread::yield();
+            }
+        };
+        size_t samples_per_thread = (options_.tail_samples + threads - 1) / threads;
+        std::vector<std::vector<double>> thread_ns(threads, std::vector<double>(rounds));
+        std::vector<std::vector<double>> thread_call_ns(threads);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                for (size_t round = 0; round < rounds; ++round) {
+                    barrier(round);
+                    thread_ns[t][round] = time_batch([&op, t] { op(t); }, batch);
+                }
+                barrier(rounds);
+                time_calls([&op, t] { op(t); }, samples_per_thread, thread_call_ns[t]);
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        std::vector<double> per_op_ns;
+        per_op_ns.reserve(options_.repetitions);
+        for (size_t round = options_.warmup; round < rounds; ++round) {
+            double slowest = 0.0;
+            for (size_t t = 0; t < threads; ++t) slowest = std::max(slowest, thread_ns[t][round]);
+            per_op_ns.push_back(slowest / static_cast<double>(batch));
+        }
+
+        std::vector<double> call_ns;
+        for (const auto& samples : thread_call_ns) call_ns.insert(call_ns.end(), samples.begin(), samples.end());
+        add(name, threads, batch, 0, per_op_ns, call_ns);
+    }
+
+    const std::vector<BenchResult>& results() const { return results_; }
+
+    const BenchOptions& options() const { return options_; }
+
+private:
+    BenchOptions options_;
+    std::vector<BenchResult> results_;
+
+    template <typename Op>
+    static double time_batch(Op&& op, uint64_t batch) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < batch; ++i) op();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Time up to count single calls, stopping once they took as long as the repetitions
+    template <typename Op>
+    void time_calls(Op&& op, size_t count, std::vector<double>& out) const {
+        const double budget_ns = static_cast<double>(options_.repetitions) * options_.min_repetition_seconds * 1e9;
+        double spent_ns = 0.0;
+        out.reserve(out.size() + count);
+        for (size_t i = 0; i < count && spent_ns < budget_ns; ++i) {
+            out.push_back(time_batch(op, 1));
+            spent_ns += out.back();
+        }
+    }
+
+    // Double the batch until it takes at least min_repetition_seconds
+    template <typename Op>
+    uint64_t calibrate(Op&& op) const {
+        const double target_ns = options_.min_repetition_seconds * 1e9;
+        uint64_t batch = 1;
+        while (batch < (uint64_t(1) << 30)) {
+            double elapsed = time_batch(op, batch);
+            if (elapsed >= target_ns) break;
+            batch *= elapsed > 0.0 ? std::min<uint64_t>(8, static_cast<uint64_t>(std::ceil(target_ns / elapsed))) : 8;
+        }
+        return batch;
+    }
+
+    // per_op_ns: per-call averages of each repetition; call_ns: single calls
+    void add(const std::string& name, size_t threads, uint64_t batch, size_t bytes_per_op,
+             std::vector<double>& per_op_ns, std::vector<double>& call_ns) {
+        std::sort(per_op_ns.begin(), per_op_ns.end());
+        size_t n = per_op_ns.size();
+
+        BenchResult result;
+        result.name = name;
+        result.threads = threads;
+        result.repetitions = n;
+        result.batch_size = batch;
+        if (n > 0) {
+            result.median_ns = n % 2 ? per_op_ns[n / 2] : (per_op_ns[n / 2 - 1] + per_op_ns[n / 2]) / 2.0;
+            result.min_ns = per_op_ns.front();
+            result.max_ns = per_op_ns.back();
+            double sum = 0.0;
+            for (double ns : per_op_ns) sum += ns;
+            result.mean_ns = sum / static_cast<double>(n);
+        }
+        if (call_ns.size() > 100) {
+            std::sort(call_ns.begin(), call_ns.end());
+            result.tail_samples = call_ns.size();
+            result.p99_ns = call_ns[static_cast<size_t>(std::ceil(0.99 * static_cast<double>(call_ns.size()))) - 1];
+        }
+        if (result.median_ns > 0.0) {
+            result.ops_per_sec = static_cast<double>(threads) * 1e9 / result.median_ns;
+            result.bytes_per_sec = result.ops_per_sec * static_cast<double>(bytes_per_op);
+        }
+
+        std::fprintf(stderr, "%-40s %3zu %12.1f %12.1f %16.0f\n",
+                     name.c_str(), threads, result.median_ns, result.p99_ns, result.ops_per_sec);
+        results_.push_back(std::move(result));
+    }
+};
+
+} // namespace bench
+} // namespace orsf
@@ -0,0 +1,512 @@
+#include "orsf/orsf.hpp"
+#include "harness.hpp"
+#include "alloc_hooks.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace orsf;
+using namespace orsf::bench;
+
+/// ORSF benchmark suite
+///
+/// Times the core hot paths (JSON, validation, mapping, lookup tables, unit
+/// conversion, a generated corpus, registry lookups under contention, bulk
+/// file I/O and library cache startup) and writes the results as JSON for
+/// regression tracking. Single-threaded results include allocations per
+/// call (counted by orsf_alloc_hooks), and the report includes the memory
+/// footprint of the benchmark setup. A summary table goes to stderr.
+///
+/// Usage: orsf_bench [--filter text] [--repetitions n] [--warmup n]
+///                   [--min-time seconds] [--max-threads n] [--io-files n]
+///                   [--out file]
+
+namespace {
+
+ORSF create_bench_setup() {
+    ORSF setup;
+    setup.metadata.id = "bench-setup";
+    setup.metadata.name = "Monza Qualifying";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.car.car_class = "GT3";
+    setup.context = Context{};
+    setup.context->track = "Monza";
+    setup.context->ambient_temp_c = 24.0;
+    setup.context->track_temp_c = 35.0;
+
+    Aerodynamics aero;
+    aero.front_wing = 3.0;
+    aero.rear_wing = 7.0;
+    aero.front_ride_height_mm = 52.0;
+    aero.rear_ride_height_mm = 68.0;
+    aero.brake_duct_front_pct = 40.0;
+    aero.radiator_opening_pct = 60.0;
+    setup.setup.aero = aero;
+
+    Suspension suspension;
+    CornerSuspension corner;
+    corner.camber_deg = -3.5;
+    corner.toe_deg = 0.1;
+    corner.spring_rate_n_mm = 150.0;
+    corner.ride_height_mm = 55.0;
+    corner.damper_bump_slow_n_s_m = 4000.0;
+    corner.damper_rebound_slow_n_s_m = 8000.0;
+    suspension.front_left = corner;
+    suspension.front_right = corner;
+    corner.camber_deg = -2.8;
+    corner.spring_rate_n_mm = 170.0;
+    suspension.rear_left = corner;
+    suspension.rear_right = corner;
+    suspension.front_arb = 5.0;
+    suspension.rear_arb = 3.0;
+    setup.setup.suspension = suspension;
+
+    Tires tires;
+    tires.compound = "Medium";
+    tires.pressure_fl_kpa = 175.0;
+    tires.pressure_fr_kpa = 176.0;
+    tires.pressure_rl_kpa = 172.0;
+    tires.pressure_rr_kpa = 173.0;
+    setup.setup.tires = tires;
+
+    Drivetrain drivetrain;
+    drivetrain.diff_preload_nm = 80.0;
+    drivetrain.final_drive_ratio = 3.4;
+    setup.setup.drivetrain = drivetrain;
+
+    Gearing gearing;
+    gearing.gear_ratios = std::vector<double>{3.1, 2.3, 1.8, 1.5, 1.25, 1.08};
+    setup.setup.gearing = gearing;
+
+    Brakes brakes;
+    brakes.brake_bias_pct = 56.5;
+    setup.setup.brakes = brakes;
+
+    Electronics electronics;
+    electronics.tc_level = 4;
+    electronics.abs_level = 3;
+    electronics.engine_map = 1;
+    setup.setup.electronics = electronics;
+
+    Fuel fuel;
+    fuel.start_fuel_l = 60.0;
+    fuel.per_lap_consumption_l = 2.9;
+    setup.setup.fuel = fuel;
+    return setup;
+}
+
+std::vector<FieldMapping> create_bench_mappings() {
+    LookupTableConverter wing({{0, 0}, {5, 12.5}, {10, 30}, {15, 52.5}});
+    return {
+        FieldMapping("setup.aero.front_wing", "FrontWing", Transform::lookup_table(wing)),
+        FieldMapping("setup.aero.rear_wing", "RearWing", Transform::lookup_table(wing)),
+        FieldMapping("setup.tires.pressure_fl_kpa", "PressureLF",
+            Transform::unit_convert(Unit::KPA, Unit::PSI), Transform::unit_convert(Unit::PSI, Unit::KPA)),
+        FieldMapping("setup.tires.pressure_fr_kpa", "PressureRF",
+            Transform::unit_convert(Unit::KPA, Unit::PSI), Transform::unit_convert(Unit::PSI, Unit::KPA)),
+        FieldMapping("setup.tires.pressure_rl_kpa", "PressureLR",
+            Transform::unit_convert(Unit::KPA, Unit::PSI), Transform::unit_convert(Unit::PSI, Unit::KPA)),
+        FieldMapping("setup.tires.pressure_rr_kpa", "PressureRR",
+            Transform::unit_convert(Unit::KPA, Unit::PSI), Transform::unit_convert(Unit::PSI, Unit::KPA)),
+        FieldMapping("setup.brakes.brake_bias_pct", "BrakeBias", Transform::percent_to_ratio(), Transform::ratio_to_percent()),
+        FieldMapping("setup.suspension.front_left.camber_deg", "CamberLF"),
+        FieldMapping("setup.suspension.rear_left.camber_deg", "CamberLR"),
+        FieldMapping("setup.suspension.front_left.spring_rate_n_mm", "SpringLF",
+            Transform::unit_convert(Unit::N_MM, Unit::LB_IN), Transform::unit_convert(Unit::LB_IN, Unit::N_MM)),
+        FieldMapping("setup.suspension.front_arb", "FrontARB"),
+        FieldMapping("setup.electronics.tc_level", "TC"),
+        FieldMapping("setup.fuel.start_fuel_l", "Fuel"),
+    };
+}
+
+class BenchAdapter : public BaseAdapter {
+public:
+    BenchAdapter(const std::string& id, const std::string& car_key)
+        : BaseAdapter(id, "1.0", car_key, "Benchmark adapter") {}
+
+    std::vector<uint8_t> orsf_to_native(const ORSF&) const override { return {}; }
+    ORSF native_to_orsf(const std::vector<uint8_t>&) const override { return ORSF{}; }
+    std::string get_suggested_filename() const override { return "bench.json"; }
+    std::string get_file_extension() const override { return "json"; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+    std::vector<FieldMapping> get_field_mappings() const override { return {}; }
+};
+
+void bench_json(BenchRunner& runner, const ORSF& setup) {
+    std::string text = setup.to_json_string();
+
+    runner.run("json/from_json", text.size(), [&] {
+        do_not_optimize(ORSF::from_json(text));
+    });
+    runner.run("json/to_json_string", text.size(), [&] {
+        do_not_optimize(setup.to_json_string());
+    });
+}
+
+void bench_validation(BenchRunner& runner, const ORSF& setup) {
+    runner.run("validator/validate", 0, [&] {
+        do_not_optimize(Validator::validate(setup));
+    });
+}
+
+void bench_mapping(BenchRunner& runner, const ORSF& setup) {
+    auto mappings = create_bench_mappings();
+    FlatSetup native = MappingEngine::map_to_native(setup, mappings);
+    const std::string paths[] = {
+        "setup.aero.front_wing", "setup.tires.pressure_rr_kpa",
+        "setup.suspension.rear_right.damper_rebound_slow_n_s_m", "setup.electronics.tc_level",
+    };
+    size_t next = 0;
+
+    runner.run("mapping/flatten_orsf", 0, [&] {
+        do_not_optimize(MappingEngine::flatten_orsf(setup));
+    });
+    runner.run("mapping/get_value", 0, [&] {
+        do_not_optimize(MappingEngine::get_value(setup, paths[next++ % 4]));
+    });
+    runner.run("mapping/map_to_native", 0, [&] {
+        do_not_optimize(MappingEngine::map_to_native(setup, mappings));
+    });
+    runner.run("mapping/map_to_orsf", 0, [&] {
+        do_not_optimize(MappingEngine::map_to_orsf(native, mappings, setup));
+    });
+}
+
+void bench_lookup_table(BenchRunner& runner) {
+    std::vector<LUTEntry> table;
+    for (int i = 0; i <= 32; ++i) {
+        table.push_back(LUTEntry{static_cast<double>(i), 1.5 * i + 0.01 * i * i});
+    }
+    LookupTableConverter converter(table);
+    double input = 0.0;
+
+    runner.run("lut/interpolate", 0, [&] {
+        input = input >= 32.0 ? 0.0 : input + 0.37;
+        do_not_optimize(converter.interpolate(input));
+    });
+    runner.run("lut/reverse_lookup", 0, [&] {
+        input = input >= 32.0 ? 0.0 : input + 0.37;
+        do_not_optimize(converter.reverse_lookup(input * 1.8));
+    });
+}
+
+void bench_units(BenchRunner& runner) {
+    const std::pair<Unit, Unit> pairs[] = {
+        {Unit::KPA, Unit::PSI}, {Unit::N_MM, Unit::LB_IN},
+        {Unit::CELSIUS, Unit::FAHRENHEIT}, {Unit::KPA, Unit::BAR},
+    };
+    size_t next = 0;
+    double value = 100.0;
+
+    runner.run("units/convert", 0, [&] {
+        const auto& pair = pairs[next++ % 4];
+        do_not_optimize(UnitConverter::convert(value, pair.first, pair.second));
+    });
+}
+
+void bench_corpus(BenchRunner& runner) {
+    // Mixed dense/sparse corpus with a few invalid setups, as seen in production
+    SetupGenerator generator;
+    std::vector<std::string> texts;
+    size_t total_bytes = 0;
+    for (const auto& setup : generator.generate_range(0, 256)) {
+        texts.push_back(setup.to_json_string());
+        total_bytes += texts.back().size();
+    }
+    size_t average_bytes = total_bytes / texts.size();
+    size_t next = 0;
+
+    runner.run("corpus/from_json", average_bytes, [&] {
+        do_not_optimize(ORSF::from_json(texts[next++ % texts.size()]));
+    });
+    runner.run("corpus/streaming_validate", average_bytes, [&] {
+        do_not_optimize(StreamingValidator::validate(texts[next++ % texts.size()]));
+    });
+}
+
+void bench_registry(BenchRunner& runner, size_t max_threads) {
+    struct Query {
+        std::string id;
+        std::string car_key;
+    };
+
+    AdapterRegistry registry;
+    std::vector<std::shared_ptr<Adapter>> adapters;
+    std::vector<Query> queries;
+    for (int i = 0; i < 800; ++i) {
+        Query query{"game" + std::to_string(i % 8), "car" + std::to_string(i)};
+        adapters.push_back(std::make_shared<BenchAdapter>(query.id, query.car_key));
+        queries.push_back(std::move(query));
+    }
+    registry.register_adapters(adapters);
+
+    // One cursor per thread, on separate cache lines
+    struct alignas(64) Cursor {
+        size_t next = 0;
+    };
+    std::vector<Cursor> cursors(max_threads);
+
+    auto resolve = [&](size_t thread) {
+        size_t& next = cursors[thread].next;
+        const Query& query = queries[(next++ + thread * 101) % queries.size()];
+        do_not_optimize(registry.resolve(query.id, "1.0", query.car_key));
+    };
+
+    for (const char* mode : {"snapshot", "frozen"}) {
+        if (std::strcmp(mode, "frozen") == 0) registry.freeze();
+        for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+            runner.run_threaded(std::string("registry/resolve_") + mode + "/threads:" + std::to_string(threads),
+                                threads, resolve);
+        }
+    }
+}
+
+/// Flush files to disk and optionally evict them from the page cache
+///
+/// Eviction only works on clean pages, hence the fdatasync. Returns false
+/// where the platform cannot evict (cold runs are skipped there).
+bool flush_files(const std::vector<std::string>& paths, bool evict) {
+#ifdef _WIN32
+    (void)paths;
+    return !evict;
+#else
+    for (const auto& path : paths) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) continue;
+        ::fdatasync(fd);
+        if (evict) ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+    return true;
+#endif
+}
+
+void bench_file_io(BenchRunner& runner, size_t file_count) {
+    // Writing the corpus takes a while; skip it when the filter excludes every case
+    const char* const cases[] = {
+        "io/write_ofstream", "io/write_async_uring", "io/write_async_threads",
+        "io/read_ifstream/warm", "io/read_async_uring/warm", "io/read_async_threads/warm",
+        "io/read_ifstream/cold", "io/read_async_uring/cold", "io/read_async_threads/cold",
+    };
+    if (std::none_of(std::begin(cases), std::end(cases), [&](const char* name) { return runner.selected(name); })) {
+        return;
+    }
+
+    namespace fs = std::filesystem;
+    fs::path root = fs::temp_directory_path() / "orsf_bench_io";
+    fs::remove_all(root);
+    fs::create_directories(root / "corpus");
+    fs::create_directories(root / "export");
+
+    // Many small setup files, the shape of a bulk import
+    SetupGenerator generator;
+    std::vector<std::string> texts;
+    std::vector<std::string> paths;
+    std::vector<FileWrite> corpus;
+    std::vector<FileWrite> exports;
+    size_t total_bytes = 0;
+    for (const auto& setup : generator.generate_range(0, file_count)) {
+        texts.push_back(setup.to_json_string());
+        total_bytes += texts.back().size();
+    }
+    for (size_t i = 0; i < texts.size(); ++i) {
+        std::string name = "setup_" + std::to_string(i) + ".json";
+        paths.push_back((root / "corpus" / name).string());
+        corpus.push_back({paths.back(), ByteSpan(std::string_view(texts[i]))});
+        exports.push_back({(root / "export" / name).string(), ByteSpan(std::string_view(texts[i]))});
+    }
+
+    std::vector<std::pair<std::string, IoBackend>> backends = {{"threads", IoBackend::ThreadPool}};
+    if (io_uring_available()) backends.insert(backends.begin(), {"uring", IoBackend::IoUring});
+    auto no_prepare = [] {};
+
+    runner.run_prepared("io/write_ofstream", total_bytes, no_prepare, [&] {
+        for (const auto& write : exports) {
+            std::ofstream out(write.path, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(write.data.data()), static_cast<std::streamsize>(write.data.size()));
+        }
+    });
+    for (const auto& backend : backends) {
+        AsyncIoOptions io;
+        io.backend = backend.second;
+        AsyncFileWriter writer(io);
+        runner.run_prepared("io/write_async_" + backend.first, total_bytes, no_prepare, [&] {
+            do_not_optimize(writer.write_files(exports));
+        });
+    }
+
+    AsyncFileWriter().write_files(corpus);
+    flush_files(paths, false);
+
+    for (bool cold : {false, true}) {
+        const std::string cache = cold ? "/cold" : "/warm";
+        auto prepare = [&] {
+            if (cold) flush_files(paths, true);
+        };
+        if (cold && !flush_files(paths, true)) break;
+
+        runner.run_prepared("io/read_ifstream" + cache, total_bytes, prepare, [&] {
+            size_t bytes = 0;
+            for (const auto& path : paths) {
+                std::ifstream in(path, std::ios::binary);
+                std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+                bytes += text.size();
+            }
+            do_not_optimize(bytes);
+        });
+        for (const auto& backend : backends) {
+            AsyncIoOptions io;
+            io.backend = backend.second;
+            AsyncFileReader reader(io);
+            runner.run_prepared("io/read_async_" + backend.first + cache, total_bytes, prepare, [&] {
+                size_t bytes = 0;
+                reader.read_files(paths, [&](FileReadResult& file) { bytes += file.data.size(); });
+                do_not_optimize(bytes);
+            });
+        }
+    }
+
+    std::error_code ignored;
+    fs::remove_all(root, ignored);
+}
+
+void bench_library_cache(BenchRunner& runner, size_t file_count) {
+    if (!runner.selected("library/cold_start") && !runner.selected("library/warm_start")) {
+        return;
+    }
+
+    namespace fs = std::filesystem;
+    fs::path root = fs::temp_directory_path() / "orsf_bench_library";
+    fs::remove_all(root);
+    fs::create_directories(root / "setups");
+
+    // Dated back, so a refresh trusts the mtimes it cached
+    SetupGenerator generator;
+    std::vector<std::string> paths;
+    size_t total_bytes = 0;
+    for (const auto& setup : generator.generate_range(0, file_count)) {
+        std::string text = setup.to_json_string();
+        paths.push_back((root / "setups" / ("setup_" + std::to_string(paths.size()) + ".json")).string());
+        std::ofstream(paths.back(), std::ios::binary) << text;
+        fs::last_write_time(paths.back(), fs::file_time_type::clock::now() - std::chrono::hours(1));
+        total_bytes += text.size();
+    }
+    const std::string cache_file = (root / "library.orsfcache").string();
+    auto no_prepare = [] {};
+
+    // Parse every file (empty cache), then load the saved cache and stat only
+    runner.run_prepared("library/cold_start", total_bytes, no_prepare, [&] {
+        LibraryCache cache(cache_file);
+        do_not_optimize(cache.refresh(paths).parsed);
+    });
+    {
+        LibraryCache cache(cache_file);
+        cache.refresh(paths);
+        cache.save();
+    }
+    runner.run_prepared("library/warm_start", total_bytes, no_prepare, [&] {
+        LibraryCache cache(cache_file);
+        cache.load();
+        do_not_optimize(cache.refresh(paths).reused);
+    });
+
+    std::error_code ignored;
+    fs::remove_all(root, ignored);
+}
+
+int usage() {
+    std::cerr << "Usage: orsf_bench [--filter text] [--repetitions n] [--warmup n]\n"
+                 "                  [--min-time seconds] [--tail-samples n] [--max-threads n]\n"
+                 "                  [--io-files n] [--out file]\n";
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    size_t max_threads = 8;
+    size_t io_files = 2000;
+    std::string out_path;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) return usage();
+        std::string value = argv[++i];
+
+        if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--repetitions") {
+            options.repetitions = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--warmup") {
+            options.warmup = static_cast<size_t>(std::max(0, std::atoi(value.c_str())));
+        } else if (arg == "--min-time") {
+            options.min_repetition_seconds = std::atof(value.c_str());
+        } else if (arg == "--tail-samples") {
+            options.tail_samples = static_cast<size_t>(std::max(0, std::atoi(value.c_str())));
+        } else if (arg == "--max-threads") {
+            max_threads = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--io-files") {
+            io_files = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--out") {
+            out_path = value;
+        } else {
+            return usage();
+        }
+    }
+
+    options.allocation_counter = [] { return AllocationCounter::thread_total().allocations; };
+    BenchRunner runner(options);
+    ORSF setup = create_bench_setup();
+
+    std::fprintf(stderr, "%-40s %3s %12s %12s %16s\n", "benchmark", "thr", "median ns", "p99 ns", "ops/s");
+    bench_json(runner, setup);
+    bench_validation(runner, setup);
+    bench_mapping(runner, setup);
+    bench_lookup_table(runner);
+    bench_units(runner);
+    bench_corpus(runner);
+    bench_registry(runner, max_threads);
+    bench_file_io(runner, io_files);
+    bench_library_cache(runner, io_files);
+
+    json report = {
+        {"suite", "orsf_bench"},
+        {"orsf_version", VERSION},
+        {"options", {
+            {"repetitions", options.repetitions},
+            {"warmup", options.warmup},
+            {"min_repetition_seconds", options.min_repetition_seconds},
+            {"tail_samples", options.tail_samples},
+            {"filter", options.filter},
+            {"hardware_threads", std::thread::hardware_concurrency()},
+        }},
+        {"footprint", memory_footprint(setup).to_json()},
+        {"results", json::array()},
+    };
+    for (const auto& result : runner.results()) {
+        report["results"].push_back(result.to_json());
+    }
+
+    if (out_path.empty()) {
+        std::cout << report.dump(2) << std::endl;
+    } else {
+        std::ofstream out(out_path);
+        if (!out) {
+            std::cerr << "Failed to open " << out_path << std::endl;
+            return 1;
+        }
+        out << report.dump(2) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include "orsf/orsf.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace orsf;
+
+/// AdapterRegistry resolve throughput
+///
+/// Compares the previous registry lookup (mutex, two linear scans and
+/// by-value identity getters) with the snapshot index and the frozen
+/// perfect-hash table, at 1, 8 and 32 threads.
+///
+/// Usage: registry_benchmark [adapter_count] [seconds_per_run]
+
+namespace {
+
+class BenchAdapter : public BaseAdapter {
+public:
+    BenchAdapter(const std::string& id, const std::string& car_key)
+        : BaseAdapter(id, "1.0", car_key, "Benchmark adapter") {}
+
+    std::vector<uint8_t> orsf_to_native(const ORSF&) const override { return {}; }
+    ORSF native_to_orsf(const std::vector<uint8_t>&) const override { return ORSF{}; }
+    std::string get_suggested_filename() const override { return "bench.json"; }
+    std::string get_file_extension() const override { return "json"; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+    std::vector<FieldMapping> get_field_mappings() const override { return {}; }
+};
+
+// Registry lookup as implemented before the snapshot index
+class LegacyRegistry {
+public:
+    void register_adapter(std::shared_ptr<Adapter> adapter) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        adapters_.push_back(std::move(adapter));
+    }
+
+    std::shared_ptr<Adapter> resolve(
+        const std::string& id,
+        const std::string& version = "",
+        const std::string& car_key = ""
+    ) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (const auto& adapter : adapters_) {
+            bool id_match = adapter->get_id() == id;
+            bool version_match = version.empty() || adapter->get_version() == version;
+            bool car_match = car_key.empty() || adapter->get_car_key() == car_key;
+
+            if (id_match && version_match && car_match) {
+                return adapter;
+            }
+        }
+
+        for (const auto& adapter : adapters_) {
+            if (adapter->get_id() == id) {
+                return adapter;
+            }
+        }
+
+        return nullptr;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<Adapter>> adapters_;
+};
+
+struct Query {
+    std::string id;
+    std::string version;
+    std::string car_key;
+};
+
+using ResolveFunc = std::function<bool(const Query&)>;
+
+// Resolves per second over all threads
+double measure(int threads, double seconds, const std::vector<Query>& queries, const ResolveFunc& resolve) {
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> failures{0};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+
+            uint64_t count = 0;
+            size_t next = static_cast<size_t>(t) * 7919;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!resolve(queries[next++ % queries.size()])) failures.fetch_add(1);
+                ++count;
+            }
+            total.fetch_add(count);
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    stop.store(true);
+    for (auto& worker : workers) worker.join();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    if (failures > 0) {
+        std::fprintf(stderr, "warning: %llu lookups failed\n", static_cast<unsigned long long>(failures.load()));
+    }
+    return static_cast<double>(total) / elapsed;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int adapter_count = argc > 1 ? std::atoi(argv[1]) : 800;
+    double seconds = argc > 2 ? std::atof(argv[2]) : 0.5;
+
+    LegacyRegistry legacy;
+    AdapterRegistry registry;
+    std::vector<std::shared_ptr<Adapter>> adapters;
+    std::vector<Query> queries;
+
+    for (int i = 0; i < adapter_count; ++i) {
+        std::string id = "game" + std::to_string(i % 8);
+        std::string car_key = "car" + std::to_string(i);
+        auto adapter = std::make_shared<BenchAdapter>(id, car_key);
+        legacy.register_adapter(adapter);
+        adapters.push_back(adapter);
+        queries.push_back(Query{id, "1.0", car_key});
+    }
+    registry.register_adapters(adapters);
+
+    const int thread_counts[] = {1, 8, 32};
+
+    std::printf("AdapterRegistry::resolve, %d adapters (resolves/s)\n", adapter_count);
+    std::printf("%-8s %16s %16s %16s\n", "threads", "legacy", "snapshot", "frozen");
+
+    std::vector<double> snapshot_results;
+    for (int threads : thread_counts) {
+        snapshot_results.push_back(measure(threads, seconds, queries, [&](const Query& query) {
+            return registry.resolve(query.id, query.version, query.car_key) != nullptr;
+        }));
+    }
+
+    registry.freeze();
+
+    size_t row = 0;
+    for (int threads : thread_counts) {
+        double legacy_rate = measure(threads, seconds, queries, [&](const Query& query) {
+            return legacy.resolve(query.id, query.version, query.car_key) != nullptr;
+        });
+        double frozen_rate = measure(threads, seconds, queries, [&](const Query& query) {
+            return registry.resolve(query.id, query.version, query.car_key) != nullptr;
+        });
+        std::printf("%-8d %16.0f %16.0f %16.0f\n", threads, legacy_rate, snapshot_results[row++], frozen_rate);
+    }
+
+    return 0;
+}
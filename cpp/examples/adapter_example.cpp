@@ -29,20 +29,25 @@ public:
     std::vector<uint8_t> orsf_to_native(const ORSF& orsf) const override {
         std::cout << "  Converting ORSF to custom game format..." << std::endl;
 
+        ByteBuffer out;
+        ByteBufferSink sink(out);
+        write_native(orsf, sink);
+        return out.release();
+    }
+
+    void write_native(const ORSF& orsf, OutputSink& sink) const override {
         // Get field mappings
         FlatSetup native = orsf_to_flat(orsf);
 
-        // For this example, we'll create a simple text format
-        std::string output = "[CustomGameSetup]\n";
-        output += "name=" + orsf.metadata.name + "\n";
-        output += "car=" + orsf.car.make + " " + orsf.car.model + "\n\n";
-
-        output += "[Settings]\n";
-        for (const auto& [key, value] : native) {
-            output += key + "=" + std::to_string(value) + "\n";
-        }
+        // For this example, we'll stream a simple text format
+        TextWriter writer(sink);
+        writer.section("CustomGameSetup");
+        writer.key_value("name", orsf.metadata.name);
+        writer.write("car=").write(orsf.car.make).put(' ').write(orsf.car.model).write("\n\n");
 
-        return std::vector<uint8_t>(output.begin(), output.end());
+        writer.section("Settings");
+        write_key_values(native, writer);
+        writer.flush();
     }
 
     ORSF native_to_orsf(const std::vector<uint8_t>& data) const override {
@@ -137,14 +142,14 @@ int main() {
     std::cout << "--- Registering Adapters ---" << std::endl;
     auto example_adapter = std::make_shared<ExampleAdapter>();
     registry.register_adapter(example_adapter);
-    std::cout << "Registered: " << example_adapter->get_id()
-              << " v" << example_adapter->get_version() << std::endl;
+    std::cout << "Registered: " << example_adapter->id()
+              << " v" << example_adapter->version() << std::endl;
 
     // Register our custom adapter
     auto custom_adapter = std::make_shared<CustomGameAdapter>();
     registry.register_adapter(custom_adapter);
-    std::cout << "Registered: " << custom_adapter->get_id()
-              << " v" << custom_adapter->get_version() << std::endl;
+    std::cout << "Registered: " << custom_adapter->id()
+              << " v" << custom_adapter->version() << std::endl;
 
     std::cout << std::endl;
 
@@ -3,11 +3,19 @@
 #include "core.hpp"
 #include "validator.hpp"
 #include "mapping.hpp"
+#include "profile.hpp"
+#include "buffer.hpp"
+#include "sink.hpp"
+#include "detect.hpp"
+#include "epoch.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <map>
 #include <mutex>
+#include <atomic>
+#include <chrono>
 
 namespace orsf {
 
@@ -44,6 +52,31 @@ public:
     /// @throws std::runtime_error if conversion fails
     virtual ORSF native_to_orsf(const std::vector<uint8_t>& data) const = 0;
 
+    /// Convert native bytes from any contiguous memory (mmap, socket buffer)
+    /// Default copies into a vector and calls native_to_orsf(); adapters
+    /// override it to parse the bytes in place.
+    /// @throws std::runtime_error if conversion fails
+    virtual ORSF decode_native(ByteSpan data) const;
+
+    /// Convert ORSF to native format, appending to a caller-provided buffer
+    /// Default adopts the vector returned by orsf_to_native() (no copy when
+    /// out is empty); adapters override it to write into out directly.
+    /// @throws std::runtime_error if conversion fails
+    virtual void encode_native(const ORSF& orsf, ByteBuffer& out) const;
+
+    /// encode_native with the setup's numeric fields already extracted
+    /// (MappingEngine::extract_fields); convert_batch extracts each setup
+    /// once and passes the values to every adapter. Default ignores values
+    /// and calls encode_native().
+    /// @throws std::runtime_error if conversion fails
+    virtual void encode_extracted(const ORSF& orsf, const FieldValues& values, ByteBuffer& out) const;
+
+    /// Stream ORSF in native format to a sink (file, pipe, socket, ...)
+    /// Writes everything and flushes the sink. Default encodes into a
+    /// ByteBuffer first; adapters override it to emit output incrementally.
+    /// @throws std::runtime_error if conversion or writing fails
+    virtual void write_native(const ORSF& orsf, OutputSink& sink) const;
+
     /// Validate ORSF for this specific game
     /// @param orsf ORSF setup to validate
     /// @return Vector of validation errors (empty if valid)
@@ -52,6 +85,17 @@ public:
     /// Get file extension for native format (e.g., "sto", "set", "ini")
     virtual std::string get_file_extension() const = 0;
 
+    /// Get magic bytes identifying the native format (none by default)
+    /// Used by AdapterRegistry::detect(); signatures should lie within the
+    /// first AdapterRegistry::DETECT_HEAD_SIZE bytes of a file.
+    virtual std::vector<FormatSignature> get_signatures() const { return {}; }
+
+    /// Check whether the head of a file is in this adapter's native format
+    /// AdapterRegistry::detect() calls this only for candidates found by
+    /// signature or file extension, to confirm them without a full parse.
+    /// Default accepts every candidate.
+    virtual bool sniff(ByteSpan head) const { (void)head; return true; }
+
     /// Get game installation path (if applicable)
     /// @return Installation path or nullopt if not found
     virtual std::optional<std::string> get_install_path() const = 0;
@@ -69,33 +113,189 @@ public:
     };
 
     virtual Metadata get_metadata() const = 0;
+
+    /// Get adapter-specific validation profile (range overrides, extra rules)
+    /// @return Profile or nullopt to use the standard rules
+    virtual std::optional<ValidationProfile> get_validation_profile() const { return std::nullopt; }
+
+    /// Receive the rule program compiled for this adapter at registration
+    virtual void set_rule_program(std::shared_ptr<const RuleProgram> program) { (void)program; }
 };
 
+// ============================================================================
+// Static Adapter Registration
+// ============================================================================
+
+/// Entry in the link-time adapter table (see ORSF_REGISTER_ADAPTER)
+struct AdapterRegistration {
+    std::shared_ptr<Adapter> (*create)();
+    const char* name;
+};
+
+#define ORSF_CONCAT_IMPL(a, b) a##b
+#define ORSF_CONCAT(a, b) ORSF_CONCAT_IMPL(a, b)
+
+#if defined(__ELF__)
+
+// Entries are constant-initialized into the "orsf_adapters" section; the
+// linker provides the section bounds, so no static constructors run.
+extern "C" {
+extern const ::orsf::AdapterRegistration __start_orsf_adapters[] __attribute__((weak));
+extern const ::orsf::AdapterRegistration __stop_orsf_adapters[] __attribute__((weak));
+}
+
+/// Add an adapter type to the link-time adapter table
+/// The table is registered by AdapterRegistry::register_static_adapters().
+/// With static libraries, the object file must be linked in (e.g. whole-archive).
+#define ORSF_REGISTER_ADAPTER(AdapterType)                                                       \
+    static std::shared_ptr<::orsf::Adapter> ORSF_CONCAT(orsf_create_adapter_, __LINE__)() {      \
+        return std::make_shared<AdapterType>();                                                  \
+    }                                                                                            \
+    __attribute__((used, section("orsf_adapters"), aligned(alignof(::orsf::AdapterRegistration)))) \
+    static const ::orsf::AdapterRegistration ORSF_CONCAT(orsf_adapter_registration_, __LINE__) = { \
+        &ORSF_CONCAT(orsf_create_adapter_, __LINE__), #AdapterType                               \
+    }
+
+#else
+
+/// Append entry to the fallback adapter table (platforms without ELF sections)
+bool add_static_adapter_registration(const AdapterRegistration* registration);
+
+/// Get the fallback adapter table
+const std::vector<const AdapterRegistration*>& static_adapter_registrations();
+
+#define ORSF_REGISTER_ADAPTER(AdapterType)                                                       \
+    static std::shared_ptr<::orsf::Adapter> ORSF_CONCAT(orsf_create_adapter_, __LINE__)() {      \
+        return std::make_shared<AdapterType>();                                                  \
+    }                                                                                            \
+    static const ::orsf::AdapterRegistration ORSF_CONCAT(orsf_adapter_registration_, __LINE__) = { \
+        &ORSF_CONCAT(orsf_create_adapter_, __LINE__), #AdapterType                               \
+    };                                                                                           \
+    static const bool ORSF_CONCAT(orsf_adapter_registered_, __LINE__) =                          \
+        ::orsf::add_static_adapter_registration(&ORSF_CONCAT(orsf_adapter_registration_, __LINE__))
+
+#endif
+
 // ============================================================================
 // Adapter Registry
 // ============================================================================
 
+class Plugin;
+struct PluginReport;
+
 /// Thread-safe registry for game adapters
+///
+/// Reads (resolve, get_all_adapters, get_adapters_for_game) take no lock:
+/// they use an immutable, indexed snapshot that every mutation rebuilds and
+/// publishes through an atomic pointer. A reader marks itself in a per-epoch
+/// counter striped over cache lines while it loads from the snapshot, and a
+/// writer frees the previous snapshot only after the readers that could
+/// still see it have left, so writers wait for readers but readers never
+/// wait. After freeze(), reads use a perfect-hash table built from the
+/// final adapter set and mutations throw.
 class AdapterRegistry {
 public:
     /// Get singleton instance
     static AdapterRegistry& instance();
 
+    /// Create an independent registry (most code uses instance())
+    AdapterRegistry();
+    ~AdapterRegistry();
+
     /// Register an adapter
+    /// Compiles the adapter's validation rule program from its own profile,
+    /// any profile registered for its (id, version, car_key) and the car
+    /// class profiles.
     /// @param adapter Shared pointer to adapter
     void register_adapter(std::shared_ptr<Adapter> adapter);
 
+    /// Register several adapters, rebuilding the lookup index once
+    void register_adapters(const std::vector<std::shared_ptr<Adapter>>& adapters);
+
+    /// Create and register the adapters of a registration table
+    /// @return Number of adapters registered
+    size_t register_adapters(const AdapterRegistration* begin, const AdapterRegistration* end);
+
+    /// Create and register every adapter added with ORSF_REGISTER_ADAPTER
+    /// in the calling module
+    /// @return Number of adapters registered
+    size_t register_static_adapters() {
+#if defined(__ELF__)
+        return register_adapters(__start_orsf_adapters, __stop_orsf_adapters);
+#else
+        size_t count = 0;
+        for (const AdapterRegistration* registration : static_adapter_registrations()) {
+            count += register_adapters(registration, registration + 1);
+        }
+        return count;
+#endif
+    }
+
+    /// Register the adapters declared by plugin manifests in a directory
+    /// Only the "*.orsf-plugin.json" manifests are read; each plugin library
+    /// is opened the first time resolve() returns one of its adapters (or
+    /// the adapter is otherwise used), once, even under concurrent use.
+    /// @return Number of adapters registered
+    /// @throws std::runtime_error if the directory or a manifest cannot be read
+    size_t register_plugins(const std::string& directory);
+
+    /// Get manifest indexing time and per-plugin load accounting
+    PluginReport plugin_report() const;
+
+    /// Make the registry read-only
+    /// Builds a perfect-hash table over the current adapters; afterwards
+    /// lookups run without any synchronization beyond one atomic load and
+    /// every mutation throws std::runtime_error. Calling it again is a no-op.
+    void freeze();
+
+    /// Check if freeze() has been called
+    bool is_frozen() const { return frozen_.load(std::memory_order_acquire) != nullptr; }
+
+    /// Register validation profile for a car class (recompiles registered adapters)
+    void register_class_profile(const std::string& car_class, ValidationProfile profile);
+
+    /// Register validation profile for an adapter (recompiles matching adapters)
+    /// Takes precedence over the profile returned by the adapter itself.
+    void register_adapter_profile(
+        const std::string& id,
+        const std::string& version,
+        const std::string& car_key,
+        ValidationProfile profile
+    );
+
     /// Resolve adapter by game ID, version, and car key
+    /// Falls back to the first adapter registered for the game ID when no
+    /// adapter matches version and car key. Lock-free and allocation-free
+    /// (except when it loads a plugin for the first time).
+    /// @throws std::runtime_error if the resolved adapter's plugin fails to load
     /// @param id Game identifier
     /// @param version Game version (empty for any version)
     /// @param car_key Car identifier (empty for any car)
     /// @return Shared pointer to adapter or nullptr if not found
     std::shared_ptr<Adapter> resolve(
-        const std::string& id,
-        const std::string& version = "",
-        const std::string& car_key = ""
+        std::string_view id,
+        std::string_view version = {},
+        std::string_view car_key = {}
     ) const;
 
+    /// Bytes of a file head that detect() scans for signatures
+    static constexpr size_t DETECT_HEAD_SIZE = 512;
+
+    /// Find the adapters that can read a native file, best match first
+    /// Scans the first DETECT_HEAD_SIZE bytes of head once for every
+    /// registered signature (one Aho-Corasick automaton, compiled on first
+    /// use) and looks up the file name's extension. Candidates are ranked by
+    /// longest signature match, then extension match, then registration
+    /// order, and kept if Adapter::sniff() accepts the head.
+    /// @param head First bytes of the file
+    /// @param filename File name or path (empty to match by signature only)
+    std::vector<std::shared_ptr<Adapter>> detect_all(ByteSpan head, std::string_view filename = {}) const;
+
+    /// Find the best adapter for a native file (see detect_all())
+    /// Stops at the first candidate whose sniff() accepts the head.
+    /// @return Shared pointer to adapter or nullptr if none matches
+    std::shared_ptr<Adapter> detect(ByteSpan head, std::string_view filename = {}) const;
+
     /// Get all registered adapters
     std::vector<std::shared_ptr<Adapter>> get_all_adapters() const;
 
@@ -105,19 +305,55 @@ public:
     /// Unregister adapter
     void unregister_adapter(const std::string& id, const std::string& version, const std::string& car_key);
 
-    /// Clear all registered adapters
+    /// Clear all registered adapters and validation profiles
     void clear();
 
-private:
-    AdapterRegistry() = default;
     AdapterRegistry(const AdapterRegistry&) = delete;
     AdapterRegistry& operator=(const AdapterRegistry&) = delete;
 
-    mutable std::mutex mutex_;
+private:
+    // Immutable lookup indexes over adapters_ (defined in adapter.cpp)
+    struct Snapshot;
+
+    // Perfect-hash table built by freeze() (defined in adapter.cpp)
+    struct FrozenTable;
+
+    // Signature automaton and extension index of a snapshot (defined in adapter.cpp)
+    struct FormatIndex;
+
+    // A reader's hold on the snapshot (defined in adapter.cpp)
+    class ReadGuard;
+
+    mutable std::mutex mutex_;      ///< Serializes writers only
     std::vector<std::shared_ptr<Adapter>> adapters_;
+    std::map<std::string, ValidationProfile> class_profiles_;
+    std::map<std::string, ValidationProfile> adapter_profiles_;
+    std::shared_ptr<const Snapshot> current_snapshot_;  ///< Owner of snapshot_ (mutex_ held)
+    std::atomic<const Snapshot*> snapshot_{nullptr};    ///< Snapshot published to readers
+    std::unique_ptr<ReaderEpochs> readers_;
+    std::vector<std::shared_ptr<Plugin>> plugins_;
+    std::chrono::nanoseconds plugin_index_time_{0};
+    std::unique_ptr<const FrozenTable> frozen_table_;
+    std::atomic<const FrozenTable*> frozen_{nullptr};
+
+    // Throw if the registry is frozen (mutex_ must be held)
+    void ensure_mutable() const;
+
+    // Compile and hand the rule program to an adapter (mutex_ must be held)
+    void compile_rule_program(Adapter& adapter) const;
+
+    // Rebuild and publish the snapshot from adapters_, then free the
+    // previous one once no reader can see it (mutex_ must be held)
+    void publish_snapshot();
+
+    // Snapshot used by readers (the frozen one after freeze())
+    std::shared_ptr<const Snapshot> read_snapshot() const;
+
+    // Ranked candidates for a file whose sniff() accepts the head
+    std::vector<std::shared_ptr<Adapter>> detect_candidates(ByteSpan head, std::string_view filename, bool first_only) const;
 
     // Helper to create unique key for adapter
-    static std::string make_key(const std::string& id, const std::string& version, const std::string& car_key);
+    static std::string make_key(std::string_view id, std::string_view version, std::string_view car_key);
 };
 
 // ============================================================================
@@ -135,22 +371,58 @@ public:
         const std::string& author = ""
     );
 
+    /// The registry indexes adapters by what these return when they are
+    /// registered; id(), version() and car_key() view metadata_ only.
     std::string get_id() const override { return metadata_.id; }
     std::string get_version() const override { return metadata_.version; }
     std::string get_car_key() const override { return metadata_.car_key; }
     Metadata get_metadata() const override { return metadata_; }
 
-    /// Default validation uses standard ORSF validator
+    /// Game identifier without copying (valid while the adapter lives)
+    std::string_view id() const noexcept { return metadata_.id; }
+
+    /// Game version without copying (valid while the adapter lives)
+    std::string_view version() const noexcept { return metadata_.version; }
+
+    /// Car key without copying (valid while the adapter lives)
+    std::string_view car_key() const noexcept { return metadata_.car_key; }
+
+    /// Adapter metadata without copying
+    const Metadata& metadata() const noexcept { return metadata_; }
+
+    /// Default validation uses the rule program compiled at registration,
+    /// or the standard ORSF validator if the adapter is not registered
     std::vector<ValidationError> validate_orsf(const ORSF& orsf) const override;
 
+    void set_rule_program(std::shared_ptr<const RuleProgram> program) override;
+
+    /// Get rule program compiled at registration (nullptr if none)
+    std::shared_ptr<const RuleProgram> get_rule_program() const;
+
+    /// Get field mappings compiled into a plan (built once, on first use)
+    /// get_field_mappings() must return the same mappings on every call.
+    std::shared_ptr<const MappingPlan> mapping_plan() const;
+
 protected:
-    Metadata metadata_;
+    Metadata metadata_;     ///< id, version and car_key must not change after registration
+    Published<RuleProgram> rule_program_;   ///< Read without locks by validate_orsf()
+    mutable std::once_flag mapping_once_;
+    mutable std::shared_ptr<const MappingPlan> mapping_plan_;     ///< Set once under mapping_once_
 
-    /// Helper: Convert ORSF to flat key-value using field mappings
+    /// Compiled mapping plan without touching its reference count
+    const MappingPlan& compiled_plan() const;
+
+    /// Helper: Convert ORSF to flat key-value using the compiled mapping plan
     FlatSetup orsf_to_flat(const ORSF& orsf) const;
 
-    /// Helper: Convert flat key-value to ORSF using field mappings
+    /// Helper: orsf_to_flat reading pre-extracted values (see encode_extracted)
+    FlatSetup orsf_to_flat(const ORSF& orsf, const FieldValues& values) const;
+
+    /// Helper: Convert flat key-value to ORSF using the compiled mapping plan
     ORSF flat_to_orsf(const FlatSetup& flat, const ORSF& template_orsf) const;
+
+    /// Helper: Write flat key-value setup as "key=value" lines
+    void write_key_values(const FlatSetup& flat, TextWriter& writer) const;
 };
 
 // ============================================================================
@@ -164,8 +436,13 @@ public:
 
     std::vector<uint8_t> orsf_to_native(const ORSF& orsf) const override;
     ORSF native_to_orsf(const std::vector<uint8_t>& data) const override;
+    ORSF decode_native(ByteSpan data) const override;
+    void encode_native(const ORSF& orsf, ByteBuffer& out) const override;
+    void write_native(const ORSF& orsf, OutputSink& sink) const override;
     std::string get_suggested_filename() const override;
     std::string get_file_extension() const override;
+    std::vector<FormatSignature> get_signatures() const override;
+    bool sniff(ByteSpan head) const override;
     std::optional<std::string> get_install_path() const override;
     std::vector<FieldMapping> get_field_mappings() const override;
 };
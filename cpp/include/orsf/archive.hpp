@@ -0,0 +1,84 @@
+#pragma once
+
+#include "buffer.hpp"
+#include "core.hpp"
+#include "sink.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace orsf {
+
+// ============================================================================
+// Setup Archives
+// ============================================================================
+
+/// One archived setup: a name (usually the source file name) and its JSON
+struct ArchiveEntry {
+    std::string_view name;
+    std::string_view json;
+};
+
+/// Writes a setup archive (.orsfpack) to a sink, one entry at a time
+///
+/// Layout (little-endian): "ORSFPAK1", u32 version, then per entry
+/// u32 name size, name, u64 JSON size, JSON; finish() appends a trailer
+/// (u32 0xFFFFFFFF, u64 entry count) so truncated archives are detected.
+class ArchiveWriter {
+public:
+    static constexpr const char* MAGIC = "ORSFPAK1";
+    static constexpr const char* EXTENSION = "orsfpack";
+
+    explicit ArchiveWriter(OutputSink& sink);
+
+    /// Add an entry with JSON text as is
+    void add(std::string_view name, std::string_view json);
+
+    /// Add a setup as compact JSON
+    void add(std::string_view name, const ORSF& setup);
+
+    /// Write the trailer and flush the sink
+    void finish();
+
+    uint64_t count() const { return count_; }
+
+private:
+    OutputSink& sink_;
+    ByteBuffer header_;
+    uint64_t count_ = 0;
+    bool finished_ = false;
+};
+
+/// Reads entries from an archive held in memory (views into the data)
+///
+///     ArchiveReader reader(bytes);
+///     ArchiveEntry entry;
+///     while (reader.next(entry)) { ORSF::from_json(std::string(entry.json)); }
+class ArchiveReader {
+public:
+    /// @throws std::runtime_error if data does not start with an archive header
+    explicit ArchiveReader(ByteSpan data);
+
+    /// Check if data starts with the archive magic
+    static bool is_archive(ByteSpan head);
+
+    /// Read the next entry; false after the trailer
+    /// @throws std::runtime_error if the archive is truncated or corrupt
+    bool next(ArchiveEntry& entry);
+
+    /// Entries read so far
+    uint64_t count() const { return count_; }
+
+private:
+    ByteSpan data_;
+    size_t pos_ = 0;
+    uint64_t count_ = 0;
+    bool done_ = false;
+
+    uint32_t u32();
+    uint64_t u64();
+    std::string_view bytes(uint64_t size);
+};
+
+} // namespace orsf
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "core.hpp"
+#include "adapter.hpp"
+#include "buffer.hpp"
+#include "executor.hpp"
+#include "validator.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Batch Conversion
+// ============================================================================
+
+/// Outcome of converting one setup with one adapter
+struct BatchItem {
+    size_t setup = 0;           ///< Index into the setups
+    size_t adapter = 0;         ///< Index into the adapters
+    size_t slice = 0;           ///< Arena slice holding the native bytes
+    size_t offset = 0;          ///< Start of the native bytes in the slice
+    size_t size = 0;            ///< Length of the native bytes
+    std::string error;          ///< Conversion error (empty on success)
+
+    bool ok() const { return error.empty(); }
+};
+
+/// Native bytes of a whole N x M batch, one arena slice per worker
+///
+/// Encoded sizes are only known after encoding, so a single contiguous
+/// arena would cost either a second copy of every byte or a sizing pass
+/// that encodes twice. Each item's bytes are still one contiguous span in
+/// its worker's slice; callers that need one buffer can append the spans.
+struct BatchResult {
+    std::vector<std::vector<uint8_t>> arena;
+    std::vector<BatchItem> items;   ///< Setup-major: items[setup * adapter_count + adapter]
+    size_t setup_count = 0;
+    size_t adapter_count = 0;
+
+    const BatchItem& at(size_t setup, size_t adapter) const {
+        return items[setup * adapter_count + adapter];
+    }
+
+    /// Native bytes of an item (empty on error)
+    ByteSpan bytes(const BatchItem& item) const {
+        if (item.size == 0) return ByteSpan();
+        return ByteSpan(arena[item.slice].data() + item.offset, item.size);
+    }
+
+    ByteSpan bytes(size_t setup, size_t adapter) const { return bytes(at(setup, adapter)); }
+
+    /// Number of failed conversions
+    size_t error_count() const;
+
+    /// Total native bytes across all slices
+    size_t arena_size() const;
+};
+
+/// Convert every setup with every adapter
+///
+/// Each setup's numeric fields are extracted once and passed to every
+/// adapter's encode_extracted (BaseAdapter mapping plans read them directly). The N x M grid is
+/// spread over the executor; each worker encodes directly into its own arena
+/// slice, so no bytes are copied after encoding. Conversion failures are
+/// recorded per item and do not stop the batch.
+BatchResult convert_batch(
+    const ORSF* setups,
+    size_t setup_count,
+    const std::shared_ptr<Adapter>* adapters,
+    size_t adapter_count,
+    Executor& executor
+);
+
+/// Convert every setup with every adapter
+BatchResult convert_batch(
+    const std::vector<ORSF>& setups,
+    const std::vector<std::shared_ptr<Adapter>>& adapters,
+    Executor& executor
+);
+
+/// Convert every setup with every adapter on default_executor()
+BatchResult convert_batch(
+    const std::vector<ORSF>& setups,
+    const std::vector<std::shared_ptr<Adapter>>& adapters
+);
+
+// ============================================================================
+// Batch Parsing and Validation
+// ============================================================================
+
+/// Outcome of parsing one JSON document
+struct ParsedSetup {
+    ORSF setup;
+    std::string error;          ///< Parse error (empty on success)
+
+    bool ok() const { return error.empty(); }
+};
+
+/// Parse JSON documents in parallel; failures are recorded per document
+std::vector<ParsedSetup> parse_batch(const std::vector<std::string>& texts, Executor& executor);
+
+/// Parse JSON documents on default_executor()
+std::vector<ParsedSetup> parse_batch(const std::vector<std::string>& texts);
+
+/// Validate setups in parallel (result i holds Validator::validate(setups[i]))
+std::vector<std::vector<ValidationError>> validate_batch(const std::vector<ORSF>& setups, Executor& executor);
+
+/// Validate setups on default_executor()
+std::vector<std::vector<ValidationError>> validate_batch(const std::vector<ORSF>& setups);
+
+} // namespace orsf
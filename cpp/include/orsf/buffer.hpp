@@ -0,0 +1,137 @@
+#pragma once
+
+#include "core.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Byte Views and Buffers
+// ============================================================================
+
+/// Non-owning view of contiguous bytes (C++17 stand-in for std::span<const std::byte>)
+///
+/// Can view a std::vector<uint8_t>, a std::string, an mmap'd region or a
+/// socket buffer without copying. The viewed memory must outlive the span.
+class ByteSpan {
+public:
+    constexpr ByteSpan() noexcept = default;
+    constexpr ByteSpan(const std::byte* data, size_t size) noexcept : data_(data), size_(size) {}
+
+    ByteSpan(const void* data, size_t size) noexcept
+        : data_(static_cast<const std::byte*>(data)), size_(size) {}
+
+    explicit ByteSpan(const std::vector<uint8_t>& bytes) noexcept
+        : ByteSpan(bytes.data(), bytes.size()) {}
+
+    explicit ByteSpan(std::string_view text) noexcept
+        : ByteSpan(text.data(), text.size()) {}
+
+    // A span of a temporary would dangle at the end of the statement
+    explicit ByteSpan(std::vector<uint8_t>&&) = delete;
+    explicit ByteSpan(std::string&&) = delete;
+
+    constexpr const std::byte* data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr const std::byte* begin() const noexcept { return data_; }
+    constexpr const std::byte* end() const noexcept { return data_ + size_; }
+
+    /// View the bytes as characters
+    std::string_view as_chars() const noexcept {
+        return std::string_view(reinterpret_cast<const char*>(data_), size_);
+    }
+
+    /// Sub-view starting at offset (clamped to the end)
+    ByteSpan subspan(size_t offset, size_t count = static_cast<size_t>(-1)) const noexcept {
+        if (offset > size_) offset = size_;
+        if (count > size_ - offset) count = size_ - offset;
+        return ByteSpan(data_ + offset, count);
+    }
+
+private:
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/// Growable output buffer for adapter encoders
+///
+/// Appends go to a std::vector<uint8_t> that can be adopted from or
+/// released to the legacy vector-based API without copying. Reusing one
+/// buffer across conversions (clear() keeps capacity) avoids reallocation.
+class ByteBuffer {
+public:
+    ByteBuffer() = default;
+    explicit ByteBuffer(size_t reserve_bytes) { bytes_.reserve(reserve_bytes); }
+
+    const uint8_t* data() const noexcept { return bytes_.data(); }
+    size_t size() const noexcept { return bytes_.size(); }
+    bool empty() const noexcept { return bytes_.empty(); }
+    size_t capacity() const noexcept { return bytes_.capacity(); }
+
+    void reserve(size_t bytes) { bytes_.reserve(bytes); }
+
+    /// Drop contents, keeping capacity
+    void clear() noexcept { bytes_.clear(); }
+
+    void append(const void* data, size_t size) {
+        const auto* first = static_cast<const uint8_t*>(data);
+        bytes_.insert(bytes_.end(), first, first + size);
+    }
+
+    void append(ByteSpan bytes) { append(bytes.data(), bytes.size()); }
+    void append(std::string_view text) { append(text.data(), text.size()); }
+    void push_back(char c) { bytes_.push_back(static_cast<uint8_t>(c)); }
+
+    /// Append vector, adopting its storage when the buffer is empty
+    void append(std::vector<uint8_t>&& bytes) {
+        if (bytes_.empty()) {
+            bytes_ = std::move(bytes);
+        } else {
+            bytes_.insert(bytes_.end(), bytes.begin(), bytes.end());
+        }
+    }
+
+    /// Extend by size bytes and return pointer to the new region (for direct writes)
+    uint8_t* grow(size_t size) {
+        size_t offset = bytes_.size();
+        bytes_.resize(offset + size);
+        return bytes_.data() + offset;
+    }
+
+    /// Shrink to size bytes (after writing less than grow() reserved)
+    void truncate(size_t size) {
+        if (size < bytes_.size()) bytes_.resize(size);
+    }
+
+    ByteSpan span() const noexcept { return ByteSpan(bytes_.data(), bytes_.size()); }
+
+    /// Move the contents out as a vector (buffer is left empty)
+    std::vector<uint8_t> release() noexcept {
+        std::vector<uint8_t> result = std::move(bytes_);
+        bytes_.clear();
+        return result;
+    }
+
+private:
+    std::vector<uint8_t> bytes_;
+};
+
+// ============================================================================
+// JSON Helpers
+// ============================================================================
+
+/// Parse ORSF directly from JSON bytes (no intermediate std::string)
+/// @throws std::runtime_error if parsing fails
+ORSF parse_orsf_json(ByteSpan bytes);
+
+/// Serialize ORSF as JSON, appending to buffer (no intermediate std::string)
+/// @param indent Indentation (-1 for compact), as ORSF::to_json_string
+void write_orsf_json(const ORSF& orsf, ByteBuffer& out, int indent = -1);
+
+} // namespace orsf
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "core.hpp"
+#include "validator.hpp"
+#include "adapter.hpp"
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Content Hashing
+// ============================================================================
+
+/// Canonical 64-bit content hash of an ORSF
+///
+/// Stable across field order and formatting: object keys are hashed in sorted
+/// order, numbers as normalized doubles (-0 equals 0, integer and float forms
+/// of the same value hash equal, all NaNs hash equal). Every field counts,
+/// metadata.updated_at included: validation and native output depend on it.
+uint64_t content_hash(const ORSF& orsf);
+
+// ============================================================================
+// LRU Cache
+// ============================================================================
+
+/// Cache counters
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t size = 0;
+    size_t capacity = 0;
+};
+
+/// Bounded, thread-safe least-recently-used cache
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+public:
+    explicit LruCache(size_t capacity) : capacity_(capacity) {}
+
+    /// Look up value and mark it most recently used
+    std::optional<Value> get(const Key& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            ++stats_.misses;
+            return std::nullopt;
+        }
+
+        ++stats_.hits;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->second;
+    }
+
+    /// Insert or replace value, evicting the least recently used entry if full
+    void put(const Key& key, Value value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (capacity_ == 0) return;
+
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->second = std::move(value);
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+
+        if (entries_.size() >= capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+            ++stats_.evictions;
+        }
+
+        entries_.emplace_front(key, std::move(value));
+        index_.emplace(key, entries_.begin());
+    }
+
+    /// Remove all entries (counters are kept)
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        index_.clear();
+    }
+
+    /// Get counters
+    CacheStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CacheStats result = stats_;
+        result.size = entries_.size();
+        result.capacity = capacity_;
+        return result;
+    }
+
+private:
+    using Entry = std::pair<Key, Value>;
+
+    mutable std::mutex mutex_;
+    size_t capacity_;
+    std::list<Entry> entries_;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> index_;
+    CacheStats stats_;
+};
+
+// ============================================================================
+// Validation / Conversion Result Cache
+// ============================================================================
+
+/// Key for cached validation results (adapter fields empty for Validator::validate)
+struct ValidationCacheKey {
+    uint64_t content_hash;
+    uint32_t rule_set_version;
+    std::string adapter_id;
+    std::string adapter_version;
+    std::string car_key;
+
+    bool operator==(const ValidationCacheKey& other) const {
+        return content_hash == other.content_hash && rule_set_version == other.rule_set_version &&
+               adapter_id == other.adapter_id && adapter_version == other.adapter_version &&
+               car_key == other.car_key;
+    }
+
+    struct Hash {
+        size_t operator()(const ValidationCacheKey& key) const;
+    };
+};
+
+/// Key for cached native conversion results
+struct ConversionCacheKey {
+    uint64_t content_hash;
+    std::string adapter_id;
+    std::string adapter_version;
+    std::string car_key;
+
+    bool operator==(const ConversionCacheKey& other) const {
+        return content_hash == other.content_hash && adapter_id == other.adapter_id &&
+               adapter_version == other.adapter_version && car_key == other.car_key;
+    }
+
+    struct Hash {
+        size_t operator()(const ConversionCacheKey& key) const;
+    };
+};
+
+/// Cache of validation results and native bytes keyed by content hash
+class ResultCache {
+public:
+    using Errors = std::shared_ptr<const std::vector<ValidationError>>;
+    using Bytes = std::shared_ptr<const std::vector<uint8_t>>;
+
+    explicit ResultCache(size_t validation_capacity = 4096, size_t conversion_capacity = 1024);
+
+    /// Validate with Validator::validate, reusing cached results
+    /// @param rule_set_version Version of the rules (bump when rules change)
+    Errors validate(const ORSF& orsf, uint32_t rule_set_version = Validator::RULE_SET_VERSION);
+
+    /// Validate with an adapter's rules, reusing cached results
+    /// Results are keyed by adapter id, version and car key as well.
+    /// @param rule_set_version Version identifying the adapter's rule set
+    Errors validate(const Adapter& adapter, const ORSF& orsf, uint32_t rule_set_version);
+
+    /// Convert with adapter, reusing cached native bytes
+    Bytes orsf_to_native(const Adapter& adapter, const ORSF& orsf);
+
+    /// Look up / compute validation result for a precomputed hash
+    Errors validation(const ValidationCacheKey& key, const std::function<std::vector<ValidationError>()>& compute);
+
+    /// Look up / compute native bytes for a precomputed key
+    Bytes conversion(const ConversionCacheKey& key, const std::function<std::vector<uint8_t>()>& compute);
+
+    CacheStats validation_stats() const { return validation_cache_.stats(); }
+    CacheStats conversion_stats() const { return conversion_cache_.stats(); }
+
+    /// Drop all cached results
+    void clear();
+
+private:
+    LruCache<ValidationCacheKey, Errors, ValidationCacheKey::Hash> validation_cache_;
+    LruCache<ConversionCacheKey, Bytes, ConversionCacheKey::Hash> conversion_cache_;
+};
+
+} // namespace orsf
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "core.hpp"
+#include "executor.hpp"
+#include "validator.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Columnar Setup Store
+// ============================================================================
+
+/// Fixed-size bitmap with one bit per row (64 rows per word)
+class Bitmap {
+public:
+    Bitmap() = default;
+
+    /// Create bitmap with all bits set to value
+    explicit Bitmap(size_t size, bool value = false);
+
+    /// Number of rows covered by the bitmap
+    size_t size() const { return size_; }
+
+    /// Test bit for row
+    bool test(size_t row) const {
+        return (words_[row >> 6] >> (row & 63)) & 1u;
+    }
+
+    /// Set or clear bit for row
+    void set(size_t row, bool value = true) {
+        const uint64_t bit = uint64_t(1) << (row & 63);
+        if (value) words_[row >> 6] |= bit;
+        else words_[row >> 6] &= ~bit;
+    }
+
+    /// Number of set bits
+    size_t count() const;
+
+    /// Check if no bit is set
+    bool none() const;
+
+    /// Row indices of all set bits (ascending)
+    std::vector<size_t> indices() const;
+
+    /// Raw words (bits past size() are always zero)
+    const std::vector<uint64_t>& words() const { return words_; }
+    std::vector<uint64_t>& words() { return words_; }
+
+    Bitmap& operator|=(const Bitmap& other);
+    Bitmap& operator&=(const Bitmap& other);
+
+private:
+    std::vector<uint64_t> words_;
+    size_t size_ = 0;
+};
+
+/// Column of doubles with a validity bitmap (bit clear = field absent)
+struct DoubleColumn {
+    std::string field;              ///< ORSF field path
+    std::vector<double> values;     ///< One value per row (0.0 where invalid)
+    Bitmap validity;                ///< Rows where the field is present
+};
+
+/// Column-oriented store of numeric setup fields
+class SetupColumns {
+public:
+    SetupColumns() = default;
+
+    /// Build columns for the given field paths from a set of setups
+    /// @throws std::runtime_error if a path is not a known numeric field
+    static SetupColumns from_setups(
+        const std::vector<ORSF>& setups,
+        const std::vector<std::string>& fields
+    );
+
+    /// Build columns for the given field paths, one column per executor task
+    /// @throws std::runtime_error if a path is not a known numeric field
+    static SetupColumns from_setups(
+        const std::vector<ORSF>& setups,
+        const std::vector<std::string>& fields,
+        Executor& executor
+    );
+
+    /// Build columns for every numeric field
+    static SetupColumns from_setups(const std::vector<ORSF>& setups);
+
+    /// Add a column (its size must match the existing row count)
+    /// @throws std::runtime_error on size mismatch
+    void add_column(DoubleColumn column);
+
+    /// Find column by field path
+    /// @return Column or nullptr if not present
+    const DoubleColumn* find(const std::string& field) const;
+
+    /// Number of rows (setups)
+    size_t rows() const { return rows_; }
+
+    /// Get all columns
+    const std::vector<DoubleColumn>& columns() const { return columns_; }
+
+private:
+    size_t rows_ = 0;
+    std::vector<DoubleColumn> columns_;
+    std::unordered_map<std::string, size_t> index_;
+};
+
+// ============================================================================
+// Columnar Validation
+// ============================================================================
+
+/// Check performed by a column rule (mirrors Validator helpers)
+enum class ColumnCheck {
+    Range,          ///< min <= value <= max
+    Positive,       ///< value > 0
+    NonNegative,    ///< value >= 0
+    Percentage      ///< 0 <= value <= 100
+};
+
+/// Single-field validation rule evaluated over a column
+struct ColumnRule {
+    std::string field;
+    ColumnCheck check;
+    double min = 0.0;
+    double max = 0.0;
+    ValidationSeverity severity = ValidationSeverity::Error;
+
+    static ColumnRule range(const std::string& field, double min, double max,
+                            ValidationSeverity severity = ValidationSeverity::Error);
+    static ColumnRule positive(const std::string& field);
+    static ColumnRule non_negative(const std::string& field);
+    static ColumnRule percentage(const std::string& field);
+
+    /// Check if value violates the rule (NaN never violates, as in Validator)
+    bool violates(double value) const;
+
+    /// Append the error Validator would report for this value (if any)
+    void check_value(double value, std::vector<ValidationError>& errors) const;
+};
+
+/// Validator running range rules as compare-and-mask kernels over columns
+class ColumnarValidator {
+public:
+    /// Create validator from rules
+    explicit ColumnarValidator(std::vector<ColumnRule> rules = default_rules());
+
+    /// Range/positive/percentage rules applied by Validator, in the same order
+    static std::vector<ColumnRule> default_rules();
+
+    /// Evaluate all rules
+    /// @return One bitmap of violating rows per rule (empty rows if column absent)
+    std::vector<Bitmap> evaluate(const SetupColumns& columns) const;
+
+    /// Evaluate all rules, one rule per executor task
+    std::vector<Bitmap> evaluate(const SetupColumns& columns, Executor& executor) const;
+
+    /// Evaluate a single rule over a column
+    static Bitmap evaluate_rule(const ColumnRule& rule, const DoubleColumn& column);
+
+    /// Combine per-rule bitmaps into rows with at least one violation
+    static Bitmap any_violation(const std::vector<Bitmap>& violations, size_t rows);
+
+    /// Materialize validation errors for one row
+    std::vector<ValidationError> errors_for_row(
+        const SetupColumns& columns,
+        const std::vector<Bitmap>& violations,
+        size_t row
+    ) const;
+
+    /// Get rules
+    const std::vector<ColumnRule>& rules() const { return rules_; }
+
+private:
+    std::vector<ColumnRule> rules_;
+};
+
+} // namespace orsf
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "buffer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Native Format Signatures
+// ============================================================================
+
+/// Magic bytes identifying a native format
+struct FormatSignature {
+    std::string bytes;                  ///< Pattern (any byte values; empty patterns are ignored)
+    std::optional<size_t> offset;       ///< Required start position (nullopt = anywhere in the head)
+
+    FormatSignature(std::string pattern, std::optional<size_t> at = std::nullopt)
+        : bytes(std::move(pattern)), offset(at) {}
+
+    bool operator==(const FormatSignature& other) const {
+        return bytes == other.bytes && offset == other.offset;
+    }
+};
+
+/// Occurrence of a pattern found by SignatureMatcher::scan()
+struct SignatureMatch {
+    size_t pattern;                     ///< Index of the pattern passed to the constructor
+    size_t position;                    ///< Start of the occurrence in the scanned bytes
+};
+
+/// Aho-Corasick matcher over a fixed set of byte patterns
+///
+/// The automaton is compiled into a dense transition table over byte
+/// classes (bytes that occur in no pattern share one class), so a scan
+/// does one table lookup per input byte and finds every occurrence of
+/// every pattern in a single pass.
+class SignatureMatcher {
+public:
+    SignatureMatcher() = default;
+    explicit SignatureMatcher(const std::vector<std::string>& patterns);
+
+    /// Append all occurrences of all patterns in data to matches
+    void scan(ByteSpan data, std::vector<SignatureMatch>& matches) const;
+
+    /// Number of automaton states
+    size_t state_count() const { return class_count_ > 0 ? transitions_.size() / class_count_ : 0; }
+
+private:
+    uint16_t byte_class_[256] = {};      ///< 0 = byte occurs in no pattern
+    size_t class_count_ = 0;
+    std::vector<uint32_t> transitions_;     ///< state * class_count_ + class -> state
+    std::vector<uint32_t> output_begin_;    ///< Per state, into outputs_ (size states + 1)
+    std::vector<uint32_t> outputs_;         ///< Pattern indices ending at each state
+    std::vector<size_t> lengths_;           ///< Per pattern
+};
+
+/// Normalized extension of a file name ("Setup.STO" -> "sto", "" if none)
+std::string file_extension(std::string_view filename);
+
+/// Normalize an extension as declared by an adapter (".Sto" -> "sto")
+std::string normalize_extension(std::string_view extension);
+
+} // namespace orsf
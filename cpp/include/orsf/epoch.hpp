@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace orsf {
+
+// ============================================================================
+// Reader Epochs
+// ============================================================================
+
+/// Readers in flight per epoch, striped over cache lines
+///
+/// A reader counts itself in the current epoch's stripe for its thread
+/// (Section), then loads a published pointer. After publishing a new
+/// pointer, a writer flips the epoch and waits until the previous epoch's
+/// readers have left, twice (synchronize()): every reader that loaded the
+/// old pointer counted itself before the new one was stored, in one epoch
+/// or the other, and flipping first keeps new readers out of the epoch
+/// being drained. Readers never wait; writers wait for readers.
+class ReaderEpochs {
+public:
+    /// Counts the calling thread as a reader until destroyed
+    class Section {
+    public:
+        explicit Section(ReaderEpochs& epochs) noexcept;
+        ~Section() { stripe_->fetch_sub(1, std::memory_order_release); }
+
+        Section(const Section&) = delete;
+        Section& operator=(const Section&) = delete;
+
+    private:
+        std::atomic<uint64_t>* stripe_;
+    };
+
+    ReaderEpochs() = default;
+    ReaderEpochs(const ReaderEpochs&) = delete;
+    ReaderEpochs& operator=(const ReaderEpochs&) = delete;
+
+    /// Wait until no reader that started before this call is left
+    /// Must not be called from inside a Section of the same epochs.
+    void synchronize();
+
+    /// Epochs shared by values that are published rarely (see Published)
+    static ReaderEpochs& shared();
+
+private:
+    static constexpr size_t STRIPES = 16;
+
+    struct alignas(64) Stripe {
+        std::atomic<uint64_t> readers{0};
+    };
+
+    std::mutex writers_;                ///< One synchronize() at a time
+    std::atomic<unsigned> epoch_{0};
+    Stripe stripes_[2][STRIPES];
+
+    static size_t stripe_index();
+};
+
+// ============================================================================
+// Published Values
+// ============================================================================
+
+/// Immutable value that writers replace and readers use without locking
+///
+/// Reading is a striped counter increment and one atomic load; the value's
+/// reference count is only touched by load(). store() publishes the new
+/// value and frees the previous one once no reader can still see it, so it
+/// waits for readers in flight (and must not be called from inside a
+/// Reader of the same epochs).
+///
+///     Published<RuleProgram> program;
+///     program.store(RuleProgram::compile(profiles));
+///     Published<RuleProgram>::Reader current(program);
+///     if (current) current->validate(setup);
+template <typename T>
+class Published {
+public:
+    explicit Published(ReaderEpochs& epochs = ReaderEpochs::shared()) : epochs_(epochs) {}
+
+    ~Published() { delete current_.load(std::memory_order_relaxed); }
+
+    Published(const Published&) = delete;
+    Published& operator=(const Published&) = delete;
+
+    /// Borrows the current value until destroyed
+    class Reader {
+    public:
+        explicit Reader(const Published& published)
+            : section_(published.epochs_), value_(published.current_.load(std::memory_order_seq_cst)) {}
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        const T* get() const { return value_ != nullptr ? value_->get() : nullptr; }
+        const T* operator->() const { return get(); }
+        const T& operator*() const { return *get(); }
+        explicit operator bool() const { return get() != nullptr; }
+
+        /// Shared ownership of the borrowed value (nullptr if none)
+        std::shared_ptr<const T> share() const {
+            return value_ != nullptr ? *value_ : std::shared_ptr<const T>();
+        }
+
+    private:
+        ReaderEpochs::Section section_;
+        const std::shared_ptr<const T>* value_;
+    };
+
+    /// Shared ownership of the current value (nullptr if none)
+    std::shared_ptr<const T> load() const { return Reader(*this).share(); }
+
+    /// Replace the value, then wait until readers of the previous one have left
+    void store(std::shared_ptr<const T> value) {
+        auto* next = value ? new std::shared_ptr<const T>(std::move(value)) : nullptr;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::unique_ptr<const std::shared_ptr<const T>> previous(
+            current_.exchange(next, std::memory_order_seq_cst));
+        if (previous) epochs_.synchronize();
+    }
+
+private:
+    ReaderEpochs& epochs_;
+    std::mutex mutex_;      ///< Serializes writers only
+    std::atomic<const std::shared_ptr<const T>*> current_{nullptr};
+};
+
+} // namespace orsf
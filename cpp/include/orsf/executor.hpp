@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Executors
+// ============================================================================
+
+/// Runs loop bodies for the library's batch APIs
+///
+/// Implement this to run batch work on an existing thread pool.
+class Executor {
+public:
+    /// Loop body: item index and id of the worker running it (< concurrency())
+    using Body = std::function<void(size_t index, size_t worker)>;
+
+    virtual ~Executor() = default;
+
+    /// Run body for every index in [0, count) and wait for completion
+    /// Rethrows the first exception thrown by body; once a body has thrown,
+    /// indices not yet started are skipped.
+    virtual void parallel_for(size_t count, const Body& body) = 0;
+
+    /// Maximum number of bodies that run at the same time
+    virtual size_t concurrency() const = 0;
+};
+
+/// Executor running everything on the calling thread
+class InlineExecutor : public Executor {
+public:
+    void parallel_for(size_t count, const Body& body) override;
+    size_t concurrency() const override { return 1; }
+};
+
+/// Fixed-size thread pool with range stealing
+///
+/// Each worker starts with an equal slice of the index range and takes
+/// indices from its front; a worker that runs dry steals the back half of
+/// another worker's remaining slice. The calling thread participates as
+/// worker 0. parallel_for called from inside a body runs inline.
+///
+/// Loops started by different threads at the same time run side by side:
+/// each gets its own slices, and an idle pool thread joins the loop with
+/// work left that has the fewest pool threads.
+class ThreadPoolExecutor : public Executor {
+public:
+    /// @param threads Total workers including the caller (0 = hardware concurrency)
+    explicit ThreadPoolExecutor(size_t threads = 0);
+    ~ThreadPoolExecutor() override;
+
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+    ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+    void parallel_for(size_t count, const Body& body) override;
+    size_t concurrency() const override { return worker_count_; }
+
+private:
+    struct alignas(64) Slice {
+        std::atomic<uint64_t> bounds{0};    ///< begin << 32 | end
+    };
+
+    /// One loop in flight (lives on the calling thread's stack)
+    struct Job;
+
+    size_t worker_count_;
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::vector<Job*> jobs_;                ///< Loops pool threads may join
+    bool stopping_ = false;
+
+    void worker_loop(size_t worker);
+    Job* pick_job() const;
+    void run_slices(Job& job, size_t worker);
+    bool take(Job& job, size_t worker, size_t& index);
+    bool steal(Job& job, size_t worker);
+    void run_chunk(const Body& body, size_t count);
+};
+
+// ============================================================================
+// Shared Executor
+// ============================================================================
+
+/// Executor used by batch APIs called without one
+///
+/// A ThreadPoolExecutor with one worker per hardware thread, created on first
+/// use, unless set_default_executor installed another. Sharing one pool keeps
+/// the library from oversubscribing cores; callers running loops at the same
+/// time share its workers.
+std::shared_ptr<Executor> default_executor();
+
+/// Install the executor batch APIs use by default (nullptr restores the built-in pool)
+///
+/// Calls already running keep the executor they started with.
+void set_default_executor(std::shared_ptr<Executor> executor);
+
+// ============================================================================
+// Parallel Algorithms
+// ============================================================================
+
+/// Reduce map(i) for every i in [0, count) with combine
+///
+/// Each worker folds into its own partial starting from identity, then the
+/// partials are combined in worker order. identity must leave values
+/// unchanged under combine, and combine must be associative and commutative
+/// (workers take indices in no fixed order).
+///
+///     size_t findings = parallel_reduce(executor, setups.size(), size_t(0),
+///         [&](size_t i) { return Validator::validate(setups[i]).size(); },
+///         std::plus<size_t>());
+template <typename T, typename Map, typename Combine>
+T parallel_reduce(Executor& executor, size_t count, T identity, const Map& map, const Combine& combine) {
+    struct alignas(64) Partial {
+        T value;
+    };
+    std::vector<Partial> partials(executor.concurrency(), Partial{identity});
+
+    executor.parallel_for(count, [&](size_t index, size_t worker) {
+        partials[worker].value = combine(std::move(partials[worker].value), map(index));
+    });
+
+    T result = std::move(identity);
+    for (auto& partial : partials) {
+        result = combine(std::move(result), std::move(partial.value));
+    }
+    return result;
+}
+
+/// Set of tasks run together on an executor, with cancellation
+///
+/// run() queues a task and wait() runs everything queued, including tasks
+/// queued by running tasks, as parallel_for rounds on the executor. After
+/// cancel() (or once a task has thrown) queued tasks are dropped; running
+/// tasks can poll is_cancelled() to stop early. wait() rethrows the first
+/// exception a task threw. Tasks still queued when the group is destroyed
+/// never run.
+///
+///     TaskGroup group(*default_executor());
+///     for (const auto& path : paths) group.run([&, path] { index(path); });
+///     group.wait();
+class TaskGroup {
+public:
+    using Task = std::function<void()>;
+
+    explicit TaskGroup(Executor& executor) : executor_(executor) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /// Queue a task (thread-safe, also from inside a running task)
+    void run(Task task);
+
+    /// Run queued tasks until none are left
+    /// @throws the first exception thrown by a task
+    void wait();
+
+    /// Drop queued tasks and ask running ones to stop
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+
+    bool is_cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+private:
+    Executor& executor_;
+    std::mutex mutex_;
+    std::vector<Task> pending_;
+    std::atomic<bool> cancelled_{false};
+    std::exception_ptr error_;
+};
+
+} // namespace orsf
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "buffer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Bulk File I/O
+// ============================================================================
+
+/// How AsyncFileReader and AsyncFileWriter reach the kernel
+enum class IoBackend {
+    Auto,           ///< io_uring when the kernel offers it, else ThreadPool
+    IoUring,        ///< Linux io_uring: opens, reads, writes and closes batched into few syscalls
+    ThreadPool      ///< Blocking open/pread/pwrite/close on worker threads
+};
+
+/// Name of a backend ("auto", "io_uring", "thread_pool")
+const char* io_backend_name(IoBackend backend);
+
+/// Check if io_uring with the operations the file I/O layer uses is available
+bool io_uring_available();
+
+struct AsyncIoOptions {
+    IoBackend backend = IoBackend::Auto;
+    size_t queue_depth = 64;        ///< Files in flight at once
+    size_t threads = 8;             ///< Workers of the ThreadPool backend (I/O bound, so not tied to cores)
+};
+
+/// One file read by AsyncFileReader
+struct FileReadResult {
+    size_t index = 0;               ///< Position in the path list
+    std::string_view path;
+    ByteBuffer data;                ///< Whole file contents (may be moved out by the callback)
+    std::string error;              ///< Open or read failure (empty on success)
+
+    bool ok() const { return error.empty(); }
+};
+
+/// Reads many whole files with many requests in flight
+///
+/// With io_uring, every file goes through open and statx, then reads sized
+/// to the file, then close, all as queued ring requests; one io_uring_enter
+/// call submits a batch and waits for completions, so small files cost a
+/// few syscalls per batch instead of several each. The ThreadPool backend
+/// does the same with blocking calls on worker threads.
+///
+///     AsyncFileReader reader;
+///     reader.read_files(paths, [&](FileReadResult& file) {
+///         if (file.ok()) setups.push_back(parse_orsf_json(file.data.span()));
+///     });
+class AsyncFileReader {
+public:
+    /// Receives each file as soon as it is read (completion order), one call at a time
+    using Callback = std::function<void(FileReadResult& file)>;
+
+    /// @throws std::runtime_error if IoBackend::IoUring is requested but unavailable
+    explicit AsyncFileReader(AsyncIoOptions options = {});
+    ~AsyncFileReader();
+
+    AsyncFileReader(const AsyncFileReader&) = delete;
+    AsyncFileReader& operator=(const AsyncFileReader&) = delete;
+
+    /// Backend in use (never Auto)
+    IoBackend backend() const { return backend_; }
+
+    /// Read every file and wait until all callbacks returned
+    /// Per-file failures are reported through FileReadResult::error.
+    /// @throws whatever the callback threw (files in flight are finished first)
+    void read_files(const std::vector<std::string>& paths, const Callback& on_read);
+
+    /// Start no further files (safe from any thread, including the callback)
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+
+private:
+    AsyncIoOptions options_;
+    IoBackend backend_;
+    std::atomic<bool> cancelled_{false};
+};
+
+/// One file for AsyncFileWriter to create (or truncate) and fill
+struct FileWrite {
+    std::string path;
+    ByteSpan data;                  ///< Must stay valid until write_files returns
+};
+
+/// Writes many whole files with many requests in flight (see AsyncFileReader)
+class AsyncFileWriter {
+public:
+    /// Receives each write's index and error (empty on success) in completion order, one call at a time
+    using Callback = std::function<void(size_t index, const std::string& error)>;
+
+    /// @throws std::runtime_error if IoBackend::IoUring is requested but unavailable
+    explicit AsyncFileWriter(AsyncIoOptions options = {});
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    IoBackend backend() const { return backend_; }
+
+    /// Write every file (mode 0644 before umask) and wait for completion
+    /// @return Number of failed writes
+    size_t write_files(const std::vector<FileWrite>& writes, const Callback& on_written = nullptr);
+
+private:
+    AsyncIoOptions options_;
+    IoBackend backend_;
+};
+
+} // namespace orsf
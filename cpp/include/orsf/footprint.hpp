@@ -0,0 +1,54 @@
+#pragma once
+
+#include "core.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace orsf {
+
+// ============================================================================
+// Memory Footprint
+// ============================================================================
+
+/// Heap usage of one part of a setup
+struct FootprintSection {
+    uint64_t heap_bytes = 0;        ///< Bytes in heap blocks (before allocator rounding)
+    uint64_t allocations = 0;       ///< Heap blocks
+
+    FootprintSection& operator+=(const FootprintSection& other);
+};
+
+/// Memory held by one ORSF, by section
+///
+/// Heap sizes follow the containers' own bookkeeping: string and vector
+/// capacity, one node per map entry, and nlohmann::json's separately
+/// allocated object, array and string payloads. Short strings held inline
+/// (small-string optimization) cost nothing. Map node headers are
+/// estimated at four pointers, as in the common red-black tree layouts.
+struct MemoryFootprint {
+    size_t inline_bytes = sizeof(ORSF);     ///< The ORSF object itself, optionals included
+
+    FootprintSection metadata;
+    FootprintSection car;
+    FootprintSection context;
+    FootprintSection setup;                 ///< Setup subsystems except strategy
+    FootprintSection strategy;              ///< Strategy strings and custom map
+    FootprintSection compat;
+
+    /// All sections
+    FootprintSection heap() const;
+
+    /// inline_bytes plus all heap bytes
+    uint64_t total_bytes() const { return inline_bytes + heap().heap_bytes; }
+
+    /// {"inline_bytes": ..., "sections": {"metadata": {"heap_bytes": ..., "allocations": ...}, ...}}
+    json to_json() const;
+};
+
+/// Walk an ORSF and report the memory it holds
+MemoryFootprint memory_footprint(const ORSF& orsf);
+
+/// Heap held by a JSON value (not counting the value itself)
+FootprintSection memory_footprint(const json& value);
+
+} // namespace orsf
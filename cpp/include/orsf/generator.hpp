@@ -0,0 +1,67 @@
+#pragma once
+
+#include "core.hpp"
+#include "sink.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Synthetic Setup Corpus
+// ============================================================================
+
+/// Shape of a generated corpus (rates are probabilities in [0, 1])
+struct GeneratorOptions {
+    uint64_t seed = 1;
+
+    double dense_share = 0.5;           ///< Share of dense setups (the rest are sparse)
+    double dense_fill_rate = 0.95;      ///< Chance each subsystem and optional field is set in dense setups
+    double sparse_fill_rate = 0.3;      ///< Same for sparse setups
+
+    double context_rate = 0.8;          ///< Chance of a Context section
+    double strategy_rate = 0.3;         ///< Chance of a Strategy with a custom map
+    size_t max_custom_entries = 12;     ///< Strategy::custom holds 1..max entries
+    double compat_rate = 0.2;           ///< Chance of a compat section
+    size_t max_compat_bytes = 4096;     ///< Compat blobs hold roughly up to this much text
+    size_t min_gears = 4;
+    size_t max_gears = 8;
+
+    double error_rate = 0.05;           ///< Share of setups with injected Error-severity values
+    size_t max_errors = 3;              ///< Invalid setups get 1..max injected errors
+};
+
+/// Deterministic generator of synthetic ORSF setups
+///
+/// Setup i depends only on the seed and i, so corpora can be produced in
+/// any order or in parallel and regenerated exactly. Valid setups produce no
+/// Error-severity findings from Validator::validate; invalid ones (see
+/// is_invalid) produce at least one.
+class SetupGenerator {
+public:
+    explicit SetupGenerator(GeneratorOptions options = {});
+
+    const GeneratorOptions& options() const { return options_; }
+
+    /// Generate setup at index
+    ORSF generate(uint64_t index) const;
+
+    /// Generate count setups starting at index first
+    std::vector<ORSF> generate_range(uint64_t first, size_t count) const;
+
+    /// Check if setup at index has injected errors
+    bool is_invalid(uint64_t index) const;
+
+    /// Write setups as newline-delimited JSON (one compact setup per line)
+    void write_ndjson(uint64_t first, size_t count, OutputSink& sink) const;
+
+    /// Write setups as "setup_<index>.json" files
+    /// @throws std::runtime_error if the directory or a file cannot be written
+    void write_files(const std::string& directory, uint64_t first, size_t count, int indent = 2) const;
+
+private:
+    GeneratorOptions options_;
+};
+
+} // namespace orsf
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "core.hpp"
+#include "validator.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Incremental Validation
+// ============================================================================
+
+/// Independently re-runnable group of validation rules (in Validator order)
+enum class RuleGroup {
+    Schema,
+    Metadata,
+    Car,
+    Context,
+    Aero,
+    FrontLeft,
+    FrontRight,
+    RearLeft,
+    RearRight,
+    SuspensionChassis,  ///< Non-corner suspension rules (heave spring)
+    Tires,
+    Drivetrain,
+    Gearing,
+    Brakes,
+    Electronics,
+    Fuel,
+    CrossField,         ///< Cross-field rules (ambient/track temperature)
+    Count
+};
+
+/// Validator that re-runs only the rule groups affected by field edits
+///
+/// Results are identical (content and order) to Validator::validate on the
+/// current ORSF, provided every edit since the last call is reported.
+class IncrementalValidator {
+public:
+    IncrementalValidator() = default;
+
+    /// Validate everything and remember per-group results
+    const std::vector<ValidationError>& validate(const ORSF& orsf);
+
+    /// Re-run the rule groups that depend on the changed field paths
+    /// @param orsf Current (edited) ORSF
+    /// @param changed_fields Field paths (e.g. "setup.tires.pressure_fl_kpa"); a
+    ///        section path such as "setup.suspension" covers all its fields
+    const std::vector<ValidationError>& revalidate(
+        const ORSF& orsf,
+        const std::vector<std::string>& changed_fields
+    );
+
+    /// Re-run the given rule groups
+    /// @throws std::runtime_error if a group is RuleGroup::Count or out of range
+    const std::vector<ValidationError>& revalidate(
+        const ORSF& orsf,
+        const std::vector<RuleGroup>& groups
+    );
+
+    /// Get errors from the last (re)validation
+    const std::vector<ValidationError>& errors() const { return errors_; }
+
+    /// Number of rule groups run by the last call
+    size_t last_run_count() const { return last_run_count_; }
+
+    /// Rule groups that read the given field path
+    static std::vector<RuleGroup> groups_for_field(const std::string& path);
+
+    /// Forget previous results (next revalidate runs everything)
+    void reset();
+
+private:
+    static constexpr size_t GROUP_COUNT = static_cast<size_t>(RuleGroup::Count);
+
+    std::array<std::vector<ValidationError>, GROUP_COUNT> group_errors_;
+    std::vector<ValidationError> errors_;
+    bool initialized_ = false;
+    size_t last_run_count_ = 0;
+
+    static void run_group(RuleGroup group, const ORSF& orsf, std::vector<ValidationError>& errors);
+    void rebuild_errors();
+};
+
+} // namespace orsf
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <nlohmann/json.hpp>
+
+// ============================================================================
+// Instrumentation Macros
+// ============================================================================
+
+/// Stage scopes are compiled in only with ORSF_ENABLE_INSTRUMENTATION
+/// (CMake option of the same name). Without it the macros expand to
+/// nothing and their arguments are not evaluated.
+///
+///     ORSF_STAGE(stage, Parse);
+///     ORSF_STAGE_BYTES(stage, json_str.size());
+#if defined(ORSF_ENABLE_INSTRUMENTATION)
+#define ORSF_STAGE(var, stage_name) ::orsf::ScopedStage var(::orsf::Stage::stage_name)
+#define ORSF_STAGE_BYTES(var, count) var.add_bytes(static_cast<uint64_t>(count))
+#define ORSF_STAGE_ERRORS(var, count) var.add_errors(static_cast<uint64_t>(count))
+#define ORSF_STAGE_ITEM(var, item) ::orsf::ScopedItem var(static_cast<uint64_t>(item))
+#else
+#define ORSF_STAGE(var, stage_name) ((void)0)
+#define ORSF_STAGE_BYTES(var, count) ((void)0)
+#define ORSF_STAGE_ERRORS(var, count) ((void)0)
+#define ORSF_STAGE_ITEM(var, item) ((void)0)
+#endif
+
+namespace orsf {
+
+using json = nlohmann::json;
+
+// ============================================================================
+// Pipeline Stages
+// ============================================================================
+
+/// Instrumented pipeline stages
+enum class Stage : uint8_t {
+    Parse,              ///< ORSF::from_json (bytes = input size)
+    Serialize,          ///< ORSF::to_json_string (bytes = output size)
+    Validate,           ///< Validator::validate (errors = Error-severity findings)
+    Flatten,            ///< MappingEngine::flatten_orsf
+    MapToNative,        ///< MappingEngine::map_to_native, MappingPlan::to_native
+    MapToOrsf,          ///< MappingEngine::map_to_orsf, MappingPlan::to_orsf
+    LookupTable,        ///< LookupTableConverter interpolation
+    AdapterEncode,      ///< Adapter ORSF -> native calls (bytes = output size)
+    AdapterDecode,      ///< Adapter native -> ORSF calls (bytes = input size)
+    AdapterValidate     ///< Adapter::validate_orsf
+};
+
+constexpr size_t STAGE_COUNT = 10;
+
+/// Stage name ("parse", "map_to_native", ...)
+const char* stage_name(Stage stage);
+
+/// Totals for one stage
+///
+/// Times are inclusive: a stage running inside another (a lookup table
+/// inside map_to_native) counts toward both. A stage re-entered on the
+/// same thread (an adapter's orsf_to_native calling its encode_native)
+/// counts once. Calls that exit by exception count as errors.
+struct StageCounters {
+    uint64_t calls = 0;
+    uint64_t nanoseconds = 0;
+    uint64_t bytes = 0;
+    uint64_t errors = 0;
+    uint64_t allocations = 0;       ///< Reported through Instrumentation::note_allocation
+
+    StageCounters& operator+=(const StageCounters& other);
+    StageCounters& operator-=(const StageCounters& other);
+};
+
+/// Totals for all stages
+struct StageSnapshot {
+    std::array<StageCounters, STAGE_COUNT> stages{};
+
+    const StageCounters& operator[](Stage stage) const { return stages[static_cast<size_t>(stage)]; }
+    StageCounters& operator[](Stage stage) { return stages[static_cast<size_t>(stage)]; }
+
+    /// {"parse": {"calls": ..., "nanoseconds": ..., ...}, ...}
+    json to_json() const;
+};
+
+/// Item id of stage calls made outside any ScopedItem
+constexpr uint64_t NO_ITEM = UINT64_MAX;
+
+/// One completed stage call
+struct StageEvent {
+    Stage stage;
+    uint64_t item = NO_ITEM;                    ///< Setup being processed (see ScopedItem)
+    std::chrono::steady_clock::time_point start;
+    std::chrono::nanoseconds duration{0};
+    uint64_t bytes = 0;
+    uint64_t errors = 0;
+    uint64_t allocations = 0;
+};
+
+/// Receiver of individual stage calls (tracing, sampling, metrics export)
+///
+/// on_stage runs on the thread that ran the stage, right after it ends,
+/// possibly on many threads at once. It must not throw, add_sink() or
+/// remove_sink().
+class StageSink {
+public:
+    virtual ~StageSink() = default;
+    virtual void on_stage(const StageEvent& event) = 0;
+};
+
+// ============================================================================
+// Instrumentation
+// ============================================================================
+
+/// Process-wide stage counters and sinks
+///
+/// Each thread adds to its own counter block without locks or atomic
+/// read-modify-write instructions; snapshot() sums the blocks of live
+/// threads and the totals of threads that have exited.
+class Instrumentation {
+public:
+    /// Check if the library was built with ORSF_ENABLE_INSTRUMENTATION
+    static constexpr bool compiled_in() {
+#if defined(ORSF_ENABLE_INSTRUMENTATION)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /// Totals since start or the last reset()
+    static StageSnapshot snapshot();
+
+    /// Start counting from zero
+    static void reset();
+
+    /// Register sink for every stage call (no-op if already registered)
+    static void add_sink(std::shared_ptr<StageSink> sink);
+
+    /// Unregister sink
+    /// Returns once calls in flight on other threads have left every sink,
+    /// so the sink receives nothing afterwards. Must not be called from
+    /// StageSink::on_stage.
+    static void remove_sink(const std::shared_ptr<StageSink>& sink);
+
+    /// Count allocations made by the current thread
+    ///
+    /// Call from an allocation hook (such as a replacement operator new);
+    /// stages running on the thread report the difference.
+    static void note_allocation(uint64_t count = 1) noexcept;
+
+    /// Allocations noted on the current thread
+    static uint64_t thread_allocations() noexcept;
+
+    /// Item the current thread is working on (NO_ITEM outside ScopedItem)
+    static uint64_t current_item() noexcept;
+
+    /// Add a completed call (used by ScopedStage)
+    static void record(const StageEvent& event);
+};
+
+/// Times one stage call and records it when destroyed
+///
+/// Use through ORSF_STAGE so that it compiles away when instrumentation is
+/// disabled; constructing one directly always records.
+class ScopedStage {
+public:
+    explicit ScopedStage(Stage stage);
+    ~ScopedStage();
+
+    ScopedStage(const ScopedStage&) = delete;
+    ScopedStage& operator=(const ScopedStage&) = delete;
+
+    void add_bytes(uint64_t count) { bytes_ += count; }
+    void add_errors(uint64_t count) { errors_ += count; }
+
+private:
+    Stage stage_;
+    bool active_;               ///< False when the stage is already running on this thread
+    int exceptions_;
+    uint64_t bytes_ = 0;
+    uint64_t errors_ = 0;
+    uint64_t allocations_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/// Tags stage calls made on this thread with an item id (such as the
+/// setup index in a batch) until destroyed; restores the previous id
+///
+/// Use through ORSF_STAGE_ITEM so that it compiles away when
+/// instrumentation is disabled.
+class ScopedItem {
+public:
+    explicit ScopedItem(uint64_t item) noexcept;
+    ~ScopedItem();
+
+    ScopedItem(const ScopedItem&) = delete;
+    ScopedItem& operator=(const ScopedItem&) = delete;
+
+private:
+    uint64_t previous_;
+};
+
+} // namespace orsf
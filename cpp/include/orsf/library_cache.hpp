@@ -0,0 +1,132 @@
+#pragma once
+
+#include "core.hpp"
+#include "buffer.hpp"
+#include "executor.hpp"
+#include "file_io.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Setup Library Cache
+// ============================================================================
+
+/// Fields shown when listing a setup library
+struct SetupListing {
+    std::string id;
+    std::string name;
+    std::string car;                    ///< "make model"
+    std::string track;                  ///< Empty when the setup has no context.track
+    std::vector<std::string> tags;
+    std::string created_at;
+
+    static SetupListing from_setup(const ORSF& setup);
+
+    bool operator==(const SetupListing& other) const;
+};
+
+/// One setup file as last seen by a LibraryCache
+struct LibraryCacheEntry {
+    std::string path;
+    int64_t mtime_ns = 0;               ///< Modification time (ns since epoch)
+    uint64_t size = 0;                  ///< File size in bytes
+    uint64_t hash = 0;                  ///< content_hash of the parsed setup (0 if it failed)
+    std::string error;                  ///< Read or parse failure (failed files are cached too)
+    SetupListing listing;
+    ByteSpan encoded;                   ///< Setup as CBOR (empty if it failed)
+    std::shared_ptr<const void> storage;///< Keeps encoded alive (the loaded cache file or own bytes)
+
+    bool ok() const { return error.empty(); }
+
+    /// Decode the full setup from the cached binary form (no JSON text parsing)
+    /// @throws std::runtime_error if the entry failed or its bytes are corrupt
+    ORSF setup() const;
+};
+
+/// What LibraryCache::refresh did
+struct LibraryRefreshStats {
+    size_t files = 0;                   ///< Paths given
+    size_t reused = 0;                  ///< Unchanged (stat matched the cache)
+    size_t parsed = 0;                  ///< New or changed, read and parsed
+    size_t failed = 0;                  ///< Read or parse failures among parsed
+    size_t missing = 0;                 ///< Paths that could not be stat'ed (not listed)
+    size_t removed = 0;                 ///< Cached entries dropped (path not given or gone)
+    std::chrono::nanoseconds elapsed{0};
+
+    json to_json() const;
+};
+
+/// Persistent cache of parsed setups for fast library startup
+///
+/// Stores every file's path, mtime, size and content hash with its listing
+/// fields and the setup in a binary form (CBOR), in one cache file. On
+/// startup, load() maps the cache file and refresh() stats every path:
+/// files whose mtime and size match are taken from the cache as they are,
+/// only new or changed files are read (through AsyncFileReader) and parsed.
+/// A warm start costs one stat per file plus reading the cache file.
+///
+/// Files modified less than two seconds before they were parsed are parsed
+/// again on the next refresh, since a second write within the filesystem's
+/// timestamp granularity may leave mtime and size unchanged.
+///
+///     LibraryCache cache(app_dir + "/library.orsfcache");
+///     cache.load();                               // false on first run
+///     cache.refresh(setup_paths);
+///     for (const auto& entry : cache.entries()) show(entry.listing);
+///     cache.save();
+class LibraryCache {
+public:
+    /// Leading bytes of cache files
+    static constexpr const char* MAGIC = "ORSFLIB1";
+
+    explicit LibraryCache(std::string cache_path, AsyncIoOptions io = {});
+
+    LibraryCache(const LibraryCache&) = delete;
+    LibraryCache& operator=(const LibraryCache&) = delete;
+
+    const std::string& cache_path() const { return cache_path_; }
+
+    /// Replace the entries with the cache file's
+    /// @return false (cache left empty) if the file is missing, corrupt or
+    ///         written by another cache format version
+    bool load();
+
+    /// Bring the entries in line with paths, in paths order
+    ///
+    /// Unchanged files are reused, new and changed ones parsed on the
+    /// executor, and entries for paths not given (or no longer on disk)
+    /// dropped.
+    LibraryRefreshStats refresh(const std::vector<std::string>& paths, Executor& executor);
+
+    /// Refresh on default_executor()
+    LibraryRefreshStats refresh(const std::vector<std::string>& paths);
+
+    /// Write the cache file (to a temporary file, then renamed over it)
+    /// @throws std::runtime_error if the file cannot be written
+    void save() const;
+
+    const std::vector<LibraryCacheEntry>& entries() const { return entries_; }
+
+    /// Entry for path, or nullptr
+    const LibraryCacheEntry* find(const std::string& path) const;
+
+    void clear();
+
+private:
+    std::string cache_path_;
+    AsyncIoOptions io_;
+    std::vector<LibraryCacheEntry> entries_;
+    std::unordered_map<std::string, size_t> index_;    ///< path -> position in entries_
+    int64_t trusted_before_ns_ = 0;     ///< Entries with an older mtime were read after their last write
+
+    void rebuild_index();
+};
+
+} // namespace orsf
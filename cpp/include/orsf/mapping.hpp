@@ -40,6 +40,47 @@ struct FieldMapping {
 /// Flat key-value representation (for native formats)
 using FlatSetup = std::map<std::string, double>;
 
+/// Direct accessor for a numeric ORSF field (no path parsing at call time)
+using FieldGetter = std::optional<double> (*)(const ORSF&);
+
+/// Values of every numeric ORSF field, indexed like numeric_field_paths()
+using FieldValues = std::vector<std::optional<double>>;
+
+/// Field mappings compiled for repeated use
+///
+/// Paths are resolved to direct accessors (or numeric field indices) once,
+/// so applying the plan does no path parsing and no mapping copies.
+class MappingPlan {
+public:
+    explicit MappingPlan(std::vector<FieldMapping> mappings);
+
+    /// Apply mappings to convert ORSF to native format (as MappingEngine::map_to_native)
+    FlatSetup to_native(const ORSF& orsf) const;
+
+    /// Apply mappings to pre-extracted field values (see MappingEngine::extract_fields)
+    /// @param orsf Setup the values were extracted from (for fields without an index)
+    FlatSetup to_native(const ORSF& orsf, const FieldValues& values) const;
+
+    /// Apply mappings to convert native format to ORSF (as MappingEngine::map_to_orsf)
+    ORSF to_orsf(const FlatSetup& native, const ORSF& template_orsf) const;
+
+    const std::vector<FieldMapping>& mappings() const { return mappings_; }
+
+private:
+    static constexpr size_t NO_FIELD = static_cast<size_t>(-1);
+
+    struct Step {
+        FieldGetter getter;     ///< nullptr: fall back to MappingEngine::get_value
+        size_t field_index;     ///< Index into FieldValues or NO_FIELD
+    };
+
+    std::vector<FieldMapping> mappings_;
+    std::vector<Step> steps_;   ///< Parallel to mappings_
+
+    std::optional<double> read(const ORSF& orsf, size_t i) const;
+    void emit(FlatSetup& native, size_t i, std::optional<double> value) const;
+};
+
 /// Mapping engine for ORSF <-> Native conversions
 class MappingEngine {
 public:
@@ -62,12 +103,27 @@ public:
         const ORSF& template_orsf
     );
 
-    /// Get value from ORSF by path
+    /// Get value from ORSF by path (any path in numeric_field_paths())
     static std::optional<double> get_value(const ORSF& orsf, const std::string& path);
 
-    /// Set value in ORSF by path
+    /// Set value in ORSF by path (any path in numeric_field_paths(); others
+    /// are ignored). Missing sections are created; integer fields are rounded.
     static void set_value(ORSF& orsf, const std::string& path, double value);
 
+    /// Resolve a numeric field path to a direct accessor
+    /// @return Accessor or nullptr if the path is not a known numeric field
+    static FieldGetter find_getter(const std::string& path);
+
+    /// Get all numeric field paths known to find_getter()
+    static const std::vector<std::string>& numeric_field_paths();
+
+    /// Get index of a numeric field path in numeric_field_paths()
+    /// @return Index or nullopt if the path is not a known numeric field
+    static std::optional<size_t> numeric_field_index(const std::string& path);
+
+    /// Read every numeric field of a setup in one pass
+    static FieldValues extract_fields(const ORSF& orsf);
+
 private:
     // Helper to split path into components
     static std::vector<std::string> split_path(const std::string& path);
@@ -22,6 +22,72 @@
 // Adapter system
 #include "adapter.hpp"
 
+// Columnar store and vectorized validation
+#include "columnar.hpp"
+
+// Incremental revalidation
+#include "incremental.hpp"
+
+// Validation profiles
+#include "profile.hpp"
+
+// Streaming validation from raw JSON
+#include "streaming.hpp"
+
+// Content hashing and result caching
+#include "cache.hpp"
+
+// Zero-copy byte views and buffers
+#include "buffer.hpp"
+
+// Native format signatures and detection
+#include "detect.hpp"
+
+// Output sinks and buffered text writing
+#include "sink.hpp"
+
+// Executors for batch work
+#include "executor.hpp"
+
+// Lock-free publication of immutable values
+#include "epoch.hpp"
+
+// Batch conversion
+#include "batch.hpp"
+
+// Direct sim-to-sim transcoding
+#include "transcode.hpp"
+
+// Data-driven adapters from mapping specs
+#include "spec.hpp"
+
+// Lazily loaded adapter plugins
+#include "plugin.hpp"
+
+// Synthetic setup corpora
+#include "generator.hpp"
+
+// Pipeline stage instrumentation
+#include "instrument.hpp"
+
+// Chrome trace-event export
+#include "trace.hpp"
+
+// Per-section memory footprint
+#include "footprint.hpp"
+
+// Setup archives
+#include "archive.hpp"
+
+// Staged import pipeline
+#include "pipeline.hpp"
+
+// Bulk file I/O
+#include "file_io.hpp"
+
+// Persistent setup library cache
+#include "library_cache.hpp"
+
 /// Main ORSF namespace
 namespace orsf {
 
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "core.hpp"
+#include "adapter.hpp"
+#include "buffer.hpp"
+#include "executor.hpp"
+#include "file_io.hpp"
+#include "validator.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Bounded MPMC Queue
+// ============================================================================
+
+/// Fixed-capacity lock-free queue for any number of producers and consumers
+///
+/// Each cell carries a sequence number that tells producers and consumers
+/// whose turn it is (Vyukov's bounded MPMC queue), so push and pop are one
+/// CAS on the shared position plus one release store on the cell. Neither
+/// call blocks: a full queue fails try_push, an empty one fails try_pop.
+template <typename T>
+class BoundedQueue {
+public:
+    /// @param capacity Rounded up to a power of two (at least 2)
+    explicit BoundedQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size *= 2;
+        mask_ = size - 1;
+        cells_.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /// Move value into the queue; false (value untouched) if the queue is full
+    bool try_push(T& value) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Move the oldest value out; false if the queue is empty
+    bool try_pop(T& value) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+    /// Approximate number of queued values (exact when no call is in flight)
+    size_t size_approx() const {
+        size_t head = dequeue_pos_.load(std::memory_order_relaxed);
+        size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<size_t> dequeue_pos_{0};
+};
+
+// ============================================================================
+// Import Pipeline
+// ============================================================================
+
+/// One file moving through an import pipeline
+struct ImportItem {
+    uint64_t index = 0;                 ///< Position in the input list
+    std::string source;                 ///< File path
+    ByteSpan data;                      ///< File contents (mapped or read; empty after parsing)
+    std::shared_ptr<const void> storage;///< Keeps data alive; released after parsing
+    ORSF setup;                         ///< Parsed setup (after the parse stage)
+    std::vector<ValidationError> findings;  ///< Validator output (empty when validation is off)
+    std::string error;                  ///< Read, parse or transform failure (later stages skip the item)
+    uint64_t bytes = 0;                 ///< File size
+
+    bool ok() const { return error.empty(); }
+
+    /// True if validation found an Error-severity problem
+    bool invalid() const;
+};
+
+/// Stage configuration of an ImportPipeline
+///
+/// The parse, validate, transform and sink workers together are capped at
+/// default_executor()->concurrency() (one per stage at least); stages with a
+/// worker count of 0 share what the others leave, and if the explicit counts
+/// exceed the cap the widest stage gives up workers first. Read workers mostly
+/// block on I/O and are not counted (0 means default_executor()->concurrency()).
+/// A full queue stalls the stage feeding it (backpressure), so at most about
+/// queue_capacity items wait between any two stages however fast the
+/// readers are.
+struct ImportOptions {
+    size_t queue_capacity = 64;         ///< Items buffered between two stages
+    size_t read_workers = 1;
+    size_t parse_workers = 0;
+    size_t validate_workers = 1;
+    size_t transform_workers = 1;
+    size_t sink_workers = 1;
+
+    bool use_mmap = true;               ///< Map files instead of reading them (POSIX)
+    bool async_io = false;              ///< Read through one AsyncFileReader instead (read_workers and use_mmap unused)
+    AsyncIoOptions io;                  ///< Reader settings when async_io is set
+    bool validate = true;
+
+    /// Decode files with this adapter's decode_native (default: ORSF JSON)
+    std::shared_ptr<Adapter> adapter;
+
+    /// Optional per-item step after validation (normalize units, build index
+    /// entries, ...). Runs concurrently on transform_workers threads;
+    /// throwing marks the item failed.
+    std::function<void(ImportItem&)> transform;
+
+    /// Receives every item, failed ones included, in completion order (use
+    /// ImportItem::index to restore input order). Runs on sink_workers
+    /// threads; throwing cancels the pipeline and run() rethrows.
+    std::function<void(ImportItem&)> sink;
+};
+
+/// Time and throughput of one pipeline stage
+struct ImportStageStats {
+    std::string name;                   ///< read, parse, validate, transform or sink
+    size_t workers = 0;
+    uint64_t items = 0;
+    std::chrono::nanoseconds busy{0};   ///< Processing items (all workers)
+    std::chrono::nanoseconds starved{0};///< Waiting for the previous stage
+    std::chrono::nanoseconds blocked{0};///< Waiting for room in the next stage's queue
+
+    /// Share of the stage's worker time spent processing (0..1)
+    double utilization(std::chrono::nanoseconds elapsed) const;
+};
+
+/// Outcome of ImportPipeline::run
+struct ImportStats {
+    std::vector<ImportStageStats> stages;   ///< In pipeline order
+    uint64_t items = 0;                     ///< Items that reached the sink
+    uint64_t failed = 0;                    ///< Items with an error
+    uint64_t invalid = 0;                   ///< Items with Error-severity findings
+    uint64_t bytes = 0;                     ///< Bytes read
+    bool cancelled = false;
+    std::chrono::nanoseconds elapsed{0};
+
+    /// {"elapsed_ms": ..., "items": ..., "stages": [{"name": ..., "utilization": ...}, ...]}
+    json to_json() const;
+};
+
+/// Imports files through read, parse, validate, transform and sink stages
+///
+/// Every stage runs on its own worker threads (sized against the shared
+/// executor, see ImportOptions) and hands items to the next
+/// through a BoundedQueue, so disk reads, parsing and validation of
+/// different files overlap. Per-item failures travel with the item; only a
+/// throwing sink or cancel() stops the run.
+///
+///     ImportOptions options;
+///     options.sink = [&](ImportItem& item) { if (item.ok()) store(item.setup); };
+///     ImportStats stats = ImportPipeline(options).run(paths);
+class ImportPipeline {
+public:
+    /// @throws std::runtime_error if options.sink is not set
+    explicit ImportPipeline(ImportOptions options);
+
+    ImportPipeline(const ImportPipeline&) = delete;
+    ImportPipeline& operator=(const ImportPipeline&) = delete;
+
+    /// Import files and wait until every item reached the sink or the run was cancelled
+    /// @throws whatever the sink threw; std::runtime_error if the async_io reader fails
+    ImportStats run(const std::vector<std::string>& paths);
+
+    /// Stop the current run: stages finish their current item, queued items
+    /// are dropped and run() returns with cancelled set. Safe from any thread,
+    /// including sink and transform callbacks.
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+
+    bool cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+private:
+    ImportOptions options_;
+    std::atomic<bool> cancelled_{false};
+};
+
+} // namespace orsf
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "core.hpp"
+#include "adapter.hpp"
+#include "detect.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Plugin C ABI
+// ============================================================================
+
+/// Version of the plugin entry table layout
+#define ORSF_PLUGIN_ABI_VERSION 1u
+
+/// Name of the symbol every plugin exports
+#define ORSF_PLUGIN_ENTRY_SYMBOL "orsf_plugin_entry"
+
+extern "C" {
+
+/// Entry table returned by a plugin's orsf_plugin_entry()
+///
+/// Adapters are C++ objects, so plugins must be built against the same ORSF
+/// headers and C++ runtime as the host; abi_version guards the table layout.
+/// Neither function may throw.
+struct orsf_plugin_api {
+    uint32_t abi_version;       ///< ORSF_PLUGIN_ABI_VERSION the plugin was built with
+
+    /// Create the adapter for a manifest entry (nullptr if unknown)
+    orsf::Adapter* (*create_adapter)(const char* id, const char* version, const char* car_key);
+
+    /// Destroy an adapter returned by create_adapter
+    void (*destroy_adapter)(orsf::Adapter* adapter);
+};
+
+typedef const orsf_plugin_api* (*orsf_plugin_entry_fn)(void);
+
+}
+
+/// Define the entry point of a plugin shared object
+///
+/// create_function has the signature of orsf_plugin_api::create_adapter and
+/// returns a new adapter (or nullptr); exceptions are turned into nullptr.
+#define ORSF_PLUGIN(create_function)                                                             \
+    extern "C" __attribute__((visibility("default"))) const orsf_plugin_api* orsf_plugin_entry() { \
+        static const orsf_plugin_api api = {                                                     \
+            ORSF_PLUGIN_ABI_VERSION,                                                             \
+            [](const char* id, const char* version, const char* car_key) -> ::orsf::Adapter* {  \
+                try {                                                                            \
+                    return create_function(id, version, car_key);                               \
+                } catch (...) {                                                                  \
+                    return nullptr;                                                              \
+                }                                                                                \
+            },                                                                                   \
+            [](::orsf::Adapter* adapter) { delete adapter; }                                     \
+        };                                                                                       \
+        return &api;                                                                             \
+    }
+
+namespace orsf {
+
+// ============================================================================
+// Plugin Manifests
+// ============================================================================
+
+/// Adapter identities served by a plugin, declared without loading it
+struct PluginAdapterEntry {
+    std::string id;
+    std::string version;
+    std::vector<std::string> car_keys;
+    std::string description;
+    std::string file_extension;         ///< For AdapterRegistry::detect() before loading
+    std::vector<FormatSignature> signatures;
+};
+
+/// Manifest describing one plugin shared object
+///
+/// Stored as "<name>.orsf-plugin.json" next to the library:
+///
+///     {
+///         "format": "orsf-plugin/v1",
+///         "name": "acme",
+///         "library": "libacme_adapters.so",
+///         "adapters": [{"id": "acme", "version": "1.0", "car_keys": ["gt3", "gt4"]}]
+///     }
+struct PluginManifest {
+    /// Format tag of manifests
+    static constexpr const char* FORMAT = "orsf-plugin/v1";
+
+    /// File name suffix of manifests
+    static constexpr const char* SUFFIX = ".orsf-plugin.json";
+
+    std::string name;
+    std::string library;                ///< Absolute path of the shared object
+    std::vector<PluginAdapterEntry> adapters;
+
+    /// Parse manifest
+    /// @param directory Directory relative library paths are resolved against
+    /// @throws std::runtime_error if the manifest is malformed
+    static PluginManifest from_json(const json& j, const std::string& directory);
+};
+
+// ============================================================================
+// Plugins
+// ============================================================================
+
+/// Load-time accounting for one plugin
+struct PluginStats {
+    std::string name;
+    std::string library;
+    bool loaded = false;
+    std::chrono::nanoseconds load_time{0};  ///< dlopen and entry point lookup
+    int64_t resident_bytes = 0;             ///< Change in resident memory across the load (approximate)
+    std::string error;                      ///< Load error (empty if none)
+};
+
+/// Startup and load accounting for all plugins of a registry
+struct PluginReport {
+    std::chrono::nanoseconds index_time{0};    ///< Reading and indexing manifests
+    std::vector<PluginStats> plugins;
+
+    size_t loaded_count() const;
+    std::chrono::nanoseconds total_load_time() const;
+    int64_t total_resident_bytes() const;
+};
+
+/// Shared object providing adapters, opened on first use
+///
+/// load() opens the library and looks up its entry table exactly once,
+/// even when called from many threads. A failed load is remembered and
+/// rethrown by later calls. The library is closed when the last Plugin
+/// reference (held by every adapter it created) goes away.
+class Plugin : public std::enable_shared_from_this<Plugin> {
+public:
+    explicit Plugin(PluginManifest manifest);
+    ~Plugin();
+
+    Plugin(const Plugin&) = delete;
+    Plugin& operator=(const Plugin&) = delete;
+
+    const PluginManifest& manifest() const { return manifest_; }
+
+    bool is_loaded() const { return api_.load(std::memory_order_acquire) != nullptr; }
+
+    /// Open the library (no-op once loaded)
+    /// @throws std::runtime_error if the library or its entry point is unusable
+    void load();
+
+    /// Create an adapter, loading the library first
+    /// @throws std::runtime_error if loading fails or the plugin has no such adapter
+    std::shared_ptr<Adapter> create(const std::string& id, const std::string& version, const std::string& car_key);
+
+    PluginStats stats() const;
+
+private:
+    PluginManifest manifest_;
+    mutable std::mutex mutex_;
+    std::atomic<const orsf_plugin_api*> api_{nullptr};
+    void* handle_ = nullptr;
+    std::string error_;
+    std::chrono::nanoseconds load_time_{0};
+    int64_t resident_bytes_ = 0;
+};
+
+/// Adapter standing in for a plugin adapter until it is needed
+///
+/// Identity, file extension and signatures come from the manifest, so
+/// indexing, resolving and format detection work without opening the
+/// library: sniff() accepts any head while the manifest declares
+/// signatures and the plugin is not loaded yet, and only asks the real
+/// adapter for adapters without manifest signatures (loading the plugin)
+/// or once it is loaded. Everything else loads the plugin (once) and
+/// forwards to the real adapter. Rule programs from the registry are forwarded; a profile
+/// returned by the plugin adapter itself is not consulted (use
+/// AdapterRegistry::register_adapter_profile).
+class PluginAdapter : public BaseAdapter {
+public:
+    PluginAdapter(std::shared_ptr<Plugin> plugin, const PluginAdapterEntry& entry, const std::string& car_key);
+
+    /// Check if the real adapter has been created
+    bool is_loaded() const { return target_ptr_.load(std::memory_order_acquire) != nullptr; }
+
+    /// Load the plugin and create the real adapter (no-op once loaded)
+    /// @throws std::runtime_error if loading fails
+    const Adapter& target() const;
+
+    const std::shared_ptr<Plugin>& plugin() const { return plugin_; }
+
+    std::vector<uint8_t> orsf_to_native(const ORSF& orsf) const override;
+    ORSF native_to_orsf(const std::vector<uint8_t>& data) const override;
+    ORSF decode_native(ByteSpan data) const override;
+    void encode_native(const ORSF& orsf, ByteBuffer& out) const override;
+    void encode_extracted(const ORSF& orsf, const FieldValues& values, ByteBuffer& out) const override;
+    void write_native(const ORSF& orsf, OutputSink& sink) const override;
+    std::vector<ValidationError> validate_orsf(const ORSF& orsf) const override;
+    std::string get_suggested_filename() const override;
+    std::string get_file_extension() const override { return file_extension_; }
+    std::vector<FormatSignature> get_signatures() const override { return signatures_; }
+    bool sniff(ByteSpan head) const override;
+    std::optional<std::string> get_install_path() const override;
+    std::vector<FieldMapping> get_field_mappings() const override;
+    void set_rule_program(std::shared_ptr<const RuleProgram> program) override;
+
+private:
+    std::shared_ptr<Plugin> plugin_;
+    std::string file_extension_;
+    std::vector<FormatSignature> signatures_;
+
+    mutable std::mutex mutex_;
+    mutable std::shared_ptr<Adapter> target_;
+    mutable std::atomic<const Adapter*> target_ptr_{nullptr};
+};
+
+/// Manifests of a plugin directory and the lazy adapters they declare
+struct PluginIndex {
+    std::vector<std::shared_ptr<Plugin>> plugins;
+    std::vector<std::shared_ptr<Adapter>> adapters;     ///< One PluginAdapter per (id, version, car key)
+    std::chrono::nanoseconds index_time{0};
+
+    /// Read every "*.orsf-plugin.json" manifest in a directory (no library is opened)
+    /// @throws std::runtime_error if the directory or a manifest cannot be read
+    static PluginIndex scan(const std::string& directory);
+};
+
+} // namespace orsf
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "core.hpp"
+#include "validator.hpp"
+#include "columnar.hpp"
+#include "mapping.hpp"
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Validation Profiles
+// ============================================================================
+
+/// Custom validation rule appended by a profile
+using ProfileRule = std::function<void(const ORSF&, std::vector<ValidationError>&)>;
+
+/// Range overrides and extra rules layered on the standard validator
+struct ValidationProfile {
+    /// Replace every standard range rule on the same field
+    std::vector<ColumnRule> overrides;
+
+    /// Additional rules run after the standard validator
+    std::vector<ProfileRule> extra_rules;
+};
+
+/// Immutable validation program compiled from profiles
+///
+/// Compiled once (at adapter registration) from the standard rules, the
+/// adapter's profile and the per-car-class profiles into one flat
+/// instruction list per car_class, with overrides in place of the standard
+/// rules they replace. Validating a setup selects the list for its car_class
+/// with one hash lookup, then runs it in one loop; without overrides the
+/// errors match Validator::validate in content and order.
+class RuleProgram {
+public:
+    /// Compile program
+    /// @param class_profiles Profiles keyed by car_class
+    /// @param adapter_profile Adapter profile (applied after, wins on conflicts)
+    /// @throws std::runtime_error if an override names an unknown numeric field
+    static std::shared_ptr<const RuleProgram> compile(
+        const std::map<std::string, ValidationProfile>& class_profiles,
+        const ValidationProfile* adapter_profile
+    );
+
+    /// Validate ORSF with the compiled rules
+    std::vector<ValidationError> validate(const ORSF& orsf) const;
+
+    /// Check if a car class has a compiled profile
+    bool has_class(const std::string& car_class) const;
+
+private:
+    /// Standard check other than a numeric range
+    using Check = void (*)(const ORSF&, std::vector<ValidationError>&);
+
+    enum class Op {
+        Range,      ///< rule.check_value(getter(orsf)) when the field is present
+        Check,      ///< check(orsf); rule.field names the field it covers, if any
+        Extra       ///< Profile extra rule
+    };
+
+    struct Instruction {
+        Op op;
+        FieldGetter getter = nullptr;
+        ColumnRule rule{};
+        Check check = nullptr;
+        ProfileRule extra{};
+    };
+
+    using Program = std::vector<Instruction>;
+
+    Program default_program_;
+    std::unordered_map<std::string, Program> class_programs_;
+
+    static Program standard_program(bool known_class);
+    static Program build(const std::vector<const ValidationProfile*>& layers, bool known_class);
+    static void run(const Program& program, const ORSF& orsf, std::vector<ValidationError>& errors);
+};
+
+} // namespace orsf
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "buffer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace orsf {
+
+// ============================================================================
+// Output Sinks
+// ============================================================================
+
+/// Destination for streamed native output
+///
+/// Adapters write through a sink so output can go straight to a file,
+/// pipe or socket without materializing the whole native file first.
+class OutputSink {
+public:
+    virtual ~OutputSink() = default;
+
+    /// Write all bytes
+    /// @throws std::runtime_error if the bytes cannot be written
+    virtual void write(const void* data, size_t size) = 0;
+
+    /// Push buffered bytes to the destination (no-op by default)
+    virtual void flush() {}
+
+    void write(std::string_view text) { write(text.data(), text.size()); }
+    void write(ByteSpan bytes) { write(bytes.data(), bytes.size()); }
+};
+
+/// Sink writing to a file descriptor (file, pipe or socket)
+/// Retries partial writes and EINTR; does not own or close the descriptor.
+class FdSink : public OutputSink {
+public:
+    explicit FdSink(int fd) : fd_(fd) {}
+
+    void write(const void* data, size_t size) override;
+    using OutputSink::write;
+
+private:
+    int fd_;
+};
+
+/// Sink appending to a std::string
+class StringSink : public OutputSink {
+public:
+    explicit StringSink(std::string& out) : out_(out) {}
+
+    void write(const void* data, size_t size) override {
+        out_.append(static_cast<const char*>(data), size);
+    }
+    using OutputSink::write;
+
+private:
+    std::string& out_;
+};
+
+/// Sink appending to a ByteBuffer
+class ByteBufferSink : public OutputSink {
+public:
+    explicit ByteBufferSink(ByteBuffer& out) : out_(out) {}
+
+    void write(const void* data, size_t size) override { out_.append(data, size); }
+    using OutputSink::write;
+
+private:
+    ByteBuffer& out_;
+};
+
+/// Sink filling a caller-provided fixed-size buffer
+class FixedBufferSink : public OutputSink {
+public:
+    FixedBufferSink(void* buffer, size_t capacity)
+        : buffer_(static_cast<uint8_t*>(buffer)), capacity_(capacity) {}
+
+    /// @throws std::runtime_error if the buffer would overflow (nothing is written)
+    void write(const void* data, size_t size) override;
+    using OutputSink::write;
+
+    /// Bytes written so far
+    size_t size() const { return size_; }
+
+    ByteSpan span() const { return ByteSpan(buffer_, size_); }
+
+private:
+    uint8_t* buffer_;
+    size_t capacity_;
+    size_t size_ = 0;
+};
+
+/// Sink handing each chunk to a callback (e.g. a network send or compressor)
+class CallbackSink : public OutputSink {
+public:
+    using Callback = std::function<void(const uint8_t* data, size_t size)>;
+
+    explicit CallbackSink(Callback callback) : callback_(std::move(callback)) {}
+
+    void write(const void* data, size_t size) override {
+        if (size > 0) callback_(static_cast<const uint8_t*>(data), size);
+    }
+    using OutputSink::write;
+
+private:
+    Callback callback_;
+};
+
+// ============================================================================
+// Buffered Text Writer
+// ============================================================================
+
+/// Buffered text formatter over an OutputSink
+///
+/// Collects small writes in a fixed internal buffer and forwards them in
+/// chunks. Numbers are formatted with std::to_chars (locale-independent,
+/// shortest round-trip form for doubles). Call flush() when done; the
+/// destructor flushes too but cannot report errors.
+class TextWriter {
+public:
+    static constexpr size_t BUFFER_SIZE = 8192;
+
+    explicit TextWriter(OutputSink& sink) : sink_(sink) {}
+    ~TextWriter();
+
+    TextWriter(const TextWriter&) = delete;
+    TextWriter& operator=(const TextWriter&) = delete;
+
+    TextWriter& write(std::string_view text);
+    TextWriter& put(char c);
+    TextWriter& number(double value);
+    TextWriter& number(int64_t value);
+    TextWriter& number(int value) { return number(static_cast<int64_t>(value)); }
+
+    /// Write "key=value\n"
+    TextWriter& key_value(std::string_view key, double value);
+    TextWriter& key_value(std::string_view key, int64_t value);
+    TextWriter& key_value(std::string_view key, int value) { return key_value(key, static_cast<int64_t>(value)); }
+    TextWriter& key_value(std::string_view key, std::string_view value);
+
+    /// Write "[name]\n"
+    TextWriter& section(std::string_view name);
+
+    /// Forward buffered text to the sink and flush it
+    void flush();
+
+private:
+    OutputSink& sink_;
+    char buffer_[BUFFER_SIZE];
+    size_t used_ = 0;
+
+    void drain();
+};
+
+/// Serialize ORSF as JSON straight into a sink (buffered, no whole-file copy)
+/// @param indent Indentation (-1 for compact), as ORSF::to_json_string
+void write_orsf_json(const ORSF& orsf, OutputSink& sink, int indent = -1);
+
+} // namespace orsf
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "core.hpp"
+#include "utils.hpp"
+#include "mapping.hpp"
+#include "adapter.hpp"
+#include "buffer.hpp"
+#include "detect.hpp"
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Adapter Mapping Specs
+// ============================================================================
+
+/// Transform operations available to mapping specs
+enum class TransformOp : uint8_t {
+    Scale,              ///< x * a
+    Offset,             ///< x + a
+    Linear,             ///< x * a + b
+    Invert,             ///< 1 / x
+    Negate,             ///< -x
+    Clamp,              ///< Clamp to [a, b]
+    PercentToRatio,     ///< x / 100
+    RatioToPercent,     ///< x * 100
+    UnitConvert,        ///< from_unit -> to_unit
+    Lookup,             ///< Interpolate table
+    ReverseLookup,      ///< Reverse-interpolate table
+    RoundToStep         ///< Round to multiple of a
+};
+
+/// One step of a transform chain
+struct TransformStep {
+    TransformOp op = TransformOp::Scale;
+    double a = 0.0;                     ///< First operand (factor, amount, min or step)
+    double b = 0.0;                     ///< Second operand (offset or max)
+    Unit from_unit = Unit::KPA;         ///< UnitConvert only
+    Unit to_unit = Unit::KPA;           ///< UnitConvert only
+    std::vector<LUTEntry> table;        ///< Lookup and ReverseLookup only
+
+    /// Build the transform this step performs
+    TransformFunc compile() const;
+
+    bool operator==(const TransformStep& other) const;
+};
+
+/// Mapping of one ORSF field to one native key
+struct FieldSpec {
+    std::string orsf_path;              ///< Numeric ORSF field path
+    std::string native_key;             ///< Key in the native file (unique within a spec)
+    std::string section;                ///< Text layout section (empty = before any section)
+    bool required = false;
+    std::vector<TransformStep> to_native;   ///< Applied in order (empty = unchanged)
+    std::vector<TransformStep> to_orsf;     ///< Applied in order (empty = unchanged)
+
+    bool operator==(const FieldSpec& other) const;
+};
+
+/// Text layout of a spec adapter's native files
+///
+/// Files are "key<separator>value" lines, grouped under "[section]" lines
+/// for fields with a section. Header lines are written verbatim first.
+/// Reading skips blank lines, section lines, lines starting with '#' or
+/// ';' and lines without the separator.
+struct TextLayout {
+    std::string separator = "=";
+    std::vector<std::string> header;
+
+    bool operator==(const TextLayout& other) const;
+};
+
+/// Data-driven adapter definition
+///
+/// Loaded from JSON (human-edited) or from the precompiled binary form,
+/// which stores the same content without any text parsing and holds any
+/// number of specs in one blob.
+struct MappingSpec {
+    /// Format tag of JSON specs
+    static constexpr const char* JSON_FORMAT = "orsf-adapter-spec/v1";
+
+    /// Leading bytes of binary spec bundles
+    static constexpr const char* BINARY_MAGIC = "ORSFSPC1";
+
+    Adapter::Metadata metadata;         ///< id, version and car_key are required
+    std::string file_extension;
+    std::string suggested_filename;
+    std::vector<FormatSignature> signatures;
+    TextLayout layout;
+    std::vector<FieldSpec> fields;
+
+    /// Parse spec from JSON object
+    /// @throws std::runtime_error if the spec is malformed or invalid
+    static MappingSpec from_json(const json& j);
+
+    /// Parse spec from JSON string
+    /// @throws std::runtime_error if the spec is malformed or invalid
+    static MappingSpec from_json(const std::string& json_str);
+
+    /// Convert spec to JSON object
+    json to_json() const;
+
+    /// Append specs in the binary form to out
+    static void encode_binary(const std::vector<MappingSpec>& specs, ByteBuffer& out);
+
+    /// Read specs from the binary form
+    /// @throws std::runtime_error if the data is truncated or invalid
+    static std::vector<MappingSpec> decode_binary(ByteSpan data);
+
+    /// Check that paths are known numeric fields, native keys are unique,
+    /// unit conversions stay within one quantity and clamps have min <= max
+    /// @throws std::runtime_error on the first problem found
+    void validate() const;
+
+    /// Build the field mappings described by the spec
+    std::vector<FieldMapping> compile_mappings() const;
+
+    bool operator==(const MappingSpec& other) const;
+};
+
+// ============================================================================
+// Spec Adapter
+// ============================================================================
+
+/// Adapter defined entirely by a MappingSpec
+///
+/// The spec is validated and compiled into field mappings and a mapping
+/// plan when the adapter is constructed, so conversions never look at the
+/// spec again. Native files use the spec's text layout.
+class SpecAdapter : public BaseAdapter {
+public:
+    /// @throws std::runtime_error if the spec is invalid
+    explicit SpecAdapter(MappingSpec spec);
+
+    /// Create adapters from JSON (one spec or an array) or a binary bundle
+    /// @throws std::runtime_error if the data or a spec is invalid
+    static std::vector<std::shared_ptr<Adapter>> load(ByteSpan data);
+
+    /// Create adapters from a spec file (JSON or binary bundle)
+    /// @throws std::runtime_error if the file cannot be read or is invalid
+    static std::vector<std::shared_ptr<Adapter>> load_file(const std::string& path);
+
+    const MappingSpec& spec() const { return spec_; }
+
+    std::vector<uint8_t> orsf_to_native(const ORSF& orsf) const override;
+    ORSF native_to_orsf(const std::vector<uint8_t>& data) const override;
+    ORSF decode_native(ByteSpan data) const override;
+    void encode_native(const ORSF& orsf, ByteBuffer& out) const override;
+    void encode_extracted(const ORSF& orsf, const FieldValues& values, ByteBuffer& out) const override;
+    void write_native(const ORSF& orsf, OutputSink& sink) const override;
+    std::string get_suggested_filename() const override;
+    std::string get_file_extension() const override { return spec_.file_extension; }
+    std::vector<FormatSignature> get_signatures() const override { return spec_.signatures; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+    std::vector<FieldMapping> get_field_mappings() const override { return mappings_; }
+
+    /// Read native key-value text into a flat setup
+    /// @throws std::runtime_error if a value is not a number
+    FlatSetup parse_native(ByteSpan data) const;
+
+private:
+    MappingSpec spec_;
+    std::vector<FieldMapping> mappings_;
+    std::vector<size_t> write_order_;   ///< Field indices grouped by section
+
+    void write_flat(const FlatSetup& flat, TextWriter& writer) const;
+    void append_flat(const FlatSetup& flat, ByteBuffer& out) const;
+};
+
+} // namespace orsf
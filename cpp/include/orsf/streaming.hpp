@@ -0,0 +1,53 @@
+#pragma once
+
+#include "core.hpp"
+#include "validator.hpp"
+#include <string>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Streaming Validation
+// ============================================================================
+
+/// Options controlling early termination of streaming validation
+struct StreamingValidationOptions {
+    size_t max_errors = 0;          ///< Stop after this many findings (0 = unlimited)
+    bool stop_on_error = false;     ///< Stop at the first Error-severity finding
+};
+
+/// Result of streaming validation
+struct StreamingValidationResult {
+    std::vector<ValidationError> errors;
+    bool complete = false;          ///< Whole document was scanned
+    bool syntax_error = false;      ///< Input is not well-formed JSON
+    size_t bytes_scanned = 0;       ///< Bytes consumed before completion or stop
+
+    /// Check if no Error-severity finding was reported
+    bool is_valid() const;
+};
+
+/// Validator that applies the Validator rule set directly to raw JSON bytes
+///
+/// Consumes SAX events and checks fields as they arrive without building a
+/// DOM or an ORSF. Findings use the same field paths, codes and messages as
+/// Validator::validate, but are reported in document order. Fields whose JSON
+/// type would make ORSF::from_json fail are reported as InvalidFormat.
+class StreamingValidator {
+public:
+    /// Validate raw JSON bytes
+    static StreamingValidationResult validate(
+        const char* data,
+        size_t size,
+        const StreamingValidationOptions& options = {}
+    );
+
+    /// Validate JSON string
+    static StreamingValidationResult validate(
+        const std::string& json_str,
+        const StreamingValidationOptions& options = {}
+    );
+};
+
+} // namespace orsf
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "instrument.hpp"
+#include "sink.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Trace Options
+// ============================================================================
+
+/// What a Tracer keeps
+struct TraceOptions {
+    /// Events kept per thread; older ones are overwritten (about 48 bytes each)
+    size_t events_per_thread = 65536;
+
+    /// Keep items (setups) whose id is a multiple of this (1 keeps all).
+    /// Sampling by item keeps every stage of a sampled setup together.
+    uint64_t sample_every = 1;
+
+    /// Drop calls shorter than this (0 keeps all)
+    std::chrono::nanoseconds min_duration{0};
+
+    /// Keep calls made outside any ScopedItem
+    bool keep_untagged = true;
+};
+
+/// Tracer counters
+struct TraceStats {
+    uint64_t recorded = 0;          ///< Events written to a ring
+    uint64_t overwritten = 0;       ///< Recorded events lost to ring wrap-around
+    uint64_t sampled_out = 0;       ///< Events skipped by sampling or min_duration
+    size_t threads = 0;             ///< Threads that delivered events
+
+    /// Events currently held
+    uint64_t retained() const { return recorded - overwritten; }
+};
+
+// ============================================================================
+// Tracer
+// ============================================================================
+
+/// Records stage calls per thread and exports them as Chrome trace events
+///
+/// Register with Instrumentation::add_sink; events only arrive from a
+/// library built with ORSF_ENABLE_INSTRUMENTATION. Each thread writes into
+/// its own fixed-size ring, so memory stays bounded however long the run.
+/// Calls are tagged with the item set by ScopedItem (convert_batch tags
+/// each setup index), which Perfetto shows as the "setup" argument.
+///
+///     auto tracer = std::make_shared<Tracer>();
+///     Instrumentation::add_sink(tracer);
+///     convert_batch(setups, adapters, pool);
+///     Instrumentation::remove_sink(tracer);
+///     tracer->write_json(file_sink);     // open in ui.perfetto.dev or chrome://tracing
+class Tracer : public StageSink {
+public:
+    explicit Tracer(TraceOptions options = {});
+    ~Tracer() override;
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    void on_stage(const StageEvent& event) override;
+
+    /// Write all retained events in Chrome trace-event JSON format
+    ///
+    /// Each call is a complete ("X") event carrying its begin time and
+    /// duration in microseconds since the tracer was created.
+    void write_json(OutputSink& sink) const;
+
+    /// write_json into a string
+    std::string to_json_string() const;
+
+    /// Drop retained events and zero the counters
+    void clear();
+
+    TraceStats stats() const;
+
+    const TraceOptions& options() const { return options_; }
+
+private:
+    struct Record {
+        Stage stage;
+        uint64_t item;
+        int64_t start_ns;           ///< Since origin_
+        int64_t duration_ns;
+        uint64_t bytes;
+        uint64_t errors;
+    };
+
+    struct Ring {
+        std::mutex mutex;           ///< Uncontended except while exporting
+        uint32_t thread = 0;
+        std::vector<Record> records;
+        uint64_t written = 0;
+        uint64_t sampled_out = 0;
+    };
+
+    TraceOptions options_;
+    uint64_t id_;
+    std::chrono::steady_clock::time_point origin_;
+
+    mutable std::mutex mutex_;      ///< Guards rings_
+    std::vector<std::unique_ptr<Ring>> rings_;
+
+    Ring& thread_ring();
+};
+
+} // namespace orsf
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "core.hpp"
+#include "mapping.hpp"
+#include "adapter.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace orsf {
+
+// ============================================================================
+// Direct Transcoding
+// ============================================================================
+
+/// Converts flat native values of one mapping-driven adapter to another's
+///
+/// Equivalent to to.orsf_to_flat(from.flat_to_orsf(native, template_orsf)),
+/// but for every target field the source adapter's to_orsf transform is
+/// fused with the target's to_native transform, so values go straight from
+/// one flat setup to the other without building an ORSF in between.
+/// Target fields with no source mapping read the template. Fields whose
+/// ORSF storage would alter the value (not writable through
+/// MappingEngine::set_value) are read from a materialized ORSF pivot,
+/// which is only built when such a field is mapped by the source.
+class Transcoder {
+public:
+    Transcoder(std::shared_ptr<const MappingPlan> from, std::shared_ptr<const MappingPlan> to);
+
+    /// Transcode between two BaseAdapters using their cached mapping plans
+    Transcoder(const BaseAdapter& from, const BaseAdapter& to);
+
+    /// Convert source native values to target native values
+    /// @param template_orsf Supplies fields the source does not map
+    /// @throws std::runtime_error if a required field is missing on either side
+    FlatSetup transcode(const FlatSetup& native, const ORSF& template_orsf = ORSF()) const;
+
+    /// Number of target fields converted without the ORSF pivot
+    size_t fused_count() const { return steps_.size() - pivot_count_; }
+
+    /// Number of target fields read from the ORSF pivot
+    size_t pivot_count() const { return pivot_count_; }
+
+private:
+    struct Source {
+        const FieldMapping* mapping;    ///< Source mapping writing the target's ORSF path
+        TransformFunc transform;        ///< to_orsf then to_native (empty = identity)
+    };
+
+    struct Step {
+        const FieldMapping* target;
+        FieldGetter getter;             ///< nullptr: fall back to MappingEngine::get_value
+        std::vector<Source> sources;    ///< In source mapping order (last present wins)
+        bool pivot = false;
+    };
+
+    std::shared_ptr<const MappingPlan> from_;
+    std::shared_ptr<const MappingPlan> to_;
+    std::vector<Step> steps_;           ///< Parallel to the target mappings
+    std::vector<const FieldMapping*> required_;    ///< Required source mappings
+    size_t pivot_count_ = 0;
+
+    std::optional<double> read(const Step& step, const ORSF& orsf) const;
+    void emit(FlatSetup& out, const Step& step, std::optional<double> value) const;
+};
+
+} // namespace orsf
@@ -62,6 +62,10 @@ public:
     /// Convert value from one unit to another
     static double convert(double value, Unit from, Unit to);
 
+    /// Base unit of a unit's quantity (e.g. PSI -> KPA); two units convert
+    /// into each other only if they share a base unit
+    static Unit base_unit(Unit unit);
+
     /// Clamp value to range with optional step precision
     static double clamp(double value, double min, double max, double step = 0.0);
 
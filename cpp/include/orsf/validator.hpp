@@ -1,11 +1,15 @@
 #pragma once
 
 #include "core.hpp"
+#include <cstdint>
 #include <string>
 #include <vector>
 
 namespace orsf {
 
+struct ColumnRule;
+class RuleProgram;
+
 // ============================================================================
 // Validation Framework
 // ============================================================================
@@ -52,6 +56,9 @@ struct ValidationError {
 /// Validator for ORSF format
 class Validator {
 public:
+    /// Version of the built-in rule set (bump whenever rules change)
+    static constexpr uint32_t RULE_SET_VERSION = 1;
+
     /// Validate complete ORSF structure
     static std::vector<ValidationError> validate(const ORSF& orsf);
 
@@ -105,6 +112,9 @@ public:
     static void validate_cross_field(const ORSF& orsf, std::vector<ValidationError>& errors);
 
 private:
+    friend struct ColumnRule;
+    friend class RuleProgram;
+
     // Helper functions for common validation patterns
     static void check_required(
         const std::string& field,
@@ -144,6 +154,13 @@ private:
         const std::string& value,
         std::vector<ValidationError>& errors
     );
+
+    // Checks other than numeric ranges, shared with RuleProgram
+    static void check_car_class(const Car& car, std::vector<ValidationError>& errors);
+    static void check_rubber(const Context& ctx, std::vector<ValidationError>& errors);
+    static void check_clutch_plates(const Drivetrain& d, std::vector<ValidationError>& errors);
+    static void check_gear_ratios(const Gearing& g, std::vector<ValidationError>& errors);
+    static void check_stint_laps(const Fuel& f, std::vector<ValidationError>& errors);
 };
 
 } // namespace orsf
@@ -1,62 +1,594 @@
 #include "orsf/adapter.hpp"
+#include "orsf/instrument.hpp"
+#include "orsf/plugin.hpp"
 #include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
 
 namespace orsf {
 
+// ============================================================================
+// Adapter Interface Defaults
+// ============================================================================
+
+ORSF Adapter::decode_native(ByteSpan data) const {
+    ORSF_STAGE(stage, AdapterDecode);
+    ORSF_STAGE_BYTES(stage, data.size());
+    const auto* first = reinterpret_cast<const uint8_t*>(data.data());
+    return native_to_orsf(std::vector<uint8_t>(first, first + data.size()));
+}
+
+void Adapter::encode_native(const ORSF& orsf, ByteBuffer& out) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    size_t start = out.size();
+    out.append(orsf_to_native(orsf));
+    ORSF_STAGE_BYTES(stage, out.size() - start);
+    (void)start;
+}
+
+void Adapter::encode_extracted(const ORSF& orsf, const FieldValues& values, ByteBuffer& out) const {
+    (void)values;
+    encode_native(orsf, out);
+}
+
+void Adapter::write_native(const ORSF& orsf, OutputSink& sink) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    ByteBuffer out;
+    encode_native(orsf, out);
+    ORSF_STAGE_BYTES(stage, out.size());
+    sink.write(out.span());
+    sink.flush();
+}
+
 // ============================================================================
 // Adapter Registry Implementation
 // ============================================================================
 
+namespace {
+
+// Lookup key viewing strings owned by a snapshot (or by the caller)
+struct AdapterKey {
+    std::string_view id;
+    std::string_view version;
+    std::string_view car_key;
+
+    bool operator==(const AdapterKey& other) const {
+        return id == other.id && version == other.version && car_key == other.car_key;
+    }
+};
+
+struct AdapterKeyHash {
+    size_t operator()(const AdapterKey& key) const {
+        std::hash<std::string_view> hasher;
+        size_t seed = hasher(key.id);
+        seed ^= hasher(key.version) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        seed ^= hasher(key.car_key) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
+
+// Identity of an adapter as views of its getters' results, copied into storage
+AdapterKey identity_of(const Adapter& adapter, Adapter::Metadata& storage) {
+    storage.id = adapter.get_id();
+    storage.version = adapter.get_version();
+    storage.car_key = adapter.get_car_key();
+    return AdapterKey{storage.id, storage.version, storage.car_key};
+}
+
+} // namespace
+
+/// Signature automaton and extension index over a snapshot's adapters
+struct AdapterRegistry::FormatIndex {
+    struct Owner {
+        size_t adapter;                     ///< Index into the snapshot's adapters
+        std::optional<size_t> offset;       ///< Required match position
+        size_t length;
+    };
+
+    SignatureMatcher matcher;
+    std::vector<Owner> owners;              ///< Parallel to the matcher's patterns
+    std::unordered_map<std::string, std::vector<size_t>> by_extension;     ///< Indexes into adapters
+
+    explicit FormatIndex(const std::vector<std::shared_ptr<Adapter>>& adapters) {
+        std::vector<std::string> patterns;
+        for (size_t i = 0; i < adapters.size(); ++i) {
+            for (auto& signature : adapters[i]->get_signatures()) {
+                if (signature.bytes.empty()) continue;
+                owners.push_back(Owner{i, signature.offset, signature.bytes.size()});
+                patterns.push_back(std::move(signature.bytes));
+            }
+
+            std::string extension = normalize_extension(adapters[i]->get_file_extension());
+            if (!extension.empty()) {
+                by_extension[extension].push_back(i);
+            }
+        }
+        matcher = SignatureMatcher(patterns);
+    }
+};
+
+/// Immutable lookup indexes over the registered adapters
+///
+/// The exact index holds (id, version, car_key) plus the wildcard forms
+/// (id, version, ""), (id, "", car_key) and (id, "", ""), each mapped to the
+/// first adapter in registration order that matches, so a resolve is a
+/// single hash lookup. Keys view copies of get_id(), get_version() and
+/// get_car_key() taken when the snapshot is built (only on mutation), so
+/// adapters that override the getters are indexed under what they return.
+struct AdapterRegistry::Snapshot : std::enable_shared_from_this<AdapterRegistry::Snapshot> {
+    std::vector<std::shared_ptr<Adapter>> adapters;
+    std::vector<AdapterKey> identities;     ///< Parallel to adapters
+    std::vector<std::unique_ptr<Adapter::Metadata>> copied_identities;  ///< Owned by identities
+    std::unordered_map<AdapterKey, size_t, AdapterKeyHash> exact;      ///< Indexes into adapters
+    std::unordered_map<std::string_view, std::vector<size_t>> by_id;   ///< Indexes into adapters
+    std::vector<const PluginAdapter*> plugins;  ///< Parallel to adapters (empty if there are no plugin adapters)
+
+    explicit Snapshot(const std::vector<std::shared_ptr<Adapter>>& registered)
+        : adapters(registered) {
+        identities.reserve(adapters.size());
+        for (size_t i = 0; i < adapters.size(); ++i) {
+            const Adapter* adapter = adapters[i].get();
+            copied_identities.push_back(std::make_unique<Adapter::Metadata>());
+            identities.push_back(identity_of(*adapter, *copied_identities.back()));
+
+            if (const auto* plugin = dynamic_cast<const PluginAdapter*>(adapter)) {
+                plugins.resize(adapters.size(), nullptr);
+                plugins[i] = plugin;
+            }
+        }
+
+        exact.reserve(adapters.size() * 4);
+        for (size_t i = 0; i < adapters.size(); ++i) {
+            const AdapterKey& identity = identities[i];
+
+            // emplace keeps the earliest registration for each key
+            exact.emplace(identity, i);
+            exact.emplace(AdapterKey{identity.id, identity.version, {}}, i);
+            exact.emplace(AdapterKey{identity.id, {}, identity.car_key}, i);
+            exact.emplace(AdapterKey{identity.id, {}, {}}, i);
+
+            by_id[identity.id].push_back(i);
+        }
+    }
+
+    /// Adapter at index, loading its plugin first if it is a plugin adapter
+    const std::shared_ptr<Adapter>& loaded(size_t index) const {
+        if (!plugins.empty() && plugins[index] != nullptr) {
+            plugins[index]->target();
+        }
+        return adapters[index];
+    }
+
+    /// Signature and extension index (built on first use)
+    const FormatIndex& formats() const {
+        std::call_once(formats_once, [this] {
+            format_index = std::make_unique<const FormatIndex>(adapters);
+        });
+        return *format_index;
+    }
+
+private:
+    mutable std::once_flag formats_once;
+    mutable std::unique_ptr<const FormatIndex> format_index;
+};
+
+namespace {
+
+uint64_t mix64(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+// Seeded FNV-1a over the three key parts
+uint64_t key_hash(const AdapterKey& key, uint64_t seed) {
+    uint64_t hash = 14695981039346656037ULL ^ mix64(seed);
+    auto add = [&hash](std::string_view part) {
+        for (char c : part) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        hash ^= 0xff;   // Part separator (0xff never occurs in UTF-8)
+        hash *= 1099511628211ULL;
+    };
+    add(key.id);
+    add(key.version);
+    add(key.car_key);
+    return hash;
+}
+
+} // namespace
+
+/// Perfect-hash table over every key of a snapshot (hash and displace)
+///
+/// A key's base hash picks a bucket; the bucket's displacement then picks a
+/// slot, chosen at build time so that no two keys share a slot. A lookup is
+/// one hash, two array reads and one key comparison.
+struct AdapterRegistry::FrozenTable {
+    struct Slot {
+        AdapterKey key;
+        size_t index = 0;       ///< Index into snapshot->adapters
+        bool used = false;
+    };
+
+    std::shared_ptr<const Snapshot> snapshot;
+    uint64_t seed = 0;
+    std::vector<uint32_t> displacements;    ///< Per bucket (0 = empty bucket)
+    std::vector<Slot> slots;
+
+    explicit FrozenTable(std::shared_ptr<const Snapshot> frozen) : snapshot(std::move(frozen)) {
+        std::vector<std::pair<AdapterKey, size_t>> keys(snapshot->exact.begin(), snapshot->exact.end());
+        if (keys.empty()) return;
+
+        for (seed = 0; !build(keys); ++seed) {}
+    }
+
+    const std::shared_ptr<Adapter>* find(const AdapterKey& key) const {
+        if (slots.empty()) return nullptr;
+
+        uint64_t hash = key_hash(key, seed);
+        uint32_t displacement = displacements[hash % displacements.size()];
+        if (displacement == 0) return nullptr;
+
+        const Slot& slot = slots[slot_for(hash, displacement)];
+        if (!slot.used || !(slot.key == key)) return nullptr;
+        return &snapshot->adapters[slot.index];
+    }
+
+private:
+    size_t slot_for(uint64_t hash, uint32_t displacement) const {
+        return mix64(hash ^ (displacement * 0x9e3779b97f4a7c15ULL)) % slots.size();
+    }
+
+    bool build(const std::vector<std::pair<AdapterKey, size_t>>& keys) {
+        const size_t count = keys.size();
+        displacements.assign(count / 4 + 1, 0);
+        slots.assign(count + count / 4 + 1, Slot{});
+
+        std::vector<uint64_t> hashes(count);
+        std::vector<std::vector<size_t>> buckets(displacements.size());
+        for (size_t i = 0; i < count; ++i) {
+            hashes[i] = key_hash(keys[i].first, seed);
+            buckets[hashes[i] % buckets.size()].push_back(i);
+        }
+
+        // Place the largest buckets first while the table is emptiest
+        std::vector<size_t> order(buckets.size());
+        for (size_t b = 0; b < order.size(); ++b) order[b] = b;
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        const uint32_t max_displacement = static_cast<uint32_t>(slots.size() * 32 + 1024);
+        std::vector<size_t> positions;
+
+        for (size_t b : order) {
+            const auto& bucket = buckets[b];
+            if (bucket.empty()) break;
+
+            bool placed = false;
+            for (uint32_t displacement = 1; displacement <= max_displacement && !placed; ++displacement) {
+                positions.clear();
+                placed = true;
+                for (size_t i : bucket) {
+                    size_t position = slot_for(hashes[i], displacement);
+                    if (slots[position].used ||
+                        std::find(positions.begin(), positions.end(), position) != positions.end()) {
+                        placed = false;
+                        break;
+                    }
+                    positions.push_back(position);
+                }
+
+                if (placed) {
+                    displacements[b] = displacement;
+                    for (size_t k = 0; k < bucket.size(); ++k) {
+                        Slot& slot = slots[positions[k]];
+                        slot.key = keys[bucket[k]].first;
+                        slot.index = keys[bucket[k]].second;
+                        slot.used = true;
+                    }
+                }
+            }
+
+            if (!placed) return false;  // Retry with a new seed
+        }
+
+        return true;
+    }
+};
+
+/// Keeps the published snapshot alive while a reader uses it
+class AdapterRegistry::ReadGuard {
+public:
+    explicit ReadGuard(const AdapterRegistry& registry)
+        : section_(*registry.readers_), snapshot_(registry.snapshot_.load(std::memory_order_seq_cst)) {}
+
+    ReadGuard(const ReadGuard&) = delete;
+    ReadGuard& operator=(const ReadGuard&) = delete;
+
+    const Snapshot* operator->() const { return snapshot_; }
+    const Snapshot& operator*() const { return *snapshot_; }
+
+private:
+    ReaderEpochs::Section section_;
+    const Snapshot* snapshot_;
+};
+
+AdapterRegistry::AdapterRegistry()
+    : current_snapshot_(std::make_shared<const Snapshot>(adapters_)),
+      snapshot_(current_snapshot_.get()),
+      readers_(std::make_unique<ReaderEpochs>()) {}
+
+AdapterRegistry::~AdapterRegistry() = default;
+
 AdapterRegistry& AdapterRegistry::instance() {
     static AdapterRegistry instance;
     return instance;
 }
 
+void AdapterRegistry::publish_snapshot() {
+    std::shared_ptr<const Snapshot> previous = std::move(current_snapshot_);
+    current_snapshot_ = std::make_shared<const Snapshot>(adapters_);
+    snapshot_.store(current_snapshot_.get(), std::memory_order_seq_cst);
+
+    // Readers copy what they need out of the snapshot, so this wait is short
+    readers_->synchronize();
+}
+
+std::shared_ptr<const AdapterRegistry::Snapshot> AdapterRegistry::read_snapshot() const {
+    if (const FrozenTable* frozen = frozen_.load(std::memory_order_acquire)) {
+        return frozen->snapshot;
+    }
+    ReadGuard snapshot(*this);
+    return snapshot->shared_from_this();
+}
+
+void AdapterRegistry::ensure_mutable() const {
+    if (frozen_.load(std::memory_order_relaxed) != nullptr) {
+        throw std::runtime_error("AdapterRegistry is frozen");
+    }
+}
+
 void AdapterRegistry::register_adapter(std::shared_ptr<Adapter> adapter) {
     std::lock_guard<std::mutex> lock(mutex_);
+    ensure_mutable();
+    compile_rule_program(*adapter);
     adapters_.push_back(adapter);
+    publish_snapshot();
 }
 
-std::shared_ptr<Adapter> AdapterRegistry::resolve(
+void AdapterRegistry::register_adapters(const std::vector<std::shared_ptr<Adapter>>& adapters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ensure_mutable();
+
+    adapters_.reserve(adapters_.size() + adapters.size());
+    for (const auto& adapter : adapters) {
+        compile_rule_program(*adapter);
+        adapters_.push_back(adapter);
+    }
+    publish_snapshot();
+}
+
+size_t AdapterRegistry::register_adapters(const AdapterRegistration* begin, const AdapterRegistration* end) {
+    if (begin == nullptr || end == nullptr || begin >= end) return 0;
+
+    std::vector<std::shared_ptr<Adapter>> adapters;
+    adapters.reserve(static_cast<size_t>(end - begin));
+    for (const AdapterRegistration* registration = begin; registration != end; ++registration) {
+        auto adapter = registration->create();
+        if (!adapter) {
+            throw std::runtime_error(std::string("Static adapter registration returned null: ") + registration->name);
+        }
+        adapters.push_back(std::move(adapter));
+    }
+
+    register_adapters(adapters);
+    return adapters.size();
+}
+
+size_t AdapterRegistry::register_plugins(const std::string& directory) {
+    PluginIndex index = PluginIndex::scan(directory);
+    register_adapters(index.adapters);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    plugins_.insert(plugins_.end(), index.plugins.begin(), index.plugins.end());
+    plugin_index_time_ += index.index_time;
+    return index.adapters.size();
+}
+
+PluginReport AdapterRegistry::plugin_report() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PluginReport report;
+    report.index_time = plugin_index_time_;
+    report.plugins.reserve(plugins_.size());
+    for (const auto& plugin : plugins_) {
+        report.plugins.push_back(plugin->stats());
+    }
+    return report;
+}
+
+void AdapterRegistry::freeze() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (frozen_.load(std::memory_order_relaxed) != nullptr) return;
+
+    frozen_table_ = std::make_unique<const FrozenTable>(current_snapshot_);
+    frozen_table_->snapshot->formats();
+    frozen_.store(frozen_table_.get(), std::memory_order_release);
+}
+
+void AdapterRegistry::register_class_profile(const std::string& car_class, ValidationProfile profile) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ensure_mutable();
+    class_profiles_[car_class] = std::move(profile);
+
+    for (const auto& adapter : adapters_) {
+        compile_rule_program(*adapter);
+    }
+}
+
+void AdapterRegistry::register_adapter_profile(
     const std::string& id,
     const std::string& version,
-    const std::string& car_key
-) const {
+    const std::string& car_key,
+    ValidationProfile profile
+) {
     std::lock_guard<std::mutex> lock(mutex_);
+    ensure_mutable();
+    adapter_profiles_[make_key(id, version, car_key)] = std::move(profile);
 
-    // Try exact match first
+    const AdapterKey target{id, version, car_key};
+    Adapter::Metadata storage;
     for (const auto& adapter : adapters_) {
-        bool id_match = adapter->get_id() == id;
-        bool version_match = version.empty() || adapter->get_version() == version;
-        bool car_match = car_key.empty() || adapter->get_car_key() == car_key;
+        if (identity_of(*adapter, storage) == target) {
+            compile_rule_program(*adapter);
+        }
+    }
+}
+
+void AdapterRegistry::compile_rule_program(Adapter& adapter) const {
+    Adapter::Metadata storage;
+    AdapterKey identity = identity_of(adapter, storage);
+    auto it = adapter_profiles_.find(make_key(identity.id, identity.version, identity.car_key));
 
-        if (id_match && version_match && car_match) {
-            return adapter;
+    if (it != adapter_profiles_.end()) {
+        adapter.set_rule_program(RuleProgram::compile(class_profiles_, &it->second));
+        return;
+    }
+
+    auto own_profile = adapter.get_validation_profile();
+    adapter.set_rule_program(RuleProgram::compile(
+        class_profiles_, own_profile.has_value() ? &own_profile.value() : nullptr));
+}
+
+std::shared_ptr<Adapter> AdapterRegistry::resolve(
+    std::string_view id,
+    std::string_view version,
+    std::string_view car_key
+) const {
+    if (const FrozenTable* frozen = frozen_.load(std::memory_order_acquire)) {
+        const std::shared_ptr<Adapter>* adapter = frozen->find(AdapterKey{id, version, car_key});
+        if (adapter == nullptr) adapter = frozen->find(AdapterKey{id, {}, {}});
+        if (adapter == nullptr) return nullptr;
+        return frozen->snapshot->loaded(static_cast<size_t>(adapter - frozen->snapshot->adapters.data()));
+    }
+
+    std::shared_ptr<Adapter> adapter;
+    const PluginAdapter* plugin = nullptr;
+    {
+        ReadGuard snapshot(*this);
+
+        // Exact or wildcard match
+        auto it = snapshot->exact.find(AdapterKey{id, version, car_key});
+
+        // Fall back to the first adapter for the game (no version/car requirements)
+        if (it == snapshot->exact.end()) {
+            it = snapshot->exact.find(AdapterKey{id, {}, {}});
+            if (it == snapshot->exact.end()) {
+                return nullptr;
+            }
         }
+
+        adapter = snapshot->adapters[it->second];
+        if (!snapshot->plugins.empty()) plugin = snapshot->plugins[it->second];
     }
 
-    // Try partial match (no version/car requirements)
-    for (const auto& adapter : adapters_) {
-        if (adapter->get_id() == id) {
-            return adapter;
+    // Load the plugin outside the read section (writers wait for readers)
+    if (plugin != nullptr) plugin->target();
+    return adapter;
+}
+
+std::vector<std::shared_ptr<Adapter>> AdapterRegistry::detect_all(ByteSpan head, std::string_view filename) const {
+    return detect_candidates(head, filename, false);
+}
+
+std::shared_ptr<Adapter> AdapterRegistry::detect(ByteSpan head, std::string_view filename) const {
+    auto candidates = detect_candidates(head, filename, true);
+    return candidates.empty() ? nullptr : candidates.front();
+}
+
+std::vector<std::shared_ptr<Adapter>> AdapterRegistry::detect_candidates(
+    ByteSpan head,
+    std::string_view filename,
+    bool first_only
+) const {
+    auto snapshot = read_snapshot();
+    const FormatIndex& formats = snapshot->formats();
+
+    struct Candidate {
+        size_t adapter;
+        size_t signature_length;    ///< Longest matching signature (0 = none)
+        bool extension;
+    };
+
+    constexpr size_t NO_CANDIDATE = static_cast<size_t>(-1);
+    std::vector<Candidate> candidates;
+    std::vector<size_t> slots(snapshot->adapters.size(), NO_CANDIDATE);
+    auto candidate_for = [&](size_t adapter) -> Candidate& {
+        if (slots[adapter] == NO_CANDIDATE) {
+            slots[adapter] = candidates.size();
+            candidates.push_back(Candidate{adapter, 0, false});
         }
+        return candidates[slots[adapter]];
+    };
+
+    // One pass over the head finds every signature of every adapter
+    std::vector<SignatureMatch> matches;
+    formats.matcher.scan(head.subspan(0, DETECT_HEAD_SIZE), matches);
+    for (const auto& match : matches) {
+        const FormatIndex::Owner& owner = formats.owners[match.pattern];
+        if (owner.offset.has_value() && owner.offset.value() != match.position) continue;
+
+        Candidate& candidate = candidate_for(owner.adapter);
+        candidate.signature_length = std::max(candidate.signature_length, owner.length);
     }
 
-    return nullptr;
+    if (!filename.empty()) {
+        auto it = formats.by_extension.find(file_extension(filename));
+        if (it != formats.by_extension.end()) {
+            for (size_t adapter : it->second) {
+                candidate_for(adapter).extension = true;
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.signature_length != b.signature_length) return a.signature_length > b.signature_length;
+        if (a.extension != b.extension) return a.extension;
+        return a.adapter < b.adapter;
+    });
+
+    std::vector<std::shared_ptr<Adapter>> result;
+    for (const auto& candidate : candidates) {
+        const auto& adapter = snapshot->adapters[candidate.adapter];
+        if (!adapter->sniff(head)) continue;
+
+        result.push_back(adapter);
+        if (first_only) break;
+    }
+
+    return result;
 }
 
 std::vector<std::shared_ptr<Adapter>> AdapterRegistry::get_all_adapters() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return adapters_;
+    if (const FrozenTable* frozen = frozen_.load(std::memory_order_acquire)) {
+        return frozen->snapshot->adapters;
+    }
+    ReadGuard snapshot(*this);
+    return snapshot->adapters;
 }
 
 std::vector<std::shared_ptr<Adapter>> AdapterRegistry::get_adapters_for_game(const std::string& id) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    auto snapshot = read_snapshot();
 
     std::vector<std::shared_ptr<Adapter>> result;
-    for (const auto& adapter : adapters_) {
-        if (adapter->get_id() == id) {
-            result.push_back(adapter);
+    auto it = snapshot->by_id.find(id);
+    if (it != snapshot->by_id.end()) {
+        for (size_t index : it->second) {
+            result.push_back(snapshot->adapters[index]);
         }
     }
 
@@ -69,29 +601,60 @@ void AdapterRegistry::unregister_adapter(
     const std::string& car_key
 ) {
     std::lock_guard<std::mutex> lock(mutex_);
+    ensure_mutable();
 
+    const AdapterKey target{id, version, car_key};
+    Adapter::Metadata storage;
     adapters_.erase(
         std::remove_if(adapters_.begin(), adapters_.end(),
             [&](const std::shared_ptr<Adapter>& adapter) {
-                return adapter->get_id() == id &&
-                       adapter->get_version() == version &&
-                       adapter->get_car_key() == car_key;
+                return identity_of(*adapter, storage) == target;
             }),
         adapters_.end()
     );
+    publish_snapshot();
 }
 
 void AdapterRegistry::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
+    ensure_mutable();
     adapters_.clear();
+    class_profiles_.clear();
+    adapter_profiles_.clear();
+    plugins_.clear();
+    plugin_index_time_ = std::chrono::nanoseconds(0);
+    publish_snapshot();
 }
 
+#if !defined(__ELF__)
+namespace {
+
+std::vector<const AdapterRegistration*>& registration_list() {
+    static std::vector<const AdapterRegistration*> registrations;
+    return registrations;
+}
+
+} // namespace
+
+bool add_static_adapter_registration(const AdapterRegistration* registration) {
+    registration_list().push_back(registration);
+    return true;
+}
+
+const std::vector<const AdapterRegistration*>& static_adapter_registrations() {
+    return registration_list();
+}
+#endif
+
 std::string AdapterRegistry::make_key(
-    const std::string& id,
-    const std::string& version,
-    const std::string& car_key
+    std::string_view id,
+    std::string_view version,
+    std::string_view car_key
 ) {
-    return id + ":" + version + ":" + car_key;
+    std::string key;
+    key.reserve(id.size() + version.size() + car_key.size() + 2);
+    key.append(id).append(":").append(version).append(":").append(car_key);
+    return key;
 }
 
 // ============================================================================
@@ -113,15 +676,50 @@ BaseAdapter::BaseAdapter(
 }
 
 std::vector<ValidationError> BaseAdapter::validate_orsf(const ORSF& orsf) const {
+    ORSF_STAGE(stage, AdapterValidate);
+    Published<RuleProgram>::Reader program(rule_program_);
+    if (program) {
+        return program->validate(orsf);
+    }
     return Validator::validate(orsf);
 }
 
+void BaseAdapter::set_rule_program(std::shared_ptr<const RuleProgram> program) {
+    rule_program_.store(std::move(program));
+}
+
+std::shared_ptr<const RuleProgram> BaseAdapter::get_rule_program() const {
+    return rule_program_.load();
+}
+
+const MappingPlan& BaseAdapter::compiled_plan() const {
+    std::call_once(mapping_once_, [this] {
+        mapping_plan_ = std::make_shared<const MappingPlan>(get_field_mappings());
+    });
+    return *mapping_plan_;
+}
+
+std::shared_ptr<const MappingPlan> BaseAdapter::mapping_plan() const {
+    compiled_plan();
+    return mapping_plan_;
+}
+
 FlatSetup BaseAdapter::orsf_to_flat(const ORSF& orsf) const {
-    return MappingEngine::map_to_native(orsf, get_field_mappings());
+    return compiled_plan().to_native(orsf);
+}
+
+FlatSetup BaseAdapter::orsf_to_flat(const ORSF& orsf, const FieldValues& values) const {
+    return compiled_plan().to_native(orsf, values);
 }
 
 ORSF BaseAdapter::flat_to_orsf(const FlatSetup& flat, const ORSF& template_orsf) const {
-    return MappingEngine::map_to_orsf(flat, get_field_mappings(), template_orsf);
+    return compiled_plan().to_orsf(flat, template_orsf);
+}
+
+void BaseAdapter::write_key_values(const FlatSetup& flat, TextWriter& writer) const {
+    for (const auto& [key, value] : flat) {
+        writer.key_value(key, value);
+    }
 }
 
 // ============================================================================
@@ -132,15 +730,40 @@ ExampleAdapter::ExampleAdapter()
     : BaseAdapter("example", "1.0", "generic", "Example adapter for demonstration", "ORSF Team") {}
 
 std::vector<uint8_t> ExampleAdapter::orsf_to_native(const ORSF& orsf) const {
-    // Example: Convert to JSON bytes
-    std::string json_str = orsf.to_json_string(2);
-    return std::vector<uint8_t>(json_str.begin(), json_str.end());
+    ORSF_STAGE(stage, AdapterEncode);
+    ByteBuffer out;
+    encode_native(orsf, out);
+    ORSF_STAGE_BYTES(stage, out.size());
+    return out.release();
 }
 
 ORSF ExampleAdapter::native_to_orsf(const std::vector<uint8_t>& data) const {
-    // Example: Parse from JSON bytes
-    std::string json_str(data.begin(), data.end());
-    return ORSF::from_json(json_str);
+    return decode_native(ByteSpan(data));
+}
+
+ORSF ExampleAdapter::decode_native(ByteSpan data) const {
+    ORSF_STAGE(stage, AdapterDecode);
+    ORSF_STAGE_BYTES(stage, data.size());
+
+    // Example: Parse JSON directly from the bytes
+    return parse_orsf_json(data);
+}
+
+void ExampleAdapter::encode_native(const ORSF& orsf, ByteBuffer& out) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    size_t start = out.size();
+
+    // Example: Serialize JSON directly into the buffer
+    write_orsf_json(orsf, out, 2);
+    ORSF_STAGE_BYTES(stage, out.size() - start);
+    (void)start;
+}
+
+void ExampleAdapter::write_native(const ORSF& orsf, OutputSink& sink) const {
+    ORSF_STAGE(stage, AdapterEncode);
+
+    // Example: Stream JSON to the sink in buffered chunks
+    write_orsf_json(orsf, sink, 2);
 }
 
 std::string ExampleAdapter::get_suggested_filename() const {
@@ -151,6 +774,18 @@ std::string ExampleAdapter::get_file_extension() const {
     return "json";
 }
 
+std::vector<FormatSignature> ExampleAdapter::get_signatures() const {
+    // Example: The schema URI appears near the top of every file
+    return {FormatSignature("orsf://v1")};
+}
+
+bool ExampleAdapter::sniff(ByteSpan head) const {
+    // Example: Cheap structural check instead of a full parse
+    std::string_view text = head.as_chars();
+    size_t first = text.find_first_not_of(" \t\r\n");
+    return first != std::string_view::npos && text[first] == '{';
+}
+
 std::optional<std::string> ExampleAdapter::get_install_path() const {
     return std::nullopt;
 }
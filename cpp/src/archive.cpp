@@ -0,0 +1,132 @@
+#include "orsf/archive.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace orsf {
+
+namespace {
+
+constexpr size_t MAGIC_SIZE = 8;
+constexpr uint32_t ARCHIVE_VERSION = 1;
+constexpr uint32_t TRAILER = 0xFFFFFFFFu;
+
+void put_u32(ByteBuffer& out, uint32_t value) {
+    uint8_t* p = out.grow(4);
+    for (int i = 0; i < 4; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+void put_u64(ByteBuffer& out, uint64_t value) {
+    uint8_t* p = out.grow(8);
+    for (int i = 0; i < 8; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+} // namespace
+
+// ============================================================================
+// Archive Writer Implementation
+// ============================================================================
+
+ArchiveWriter::ArchiveWriter(OutputSink& sink) : sink_(sink) {
+    std::memcpy(header_.grow(MAGIC_SIZE), MAGIC, MAGIC_SIZE);
+    put_u32(header_, ARCHIVE_VERSION);
+    sink_.write(header_.span());
+}
+
+void ArchiveWriter::add(std::string_view name, std::string_view json) {
+    if (finished_) {
+        throw std::runtime_error("Archive already finished");
+    }
+    if (name.size() >= TRAILER) {
+        throw std::runtime_error("Archive entry name too long");
+    }
+
+    // Sizes go through a small buffer; names and JSON go straight to the sink
+    header_.clear();
+    put_u32(header_, static_cast<uint32_t>(name.size()));
+    sink_.write(header_.span());
+    sink_.write(name);
+
+    header_.clear();
+    put_u64(header_, json.size());
+    sink_.write(header_.span());
+    sink_.write(json);
+    ++count_;
+}
+
+void ArchiveWriter::add(std::string_view name, const ORSF& setup) {
+    add(name, setup.to_json_string());
+}
+
+void ArchiveWriter::finish() {
+    if (finished_) return;
+    header_.clear();
+    put_u32(header_, TRAILER);
+    put_u64(header_, count_);
+    sink_.write(header_.span());
+    sink_.flush();
+    finished_ = true;
+}
+
+// ============================================================================
+// Archive Reader Implementation
+// ============================================================================
+
+ArchiveReader::ArchiveReader(ByteSpan data) : data_(data) {
+    if (!is_archive(data)) {
+        throw std::runtime_error("Not a setup archive");
+    }
+    pos_ = MAGIC_SIZE;
+    uint32_t version = u32();
+    if (version != ARCHIVE_VERSION) {
+        throw std::runtime_error("Unsupported setup archive version: " + std::to_string(version));
+    }
+}
+
+bool ArchiveReader::is_archive(ByteSpan head) {
+    return head.size() >= MAGIC_SIZE && std::memcmp(head.data(), ArchiveWriter::MAGIC, MAGIC_SIZE) == 0;
+}
+
+bool ArchiveReader::next(ArchiveEntry& entry) {
+    if (done_) return false;
+
+    uint32_t name_size = u32();
+    if (name_size == TRAILER) {
+        uint64_t expected = u64();
+        if (expected != count_) {
+            throw std::runtime_error("Setup archive trailer expects " + std::to_string(expected) +
+                                     " entries, found " + std::to_string(count_));
+        }
+        done_ = true;
+        return false;
+    }
+
+    entry.name = bytes(name_size);
+    entry.json = bytes(u64());
+    ++count_;
+    return true;
+}
+
+uint32_t ArchiveReader::u32() {
+    std::string_view raw = bytes(4);
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) value |= static_cast<uint32_t>(static_cast<uint8_t>(raw[i])) << (8 * i);
+    return value;
+}
+
+uint64_t ArchiveReader::u64() {
+    std::string_view raw = bytes(8);
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) value |= static_cast<uint64_t>(static_cast<uint8_t>(raw[i])) << (8 * i);
+    return value;
+}
+
+std::string_view ArchiveReader::bytes(uint64_t size) {
+    if (size > data_.size() - pos_) {
+        throw std::runtime_error("Setup archive is truncated");
+    }
+    std::string_view view(data_.as_chars().data() + pos_, static_cast<size_t>(size));
+    pos_ += static_cast<size_t>(size);
+    return view;
+}
+
+} // namespace orsf
@@ -0,0 +1,153 @@
+#include "orsf/batch.hpp"
+#include "orsf/instrument.hpp"
+#include <exception>
+
+namespace orsf {
+
+// ============================================================================
+// Batch Conversion Implementation
+// ============================================================================
+
+size_t BatchResult::error_count() const {
+    size_t count = 0;
+    for (const auto& item : items) {
+        if (!item.ok()) ++count;
+    }
+    return count;
+}
+
+size_t BatchResult::arena_size() const {
+    size_t total = 0;
+    for (const auto& slice : arena) {
+        total += slice.size();
+    }
+    return total;
+}
+
+BatchResult convert_batch(
+    const ORSF* setups,
+    size_t setup_count,
+    const std::shared_ptr<Adapter>* adapters,
+    size_t adapter_count,
+    Executor& executor
+) {
+    BatchResult result;
+    result.setup_count = setup_count;
+    result.adapter_count = adapter_count;
+    result.items.resize(setup_count * adapter_count);
+    if (result.items.empty()) return result;
+
+    // Compile each mapping-driven adapter's plan once, up front
+    bool any_mapped = false;
+    for (size_t a = 0; a < adapter_count; ++a) {
+        if (const auto* base = dynamic_cast<const BaseAdapter*>(adapters[a].get())) {
+            base->mapping_plan();
+            any_mapped = true;
+        }
+    }
+
+    // Extract each setup's fields once for all adapters
+    std::vector<FieldValues> values(any_mapped ? setup_count : 0);
+    if (any_mapped) {
+        executor.parallel_for(setup_count, [&](size_t s, size_t) {
+            ORSF_STAGE_ITEM(item_scope, s);
+            values[s] = MappingEngine::extract_fields(setups[s]);
+        });
+    }
+
+    // Each worker appends to its own arena slice; items remember which one
+    std::vector<ByteBuffer> slices(executor.concurrency());
+
+    executor.parallel_for(result.items.size(), [&](size_t index, size_t worker) {
+        size_t s = index / adapter_count;
+        size_t a = index % adapter_count;
+
+        BatchItem& item = result.items[index];
+        item.setup = s;
+        item.adapter = a;
+        item.slice = worker;
+
+        ByteBuffer& buffer = slices[worker];
+        size_t start = buffer.size();
+        ORSF_STAGE_ITEM(item_scope, s);
+        try {
+            ORSF_STAGE(stage, AdapterEncode);
+            if (any_mapped) {
+                adapters[a]->encode_extracted(setups[s], values[s], buffer);
+            } else {
+                adapters[a]->encode_native(setups[s], buffer);
+            }
+            item.offset = start;
+            item.size = buffer.size() - start;
+            ORSF_STAGE_BYTES(stage, item.size);
+        } catch (const std::exception& e) {
+            buffer.truncate(start);
+            item.error = e.what();
+        } catch (...) {
+            buffer.truncate(start);
+            item.error = "Unknown conversion error";
+        }
+    });
+
+    // Hand the slices to the result without copying
+    result.arena.reserve(slices.size());
+    for (auto& slice : slices) {
+        result.arena.push_back(slice.release());
+    }
+
+    return result;
+}
+
+BatchResult convert_batch(
+    const std::vector<ORSF>& setups,
+    const std::vector<std::shared_ptr<Adapter>>& adapters,
+    Executor& executor
+) {
+    return convert_batch(setups.data(), setups.size(), adapters.data(), adapters.size(), executor);
+}
+
+BatchResult convert_batch(
+    const std::vector<ORSF>& setups,
+    const std::vector<std::shared_ptr<Adapter>>& adapters
+) {
+    auto executor = default_executor();
+    return convert_batch(setups, adapters, *executor);
+}
+
+// ============================================================================
+// Batch Parsing and Validation Implementation
+// ============================================================================
+
+std::vector<ParsedSetup> parse_batch(const std::vector<std::string>& texts, Executor& executor) {
+    std::vector<ParsedSetup> result(texts.size());
+    executor.parallel_for(texts.size(), [&](size_t index, size_t) {
+        ORSF_STAGE_ITEM(item_scope, index);
+        try {
+            result[index].setup = ORSF::from_json(texts[index]);
+        } catch (const std::exception& e) {
+            result[index].error = e.what();
+        }
+    });
+    return result;
+}
+
+std::vector<ParsedSetup> parse_batch(const std::vector<std::string>& texts) {
+    auto executor = default_executor();
+    return parse_batch(texts, *executor);
+}
+
+std::vector<std::vector<ValidationError>> validate_batch(const std::vector<ORSF>& setups, Executor& executor) {
+    std::vector<std::vector<ValidationError>> result(setups.size());
+    executor.parallel_for(setups.size(), [&](size_t index, size_t) {
+        ORSF_STAGE_ITEM(item_scope, index);
+        result[index] = Validator::validate(setups[index]);
+    });
+    return result;
+}
+
+std::vector<std::vector<ValidationError>> validate_batch(const std::vector<ORSF>& setups) {
+    auto executor = default_executor();
+    return validate_batch(setups, *executor);
+}
+
+} // namespace orsf
@@ -0,0 +1,71 @@
+#include "orsf/buffer.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+
+namespace orsf {
+
+namespace {
+
+// Stream buffer appending straight into a ByteBuffer (json's operator<< writes through it)
+class ByteBufferStreambuf : public std::streambuf {
+public:
+    explicit ByteBufferStreambuf(ByteBuffer& out) : out_(out) {}
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            out_.push_back(traits_type::to_char_type(c));
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize count) override {
+        out_.append(s, static_cast<size_t>(count));
+        return count;
+    }
+
+private:
+    ByteBuffer& out_;
+};
+
+} // namespace
+
+// ============================================================================
+// JSON Helpers Implementation
+// ============================================================================
+
+ORSF parse_orsf_json(ByteSpan bytes) {
+    const char* first = reinterpret_cast<const char*>(bytes.data());
+    json j;
+    try {
+        j = json::parse(first, first + bytes.size());
+    } catch (const json::exception& e) {
+        throw std::runtime_error(std::string("Failed to parse JSON: ") + e.what());
+    }
+    return ORSF::from_json(j);
+}
+
+void write_orsf_json(const ORSF& orsf, ByteBuffer& out, int indent) {
+    try {
+        json j = orsf.to_json();
+
+        // operator<< prints compact at width 0, where dump(0) breaks lines
+        if (indent == 0) {
+            out.append(std::string_view(j.dump(0)));
+            return;
+        }
+
+        // badbit rethrows a failed append instead of swallowing it
+        ByteBufferStreambuf buffer(out);
+        std::ostream stream(&buffer);
+        stream.exceptions(std::ios::badbit);
+        stream << std::setw(std::max(indent, 0)) << j;
+    } catch (const json::exception& e) {
+        throw std::runtime_error(std::string("Failed to serialize ORSF: ") + e.what());
+    }
+}
+
+} // namespace orsf
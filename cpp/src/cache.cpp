@@ -0,0 +1,191 @@
+#include "orsf/cache.hpp"
+#include "orsf/instrument.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace orsf {
+
+namespace {
+
+// FNV-1a over canonical bytes
+class CanonicalHasher {
+public:
+    void bytes(const void* data, size_t size) {
+        const auto* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            state_ ^= p[i];
+            state_ *= 0x100000001b3ULL;
+        }
+    }
+
+    void tag(char t) { bytes(&t, 1); }
+
+    void u64(uint64_t value) { bytes(&value, sizeof(value)); }
+
+    void number(double value) {
+        if (std::isnan(value)) value = std::numeric_limits<double>::quiet_NaN();
+        if (value == 0.0) value = 0.0;  // -0 -> +0
+
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        u64(bits);
+    }
+
+    void text(const std::string& value) {
+        u64(value.size());
+        bytes(value.data(), value.size());
+    }
+
+    void value(const json& j) {
+        switch (j.type()) {
+            case json::value_t::null:
+                tag('n');
+                break;
+            case json::value_t::boolean:
+                tag(j.get<bool>() ? 't' : 'f');
+                break;
+            case json::value_t::number_integer:
+            case json::value_t::number_unsigned:
+            case json::value_t::number_float:
+                tag('d');
+                number(j.get<double>());
+                break;
+            case json::value_t::string:
+                tag('s');
+                text(j.get_ref<const std::string&>());
+                break;
+            case json::value_t::array:
+                tag('[');
+                u64(j.size());
+                for (const auto& element : j) value(element);
+                break;
+            case json::value_t::object:
+                // nlohmann::json objects iterate in sorted key order
+                tag('{');
+                u64(j.size());
+                for (const auto& [key, element] : j.items()) {
+                    text(key);
+                    value(element);
+                }
+                break;
+            case json::value_t::binary:
+                tag('b');
+                u64(j.get_binary().size());
+                bytes(j.get_binary().data(), j.get_binary().size());
+                break;
+            case json::value_t::discarded:
+                tag('x');
+                break;
+        }
+    }
+
+    uint64_t digest() const {
+        // Final avalanche (splitmix64) so low bits are usable as bucket index
+        uint64_t z = state_;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    uint64_t state_ = 0xcbf29ce484222325ULL;
+};
+
+size_t combine(size_t seed, size_t value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+} // namespace
+
+uint64_t content_hash(const ORSF& orsf) {
+    CanonicalHasher hasher;
+    hasher.value(orsf.to_json());
+    return hasher.digest();
+}
+
+// ============================================================================
+// Cache Keys
+// ============================================================================
+
+size_t ValidationCacheKey::Hash::operator()(const ValidationCacheKey& key) const {
+    std::hash<std::string> hash_string;
+    size_t seed = combine(static_cast<size_t>(key.content_hash), key.rule_set_version);
+    seed = combine(seed, hash_string(key.adapter_id));
+    seed = combine(seed, hash_string(key.adapter_version));
+    return combine(seed, hash_string(key.car_key));
+}
+
+size_t ConversionCacheKey::Hash::operator()(const ConversionCacheKey& key) const {
+    std::hash<std::string> hash_string;
+    size_t seed = static_cast<size_t>(key.content_hash);
+    seed = combine(seed, hash_string(key.adapter_id));
+    seed = combine(seed, hash_string(key.adapter_version));
+    return combine(seed, hash_string(key.car_key));
+}
+
+// ============================================================================
+// Result Cache Implementation
+// ============================================================================
+
+ResultCache::ResultCache(size_t validation_capacity, size_t conversion_capacity)
+    : validation_cache_(validation_capacity), conversion_cache_(conversion_capacity) {}
+
+ResultCache::Errors ResultCache::validate(const ORSF& orsf, uint32_t rule_set_version) {
+    return validation(ValidationCacheKey{content_hash(orsf), rule_set_version, {}, {}, {}},
+        [&] { return Validator::validate(orsf); });
+}
+
+ResultCache::Errors ResultCache::validate(const Adapter& adapter, const ORSF& orsf, uint32_t rule_set_version) {
+    ValidationCacheKey key{content_hash(orsf), rule_set_version,
+        adapter.get_id(), adapter.get_version(), adapter.get_car_key()};
+    return validation(key,
+        [&] {
+            ORSF_STAGE(stage, AdapterValidate);
+            return adapter.validate_orsf(orsf);
+        });
+}
+
+ResultCache::Bytes ResultCache::orsf_to_native(const Adapter& adapter, const ORSF& orsf) {
+    ConversionCacheKey key{content_hash(orsf), adapter.get_id(), adapter.get_version(), adapter.get_car_key()};
+    return conversion(key, [&] {
+        ORSF_STAGE(stage, AdapterEncode);
+        auto bytes = adapter.orsf_to_native(orsf);
+        ORSF_STAGE_BYTES(stage, bytes.size());
+        return bytes;
+    });
+}
+
+ResultCache::Errors ResultCache::validation(
+    const ValidationCacheKey& key,
+    const std::function<std::vector<ValidationError>()>& compute
+) {
+    if (auto cached = validation_cache_.get(key)) {
+        return *cached;
+    }
+
+    // Computed outside the lock; concurrent misses on one key may both compute
+    auto result = std::make_shared<const std::vector<ValidationError>>(compute());
+    validation_cache_.put(key, result);
+    return result;
+}
+
+ResultCache::Bytes ResultCache::conversion(
+    const ConversionCacheKey& key,
+    const std::function<std::vector<uint8_t>()>& compute
+) {
+    if (auto cached = conversion_cache_.get(key)) {
+        return *cached;
+    }
+
+    auto result = std::make_shared<const std::vector<uint8_t>>(compute());
+    conversion_cache_.put(key, result);
+    return result;
+}
+
+void ResultCache::clear() {
+    validation_cache_.clear();
+    conversion_cache_.clear();
+}
+
+} // namespace orsf
@@ -0,0 +1,447 @@
+#include "orsf/columnar.hpp"
+#include "orsf/mapping.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ORSF_COLUMNAR_SSE2 1
+#endif
+
+namespace orsf {
+
+namespace {
+
+size_t word_count(size_t bits) {
+    return (bits + 63) / 64;
+}
+
+int popcount64(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    while (word) {
+        word &= word - 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+int lowest_bit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int index = 0;
+    while (!(word & 1u)) {
+        word >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// Violation mask for (v < lo || v > hi) over up to 64 values.
+// Ordered compares: NaN never sets a bit.
+uint64_t range_mask(const double* v, size_t n, double lo, double hi) {
+    uint64_t mask = 0;
+    size_t i = 0;
+
+#if defined(__AVX__)
+    const __m256d vlo = _mm256_set1_pd(lo);
+    const __m256d vhi = _mm256_set1_pd(hi);
+    for (; i + 4 <= n; i += 4) {
+        const __m256d x = _mm256_loadu_pd(v + i);
+        const __m256d bad = _mm256_or_pd(
+            _mm256_cmp_pd(x, vlo, _CMP_LT_OQ),
+            _mm256_cmp_pd(x, vhi, _CMP_GT_OQ));
+        mask |= static_cast<uint64_t>(_mm256_movemask_pd(bad)) << i;
+    }
+#elif defined(ORSF_COLUMNAR_SSE2)
+    const __m128d vlo = _mm_set1_pd(lo);
+    const __m128d vhi = _mm_set1_pd(hi);
+    for (; i + 2 <= n; i += 2) {
+        const __m128d x = _mm_loadu_pd(v + i);
+        const __m128d bad = _mm_or_pd(_mm_cmplt_pd(x, vlo), _mm_cmpgt_pd(x, vhi));
+        mask |= static_cast<uint64_t>(_mm_movemask_pd(bad)) << i;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        mask |= static_cast<uint64_t>(v[i] < lo || v[i] > hi) << i;
+    }
+    return mask;
+}
+
+// Violation mask for (v <= threshold) over up to 64 values
+uint64_t at_most_mask(const double* v, size_t n, double threshold) {
+    uint64_t mask = 0;
+    size_t i = 0;
+
+#if defined(__AVX__)
+    const __m256d vt = _mm256_set1_pd(threshold);
+    for (; i + 4 <= n; i += 4) {
+        const __m256d bad = _mm256_cmp_pd(_mm256_loadu_pd(v + i), vt, _CMP_LE_OQ);
+        mask |= static_cast<uint64_t>(_mm256_movemask_pd(bad)) << i;
+    }
+#elif defined(ORSF_COLUMNAR_SSE2)
+    const __m128d vt = _mm_set1_pd(threshold);
+    for (; i + 2 <= n; i += 2) {
+        const __m128d bad = _mm_cmple_pd(_mm_loadu_pd(v + i), vt);
+        mask |= static_cast<uint64_t>(_mm_movemask_pd(bad)) << i;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        mask |= static_cast<uint64_t>(v[i] <= threshold) << i;
+    }
+    return mask;
+}
+
+} // namespace
+
+// ============================================================================
+// Bitmap Implementation
+// ============================================================================
+
+Bitmap::Bitmap(size_t size, bool value)
+    : words_(word_count(size), value ? ~uint64_t(0) : 0), size_(size) {
+    // Keep bits past size() clear so count() and operators stay exact
+    if (value && (size & 63)) {
+        words_.back() = (uint64_t(1) << (size & 63)) - 1;
+    }
+}
+
+size_t Bitmap::count() const {
+    size_t total = 0;
+    for (uint64_t word : words_) {
+        total += popcount64(word);
+    }
+    return total;
+}
+
+bool Bitmap::none() const {
+    return std::all_of(words_.begin(), words_.end(), [](uint64_t w) { return w == 0; });
+}
+
+std::vector<size_t> Bitmap::indices() const {
+    std::vector<size_t> result;
+    result.reserve(count());
+
+    for (size_t w = 0; w < words_.size(); ++w) {
+        uint64_t word = words_[w];
+        while (word) {
+            result.push_back(w * 64 + lowest_bit(word));
+            word &= word - 1;
+        }
+    }
+
+    return result;
+}
+
+Bitmap& Bitmap::operator|=(const Bitmap& other) {
+    if (other.size_ != size_) {
+        throw std::runtime_error("Bitmap size mismatch");
+    }
+    for (size_t i = 0; i < words_.size(); ++i) {
+        words_[i] |= other.words_[i];
+    }
+    return *this;
+}
+
+Bitmap& Bitmap::operator&=(const Bitmap& other) {
+    if (other.size_ != size_) {
+        throw std::runtime_error("Bitmap size mismatch");
+    }
+    for (size_t i = 0; i < words_.size(); ++i) {
+        words_[i] &= other.words_[i];
+    }
+    return *this;
+}
+
+// ============================================================================
+// Setup Columns Implementation
+// ============================================================================
+
+SetupColumns SetupColumns::from_setups(
+    const std::vector<ORSF>& setups,
+    const std::vector<std::string>& fields
+) {
+    InlineExecutor executor;
+    return from_setups(setups, fields, executor);
+}
+
+SetupColumns SetupColumns::from_setups(
+    const std::vector<ORSF>& setups,
+    const std::vector<std::string>& fields,
+    Executor& executor
+) {
+    std::vector<FieldGetter> getters;
+    getters.reserve(fields.size());
+    for (const auto& field : fields) {
+        FieldGetter getter = MappingEngine::find_getter(field);
+        if (getter == nullptr) {
+            throw std::runtime_error("Unknown numeric field: " + field);
+        }
+        getters.push_back(getter);
+    }
+
+    std::vector<DoubleColumn> columns(fields.size());
+    executor.parallel_for(fields.size(), [&](size_t index, size_t) {
+        DoubleColumn& column = columns[index];
+        column.field = fields[index];
+        column.values.assign(setups.size(), 0.0);
+        column.validity = Bitmap(setups.size());
+
+        for (size_t row = 0; row < setups.size(); ++row) {
+            auto value = getters[index](setups[row]);
+            if (value.has_value()) {
+                column.values[row] = value.value();
+                column.validity.set(row);
+            }
+        }
+    });
+
+    SetupColumns result;
+    result.rows_ = setups.size();
+    for (auto& column : columns) {
+        result.add_column(std::move(column));
+    }
+    return result;
+}
+
+SetupColumns SetupColumns::from_setups(const std::vector<ORSF>& setups) {
+    return from_setups(setups, MappingEngine::numeric_field_paths());
+}
+
+void SetupColumns::add_column(DoubleColumn column) {
+    if (columns_.empty()) {
+        rows_ = column.values.size();
+    }
+
+    if (column.values.size() != rows_ || column.validity.size() != rows_) {
+        throw std::runtime_error("Column size mismatch for field: " + column.field);
+    }
+
+    auto it = index_.find(column.field);
+    if (it != index_.end()) {
+        columns_[it->second] = std::move(column);
+        return;
+    }
+
+    index_.emplace(column.field, columns_.size());
+    columns_.push_back(std::move(column));
+}
+
+const DoubleColumn* SetupColumns::find(const std::string& field) const {
+    auto it = index_.find(field);
+    return it != index_.end() ? &columns_[it->second] : nullptr;
+}
+
+// ============================================================================
+// Column Rule Implementation
+// ============================================================================
+
+ColumnRule ColumnRule::range(const std::string& field, double min, double max,
+                             ValidationSeverity severity) {
+    return ColumnRule{field, ColumnCheck::Range, min, max, severity};
+}
+
+ColumnRule ColumnRule::positive(const std::string& field) {
+    return ColumnRule{field, ColumnCheck::Positive, 0.0, std::numeric_limits<double>::infinity(),
+                      ValidationSeverity::Error};
+}
+
+ColumnRule ColumnRule::non_negative(const std::string& field) {
+    return ColumnRule{field, ColumnCheck::NonNegative, 0.0, std::numeric_limits<double>::infinity(),
+                      ValidationSeverity::Error};
+}
+
+ColumnRule ColumnRule::percentage(const std::string& field) {
+    return ColumnRule{field, ColumnCheck::Percentage, 0.0, 100.0, ValidationSeverity::Error};
+}
+
+bool ColumnRule::violates(double value) const {
+    switch (check) {
+        case ColumnCheck::Range:       return value < min || value > max;
+        case ColumnCheck::Positive:    return value <= 0.0;
+        case ColumnCheck::NonNegative: return value < 0.0;
+        case ColumnCheck::Percentage:  return value < 0.0 || value > 100.0;
+    }
+    return false;
+}
+
+void ColumnRule::check_value(double value, std::vector<ValidationError>& errors) const {
+    switch (check) {
+        case ColumnCheck::Range:
+            Validator::check_range(field, value, min, max, errors, severity);
+            break;
+        case ColumnCheck::Positive:
+            Validator::check_positive(field, value, errors);
+            break;
+        case ColumnCheck::NonNegative:
+            Validator::check_non_negative(field, value, errors);
+            break;
+        case ColumnCheck::Percentage:
+            Validator::check_percentage(field, value, errors);
+            break;
+    }
+}
+
+// ============================================================================
+// Columnar Validator Implementation
+// ============================================================================
+
+ColumnarValidator::ColumnarValidator(std::vector<ColumnRule> rules)
+    : rules_(std::move(rules)) {}
+
+std::vector<ColumnRule> ColumnarValidator::default_rules() {
+    std::vector<ColumnRule> rules = {
+        // Context
+        ColumnRule::range("context.ambient_temp_c", -50.0, 70.0, ValidationSeverity::Warning),
+        ColumnRule::range("context.track_temp_c", -20.0, 80.0, ValidationSeverity::Warning),
+        ColumnRule::range("context.wetness", 0.0, 1.0),
+
+        // Aerodynamics
+        ColumnRule::positive("setup.aero.front_ride_height_mm"),
+        ColumnRule::positive("setup.aero.rear_ride_height_mm"),
+        ColumnRule::percentage("setup.aero.brake_duct_front_pct"),
+        ColumnRule::percentage("setup.aero.brake_duct_rear_pct"),
+        ColumnRule::percentage("setup.aero.radiator_opening_pct"),
+        ColumnRule::non_negative("setup.aero.front_downforce_n"),
+        ColumnRule::non_negative("setup.aero.rear_downforce_n"),
+    };
+
+    // Suspension corners
+    for (const char* corner : {"front_left", "front_right", "rear_left", "rear_right"}) {
+        const std::string prefix = std::string("setup.suspension.") + corner;
+        rules.push_back(ColumnRule::range(prefix + ".camber_deg", -10.0, 5.0, ValidationSeverity::Warning));
+        rules.push_back(ColumnRule::positive(prefix + ".spring_rate_n_mm"));
+        rules.push_back(ColumnRule::positive(prefix + ".ride_height_mm"));
+        rules.push_back(ColumnRule::non_negative(prefix + ".bumpstop_gap_mm"));
+        rules.push_back(ColumnRule::positive(prefix + ".bumpstop_rate_n_mm"));
+        rules.push_back(ColumnRule::non_negative(prefix + ".damper_bump_slow_n_s_m"));
+        rules.push_back(ColumnRule::non_negative(prefix + ".damper_bump_fast_n_s_m"));
+        rules.push_back(ColumnRule::non_negative(prefix + ".damper_rebound_slow_n_s_m"));
+        rules.push_back(ColumnRule::non_negative(prefix + ".damper_rebound_fast_n_s_m"));
+    }
+
+    rules.insert(rules.end(), {
+        ColumnRule::positive("setup.suspension.heave_spring_n_mm"),
+
+        // Tires
+        ColumnRule::range("setup.tires.pressure_fl_kpa", 50.0, 400.0, ValidationSeverity::Warning),
+        ColumnRule::range("setup.tires.pressure_fr_kpa", 50.0, 400.0, ValidationSeverity::Warning),
+        ColumnRule::range("setup.tires.pressure_rl_kpa", 50.0, 400.0, ValidationSeverity::Warning),
+        ColumnRule::range("setup.tires.pressure_rr_kpa", 50.0, 400.0, ValidationSeverity::Warning),
+
+        // Drivetrain
+        ColumnRule::non_negative("setup.drivetrain.diff_preload_nm"),
+        ColumnRule::percentage("setup.drivetrain.diff_power_ramp_pct"),
+        ColumnRule::percentage("setup.drivetrain.diff_coast_ramp_pct"),
+        ColumnRule::positive("setup.drivetrain.final_drive_ratio"),
+
+        // Gearing
+        ColumnRule::positive("setup.gearing.reverse_ratio"),
+
+        // Brakes
+        ColumnRule::percentage("setup.brakes.brake_bias_pct"),
+        ColumnRule::positive("setup.brakes.max_force_n"),
+
+        // Electronics
+        ColumnRule::positive("setup.electronics.pit_limiter_kph"),
+
+        // Fuel
+        ColumnRule::non_negative("setup.fuel.start_fuel_l"),
+        ColumnRule::positive("setup.fuel.per_lap_consumption_l"),
+    });
+
+    return rules;
+}
+
+std::vector<Bitmap> ColumnarValidator::evaluate(const SetupColumns& columns) const {
+    InlineExecutor executor;
+    return evaluate(columns, executor);
+}
+
+std::vector<Bitmap> ColumnarValidator::evaluate(const SetupColumns& columns, Executor& executor) const {
+    std::vector<Bitmap> result(rules_.size());
+
+    executor.parallel_for(rules_.size(), [&](size_t index, size_t) {
+        const ColumnRule& rule = rules_[index];
+        const DoubleColumn* column = columns.find(rule.field);
+        result[index] = column == nullptr ? Bitmap(columns.rows()) : evaluate_rule(rule, *column);
+    });
+
+    return result;
+}
+
+Bitmap ColumnarValidator::evaluate_rule(const ColumnRule& rule, const DoubleColumn& column) {
+    const size_t rows = column.values.size();
+    Bitmap result(rows);
+
+    const double* values = column.values.data();
+    const auto& validity = column.validity.words();
+    auto& out = result.words();
+
+    for (size_t w = 0; w < out.size(); ++w) {
+        const size_t begin = w * 64;
+        const size_t n = std::min<size_t>(64, rows - begin);
+
+        // Skip blocks without any present value
+        if (validity[w] == 0) continue;
+
+        uint64_t mask = 0;
+        switch (rule.check) {
+            case ColumnCheck::Range:
+                mask = range_mask(values + begin, n, rule.min, rule.max);
+                break;
+            case ColumnCheck::Positive:
+                mask = at_most_mask(values + begin, n, 0.0);
+                break;
+            case ColumnCheck::NonNegative:
+                mask = range_mask(values + begin, n, 0.0, std::numeric_limits<double>::infinity());
+                break;
+            case ColumnCheck::Percentage:
+                mask = range_mask(values + begin, n, 0.0, 100.0);
+                break;
+        }
+
+        out[w] = mask & validity[w];
+    }
+
+    return result;
+}
+
+Bitmap ColumnarValidator::any_violation(const std::vector<Bitmap>& violations, size_t rows) {
+    Bitmap result(rows);
+    for (const auto& bitmap : violations) {
+        result |= bitmap;
+    }
+    return result;
+}
+
+std::vector<ValidationError> ColumnarValidator::errors_for_row(
+    const SetupColumns& columns,
+    const std::vector<Bitmap>& violations,
+    size_t row
+) const {
+    std::vector<ValidationError> errors;
+
+    for (size_t i = 0; i < rules_.size() && i < violations.size(); ++i) {
+        if (!violations[i].test(row)) continue;
+
+        const DoubleColumn* column = columns.find(rules_[i].field);
+        if (column != nullptr) {
+            rules_[i].check_value(column->values[row], errors);
+        }
+    }
+
+    return errors;
+}
+
+} // namespace orsf
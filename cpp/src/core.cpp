@@ -1,9 +1,12 @@
 #include "orsf/core.hpp"
+#include "orsf/instrument.hpp"
 #include <stdexcept>
 
 namespace orsf {
 
 ORSF ORSF::from_json(const std::string& json_str) {
+    ORSF_STAGE(stage, Parse);
+    ORSF_STAGE_BYTES(stage, json_str.size());
     try {
         json j = json::parse(json_str);
         return from_json(j);
@@ -13,6 +16,7 @@ ORSF ORSF::from_json(const std::string& json_str) {
 }
 
 ORSF ORSF::from_json(const json& j) {
+    ORSF_STAGE(stage, Parse);
     try {
         ORSF orsf;
         j.get_to(orsf);
@@ -29,9 +33,12 @@ ORSF ORSF::from_json(const json& j) {
 }
 
 std::string ORSF::to_json_string(int indent) const {
+    ORSF_STAGE(stage, Serialize);
     try {
         json j = to_json();
-        return j.dump(indent);
+        std::string text = j.dump(indent);
+        ORSF_STAGE_BYTES(stage, text.size());
+        return text;
     } catch (const json::exception& e) {
         throw std::runtime_error(std::string("Failed to serialize ORSF: ") + e.what());
     }
@@ -0,0 +1,131 @@
+#include "orsf/detect.hpp"
+#include <cctype>
+#include <deque>
+
+namespace orsf {
+
+// ============================================================================
+// Signature Matcher Implementation
+// ============================================================================
+
+SignatureMatcher::SignatureMatcher(const std::vector<std::string>& patterns) {
+    lengths_.reserve(patterns.size());
+    for (const auto& pattern : patterns) {
+        lengths_.push_back(pattern.size());
+    }
+
+    // Class 0 stands for every byte that occurs in no pattern
+    class_count_ = 1;
+    for (const auto& pattern : patterns) {
+        for (char c : pattern) {
+            uint8_t byte = static_cast<uint8_t>(c);
+            if (byte_class_[byte] == 0) {
+                byte_class_[byte] = static_cast<uint16_t>(class_count_++);
+            }
+        }
+    }
+
+    // Trie (missing edges are NONE until the automaton is completed)
+    constexpr uint32_t NONE = static_cast<uint32_t>(-1);
+    std::vector<uint32_t> next(class_count_, NONE);
+    std::vector<std::vector<uint32_t>> ends(1);
+
+    for (size_t p = 0; p < patterns.size(); ++p) {
+        if (patterns[p].empty()) continue;
+
+        uint32_t state = 0;
+        for (char c : patterns[p]) {
+            size_t edge = state * class_count_ + byte_class_[static_cast<uint8_t>(c)];
+            if (next[edge] == NONE) {
+                next[edge] = static_cast<uint32_t>(ends.size());
+                ends.emplace_back();
+                next.resize(next.size() + class_count_, NONE);
+            }
+            state = next[edge];
+        }
+        ends[state].push_back(static_cast<uint32_t>(p));
+    }
+
+    // Breadth-first: fill missing edges from the failure state, and inherit
+    // the failure state's outputs (it is always processed first)
+    const size_t states = ends.size();
+    std::vector<uint32_t> fail(states, 0);
+    std::deque<uint32_t> queue;
+
+    for (size_t c = 0; c < class_count_; ++c) {
+        uint32_t& target = next[c];
+        if (target == NONE) {
+            target = 0;
+        } else {
+            queue.push_back(target);
+        }
+    }
+
+    while (!queue.empty()) {
+        uint32_t state = queue.front();
+        queue.pop_front();
+        ends[state].insert(ends[state].end(), ends[fail[state]].begin(), ends[fail[state]].end());
+
+        for (size_t c = 0; c < class_count_; ++c) {
+            uint32_t& target = next[state * class_count_ + c];
+            uint32_t fallback = next[fail[state] * class_count_ + c];
+            if (target == NONE) {
+                target = fallback;
+            } else {
+                fail[target] = fallback;
+                queue.push_back(target);
+            }
+        }
+    }
+
+    transitions_ = std::move(next);
+    output_begin_.reserve(states + 1);
+    for (const auto& state_ends : ends) {
+        output_begin_.push_back(static_cast<uint32_t>(outputs_.size()));
+        outputs_.insert(outputs_.end(), state_ends.begin(), state_ends.end());
+    }
+    output_begin_.push_back(static_cast<uint32_t>(outputs_.size()));
+}
+
+void SignatureMatcher::scan(ByteSpan data, std::vector<SignatureMatch>& matches) const {
+    if (outputs_.empty()) return;
+
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
+    uint32_t state = 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        state = transitions_[state * class_count_ + byte_class_[bytes[i]]];
+        for (uint32_t o = output_begin_[state]; o < output_begin_[state + 1]; ++o) {
+            uint32_t pattern = outputs_[o];
+            matches.push_back(SignatureMatch{pattern, i + 1 - lengths_[pattern]});
+        }
+    }
+}
+
+// ============================================================================
+// File Extensions
+// ============================================================================
+
+std::string normalize_extension(std::string_view extension) {
+    if (!extension.empty() && extension.front() == '.') {
+        extension.remove_prefix(1);
+    }
+
+    std::string result(extension);
+    for (char& c : result) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return result;
+}
+
+std::string file_extension(std::string_view filename) {
+    size_t separator = filename.find_last_of("/\\");
+    if (separator != std::string_view::npos) {
+        filename.remove_prefix(separator + 1);
+    }
+
+    size_t dot = filename.rfind('.');
+    if (dot == std::string_view::npos || dot == 0) return {};
+    return normalize_extension(filename.substr(dot + 1));
+}
+
+} // namespace orsf
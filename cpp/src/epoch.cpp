@@ -0,0 +1,41 @@
+#include "orsf/epoch.hpp"
+#include <thread>
+
+namespace orsf {
+
+// ============================================================================
+// Reader Epochs Implementation
+// ============================================================================
+
+ReaderEpochs::Section::Section(ReaderEpochs& epochs) noexcept {
+    unsigned epoch = epochs.epoch_.load(std::memory_order_seq_cst);
+    stripe_ = &epochs.stripes_[epoch][stripe_index()].readers;
+    stripe_->fetch_add(1, std::memory_order_seq_cst);
+}
+
+void ReaderEpochs::synchronize() {
+    std::lock_guard<std::mutex> lock(writers_);
+    for (int flip = 0; flip < 2; ++flip) {
+        unsigned previous = epoch_.load(std::memory_order_relaxed);
+        epoch_.store(previous ^ 1u, std::memory_order_seq_cst);
+        for (const Stripe& stripe : stripes_[previous]) {
+            while (stripe.readers.load(std::memory_order_acquire) != 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+ReaderEpochs& ReaderEpochs::shared() {
+    // Never destroyed, so values published during static destruction stay safe
+    static ReaderEpochs* epochs = new ReaderEpochs();
+    return *epochs;
+}
+
+size_t ReaderEpochs::stripe_index() {
+    static std::atomic<size_t> next{0};
+    thread_local const size_t index = next.fetch_add(1, std::memory_order_relaxed) % STRIPES;
+    return index;
+}
+
+} // namespace orsf
@@ -0,0 +1,267 @@
+#include "orsf/executor.hpp"
+#include <algorithm>
+
+namespace orsf {
+
+namespace {
+
+// Set while a thread runs pool work (nested parallel_for runs inline)
+thread_local bool in_pool_body = false;
+
+constexpr uint64_t pack(uint64_t begin, uint64_t end) { return (begin << 32) | end; }
+constexpr size_t slice_begin(uint64_t bounds) { return static_cast<size_t>(bounds >> 32); }
+constexpr size_t slice_end(uint64_t bounds) { return static_cast<size_t>(bounds & 0xffffffffULL); }
+
+constexpr size_t MAX_CHUNK = 0xffffffffULL;
+
+std::mutex default_mutex;
+std::shared_ptr<Executor> installed_executor;
+
+} // namespace
+
+// ============================================================================
+// Inline Executor Implementation
+// ============================================================================
+
+void InlineExecutor::parallel_for(size_t count, const Body& body) {
+    for (size_t i = 0; i < count; ++i) {
+        body(i, 0);
+    }
+}
+
+// ============================================================================
+// Thread Pool Executor Implementation
+// ============================================================================
+
+struct ThreadPoolExecutor::Job {
+    Job(const Body& body, size_t workers) : body(body), slices(new Slice[workers]) {}
+
+    const Body& body;
+    std::unique_ptr<Slice[]> slices;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;               ///< Guarded by mutex_
+    size_t active = 0;                      ///< Pool threads inside, guarded by mutex_
+    bool drained = false;                   ///< No index left to hand out, guarded by mutex_
+};
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t threads)
+    : worker_count_(threads > 0 ? threads : std::max<size_t>(1, std::thread::hardware_concurrency())) {
+    threads_.reserve(worker_count_ - 1);
+    for (size_t worker = 1; worker < worker_count_; ++worker) {
+        threads_.emplace_back([this, worker] { worker_loop(worker); });
+    }
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void ThreadPoolExecutor::parallel_for(size_t count, const Body& body) {
+    if (count == 0) return;
+
+    // Nested or single-worker loops run inline
+    if (in_pool_body || worker_count_ == 1 || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            body(i, 0);
+        }
+        return;
+    }
+
+    for (size_t base = 0; base < count; base += MAX_CHUNK) {
+        size_t chunk = std::min(MAX_CHUNK, count - base);
+        if (base == 0) {
+            run_chunk(body, chunk);
+        } else {
+            run_chunk([&body, base](size_t index, size_t worker) { body(base + index, worker); }, chunk);
+        }
+    }
+}
+
+void ThreadPoolExecutor::run_chunk(const Body& body, size_t count) {
+    // Equal slices per worker
+    Job job(body, worker_count_);
+    for (size_t worker = 0; worker < worker_count_; ++worker) {
+        size_t first = count * worker / worker_count_;
+        size_t last = count * (worker + 1) / worker_count_;
+        job.slices[worker].bounds.store(pack(first, last), std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(&job);
+    }
+    wake_.notify_all();
+
+    run_slices(job, 0);
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &job));
+        done_.wait(lock, [&job] { return job.active == 0; });
+        error = job.error;
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+ThreadPoolExecutor::Job* ThreadPoolExecutor::pick_job() const {
+    // Spread pool threads over concurrent loops
+    Job* best = nullptr;
+    for (Job* job : jobs_) {
+        if (job->drained) continue;
+        if (best == nullptr || job->active < best->active) best = job;
+    }
+    return best;
+}
+
+void ThreadPoolExecutor::worker_loop(size_t worker) {
+    for (;;) {
+        Job* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stopping_ || (job = pick_job()) != nullptr; });
+            if (stopping_) return;
+            ++job->active;
+        }
+
+        run_slices(*job, worker);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--job->active == 0) {
+            done_.notify_all();
+        }
+    }
+}
+
+void ThreadPoolExecutor::run_slices(Job& job, size_t worker) {
+    in_pool_body = true;
+    size_t index = 0;
+    while (!job.failed.load(std::memory_order_relaxed) &&
+           (take(job, worker, index) || (steal(job, worker) && take(job, worker, index)))) {
+        try {
+            job.body(index, worker);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!job.error) job.error = std::current_exception();
+            job.failed = true;
+        }
+    }
+    in_pool_body = false;
+
+    // Every slice was empty when stealing gave up; a thief still holding
+    // stolen indices runs them itself, so newcomers would find nothing
+    std::lock_guard<std::mutex> lock(mutex_);
+    job.drained = true;
+}
+
+bool ThreadPoolExecutor::take(Job& job, size_t worker, size_t& index) {
+    std::atomic<uint64_t>& bounds = job.slices[worker].bounds;
+    uint64_t current = bounds.load(std::memory_order_acquire);
+    for (;;) {
+        size_t begin = slice_begin(current);
+        size_t end = slice_end(current);
+        if (begin >= end) return false;
+
+        if (bounds.compare_exchange_weak(current, pack(begin + 1, end), std::memory_order_acq_rel)) {
+            index = begin;
+            return true;
+        }
+    }
+}
+
+bool ThreadPoolExecutor::steal(Job& job, size_t worker) {
+    // Start at a per-thread pseudo-random victim to spread contention
+    thread_local uint64_t state = 0x9e3779b97f4a7c15ULL ^ reinterpret_cast<uintptr_t>(&state);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    size_t start = static_cast<size_t>(state % worker_count_);
+
+    for (size_t offset = 0; offset < worker_count_; ++offset) {
+        size_t victim = (start + offset) % worker_count_;
+        if (victim == worker) continue;
+
+        std::atomic<uint64_t>& bounds = job.slices[victim].bounds;
+        uint64_t current = bounds.load(std::memory_order_acquire);
+        for (;;) {
+            size_t begin = slice_begin(current);
+            size_t end = slice_end(current);
+            if (begin >= end) break;
+
+            // Take the back half (at least one index)
+            size_t mid = begin + (end - begin) / 2;
+            if (bounds.compare_exchange_weak(current, pack(begin, mid), std::memory_order_acq_rel)) {
+                job.slices[worker].bounds.store(pack(mid, end), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// Shared Executor Implementation
+// ============================================================================
+
+std::shared_ptr<Executor> default_executor() {
+    std::lock_guard<std::mutex> lock(default_mutex);
+    if (!installed_executor) {
+        installed_executor = std::make_shared<ThreadPoolExecutor>();
+    }
+    return installed_executor;
+}
+
+void set_default_executor(std::shared_ptr<Executor> executor) {
+    std::lock_guard<std::mutex> lock(default_mutex);
+    installed_executor = std::move(executor);
+}
+
+// ============================================================================
+// Task Group Implementation
+// ============================================================================
+
+void TaskGroup::run(Task task) {
+    if (is_cancelled()) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back(std::move(task));
+}
+
+void TaskGroup::wait() {
+    std::vector<Task> round;
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (is_cancelled()) pending_.clear();
+            if (pending_.empty()) break;
+            round.swap(pending_);
+        }
+
+        executor_.parallel_for(round.size(), [&](size_t index, size_t) {
+            if (is_cancelled()) return;
+            try {
+                round[index]();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) error_ = std::current_exception();
+                cancel();
+            }
+        });
+        round.clear();
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::swap(error, error_);
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+} // namespace orsf
@@ -0,0 +1,684 @@
+#include "orsf/file_io.hpp"
+#include "orsf/executor.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(STATX_SIZE)
+#define ORSF_IO_URING 1
+#endif
+#endif
+
+namespace orsf {
+
+namespace {
+
+constexpr size_t MAX_QUEUE_DEPTH = 4096;
+constexpr size_t UNSIZED_READ = 16384;      ///< First read of files that report size 0 (procfs, pipes)
+
+std::string io_error(const char* action, std::string_view path, int error) {
+    return std::string("Failed to ") + action + " " + std::string(path) + ": " + std::strerror(error);
+}
+
+// ============================================================================
+// Blocking I/O (ThreadPool backend)
+// ============================================================================
+
+#ifdef _WIN32
+
+void read_whole_file(const std::string& path, std::vector<uint8_t>& bytes, std::string& error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "Failed to open " + path;
+        return;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (file.bad()) error = "Failed to read " + path;
+}
+
+void write_whole_file(const FileWrite& write, std::string& error) {
+    std::ofstream file(write.path, std::ios::binary | std::ios::trunc);
+    if (!file || !file.write(reinterpret_cast<const char*>(write.data.data()),
+                             static_cast<std::streamsize>(write.data.size()))) {
+        error = "Failed to write " + write.path;
+    }
+}
+
+#else
+
+void read_whole_file(const std::string& path, std::vector<uint8_t>& bytes, std::string& error) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = io_error("open", path, errno);
+        return;
+    }
+
+    struct stat info;
+    size_t expected = ::fstat(fd, &info) == 0 && info.st_size > 0 ? static_cast<size_t>(info.st_size) : 0;
+    bytes.resize(expected > 0 ? expected : UNSIZED_READ);
+
+    size_t filled = 0;
+    for (;;) {
+        if (filled == bytes.size()) {
+            if (expected > 0) break;
+            bytes.resize(bytes.size() * 2);
+        }
+        ssize_t count = ::pread(fd, bytes.data() + filled, bytes.size() - filled, static_cast<off_t>(filled));
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            error = io_error("read", path, errno);
+            break;
+        }
+        if (count == 0) break;
+        filled += static_cast<size_t>(count);
+    }
+    bytes.resize(filled);
+    ::close(fd);
+}
+
+void write_whole_file(const FileWrite& write, std::string& error) {
+    int fd = ::open(write.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        error = io_error("open", write.path, errno);
+        return;
+    }
+
+    size_t written = 0;
+    while (written < write.data.size()) {
+        ssize_t count = ::pwrite(fd, write.data.data() + written, write.data.size() - written,
+                                 static_cast<off_t>(written));
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            error = io_error("write", write.path, errno);
+            break;
+        }
+        written += static_cast<size_t>(count);
+    }
+    if (::close(fd) != 0 && error.empty()) {
+        error = io_error("close", write.path, errno);
+    }
+}
+
+#endif
+
+// ============================================================================
+// io_uring Ring
+// ============================================================================
+
+#ifdef ORSF_IO_URING
+
+/// Submission and completion rings of one io_uring instance (raw syscalls, no liburing)
+class Uring {
+public:
+    /// @return nullptr if the kernel refuses io_uring or lacks an operation we use
+    static std::unique_ptr<Uring> create(unsigned entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) return nullptr;
+
+        std::unique_ptr<Uring> ring(new Uring(fd));
+        if (!ring->map(params) || !ring->supports_file_ops()) return nullptr;
+        return ring;
+    }
+
+    ~Uring() {
+        if (sqes_ != MAP_FAILED) ::munmap(sqes_, sqes_size_);
+        if (cq_ptr_ != MAP_FAILED && cq_ptr_ != sq_ptr_) ::munmap(cq_ptr_, cq_size_);
+        if (sq_ptr_ != MAP_FAILED) ::munmap(sq_ptr_, sq_size_);
+        ::close(fd_);
+    }
+
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+
+    /// Zeroed submission entry, queued with the next submit()
+    io_uring_sqe& next_sqe() {
+        unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        if (tail_ - head >= sq_entries_) {
+            submit(0);
+            head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        }
+        unsigned index = tail_ & *sq_mask_;
+        io_uring_sqe& sqe = sqes_[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sq_array_[index] = index;
+        ++tail_;
+        ++pending_;
+        return sqe;
+    }
+
+    /// Hand queued entries to the kernel and wait for at least wait_for completions
+    void submit(unsigned wait_for) {
+        __atomic_store_n(sq_tail_, tail_, __ATOMIC_RELEASE);
+        do {
+            unsigned flags = wait_for > 0 ? IORING_ENTER_GETEVENTS : 0;
+            long submitted = ::syscall(__NR_io_uring_enter, fd_, pending_, wait_for, flags, nullptr, 0);
+            if (submitted < 0) {
+                if (errno == EINTR || errno == EAGAIN || errno == EBUSY) continue;
+                throw std::runtime_error(std::string("io_uring_enter failed: ") + std::strerror(errno));
+            }
+            pending_ -= static_cast<unsigned>(submitted);
+            wait_for = 0;
+        } while (pending_ > 0);
+    }
+
+    /// Call handler(user_data, result) for every available completion
+    template <typename Handler>
+    void drain(Handler&& handler) {
+        unsigned head = *cq_head_;
+        for (;;) {
+            unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+            if (head == tail) break;
+            const io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+            uint64_t user_data = cqe.user_data;
+            int32_t result = cqe.res;
+            __atomic_store_n(cq_head_, ++head, __ATOMIC_RELEASE);
+            handler(user_data, result);
+        }
+    }
+
+private:
+    int fd_;
+    void* sq_ptr_ = MAP_FAILED;
+    void* cq_ptr_ = MAP_FAILED;
+    size_t sq_size_ = 0;
+    size_t cq_size_ = 0;
+    io_uring_sqe* sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqes_size_ = 0;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_mask_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_entries_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned* cq_mask_ = nullptr;
+    io_uring_cqe* cqes_ = nullptr;
+
+    unsigned tail_ = 0;         ///< Local submission tail (published by submit)
+    unsigned pending_ = 0;      ///< Entries queued but not yet consumed by the kernel
+
+    explicit Uring(int fd) : fd_(fd) {}
+
+    bool map(const io_uring_params& params) {
+        sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+
+        sq_ptr_ = ::mmap(nullptr, sq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+        if (sq_ptr_ == MAP_FAILED) return false;
+        cq_ptr_ = single ? sq_ptr_
+                         : ::mmap(nullptr, cq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+        if (cq_ptr_ == MAP_FAILED) return false;
+
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) return false;
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        auto* sq = static_cast<char*>(sq_ptr_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sq_entries_ = params.sq_entries;
+        tail_ = *sq_tail_;
+
+        auto* cq = static_cast<char*>(cq_ptr_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    bool supports_file_ops() const {
+        constexpr unsigned OPS = 256;
+        std::vector<uint8_t> storage(sizeof(io_uring_probe) + OPS * sizeof(io_uring_probe_op), 0);
+        auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+        if (::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe, OPS) < 0) return false;
+
+        for (unsigned op : {IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE}) {
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) return false;
+        }
+        return true;
+    }
+};
+
+/// Operation of a completion, in the low bits of user_data (slot index above)
+enum RingOp : uint64_t { OP_OPEN, OP_STATX, OP_READ, OP_WRITE, OP_CLOSE };
+constexpr unsigned OP_BITS = 3;
+
+uint64_t tag(size_t slot, RingOp op) { return (static_cast<uint64_t>(slot) << OP_BITS) | op; }
+
+unsigned ring_entries(size_t depth) {
+    // Up to two requests per file in flight (open + statx)
+    unsigned entries = 1;
+    while (entries < depth * 2) entries *= 2;
+    return entries;
+}
+
+void queue_open(Uring& ring, size_t slot, const std::string& path, int flags, unsigned mode) {
+    io_uring_sqe& sqe = ring.next_sqe();
+    sqe.opcode = IORING_OP_OPENAT;
+    sqe.fd = AT_FDCWD;
+    sqe.addr = reinterpret_cast<uint64_t>(path.c_str());
+    sqe.len = mode;
+    sqe.open_flags = static_cast<uint32_t>(flags);
+    sqe.user_data = tag(slot, OP_OPEN);
+}
+
+void queue_close(Uring& ring, size_t slot, int fd) {
+    io_uring_sqe& sqe = ring.next_sqe();
+    sqe.opcode = IORING_OP_CLOSE;
+    sqe.fd = fd;
+    sqe.user_data = tag(slot, OP_CLOSE);
+}
+
+/// One file being read through the ring
+struct ReadSlot {
+    int fd = -1;
+    int waiting = 0;                ///< Open and statx completions still expected
+    int error = 0;                  ///< errno of the first failure
+    const char* failed = nullptr;   ///< Action that failed
+    bool sized = false;             ///< statx reported a size
+    size_t filled = 0;
+    std::vector<uint8_t> bytes;
+    struct statx info;
+    FileReadResult result;
+};
+
+void read_with_uring(Uring& ring, size_t depth, const std::vector<std::string>& paths,
+                     std::atomic<bool>& cancelled, const AsyncFileReader::Callback& on_read) {
+    std::vector<ReadSlot> slots(depth);
+    std::vector<size_t> free_slots;
+    for (size_t slot = depth; slot-- > 0;) free_slots.push_back(slot);
+    size_t next = 0;
+    std::exception_ptr callback_error;
+
+    auto fail = [](ReadSlot& s, const char* action, int error) {
+        if (s.error == 0) {
+            s.error = error;
+            s.failed = action;
+        }
+    };
+
+    auto queue_read = [&](size_t slot) {
+        ReadSlot& s = slots[slot];
+        io_uring_sqe& sqe = ring.next_sqe();
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = s.fd;
+        sqe.addr = reinterpret_cast<uint64_t>(s.bytes.data() + s.filled);
+        sqe.len = static_cast<uint32_t>(std::min<size_t>(s.bytes.size() - s.filled, 1u << 30));
+        sqe.off = s.filled;
+        sqe.user_data = tag(slot, OP_READ);
+    };
+
+    // Hand the file to the callback, then close it; the slot is free once closed
+    auto finish = [&](size_t slot) {
+        ReadSlot& s = slots[slot];
+        s.bytes.resize(s.filled);
+        s.result.data.clear();
+        s.result.data.append(std::move(s.bytes));
+        if (s.error != 0) s.result.error = io_error(s.failed, s.result.path, s.error);
+
+        if (!callback_error) {
+            try {
+                on_read(s.result);
+            } catch (...) {
+                callback_error = std::current_exception();
+                cancelled.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        if (s.fd >= 0) {
+            queue_close(ring, slot, s.fd);
+            s.fd = -1;
+        } else {
+            free_slots.push_back(slot);
+        }
+    };
+
+    auto opened = [&](size_t slot) {
+        ReadSlot& s = slots[slot];
+        if (s.error != 0) {
+            finish(slot);
+            return;
+        }
+        s.sized = s.info.stx_size > 0;
+        s.bytes.resize(s.sized ? static_cast<size_t>(s.info.stx_size) : UNSIZED_READ);
+        queue_read(slot);
+    };
+
+    auto complete = [&](uint64_t user_data, int32_t result) {
+        size_t slot = static_cast<size_t>(user_data >> OP_BITS);
+        ReadSlot& s = slots[slot];
+
+        switch (static_cast<RingOp>(user_data & ((1u << OP_BITS) - 1))) {
+        case OP_OPEN:
+            if (result < 0) fail(s, "open", -result);
+            else s.fd = result;
+            if (--s.waiting == 0) opened(slot);
+            break;
+        case OP_STATX:
+            if (result < 0) fail(s, "stat", -result);
+            if (--s.waiting == 0) opened(slot);
+            break;
+        case OP_READ:
+            if (result == -EINTR || result == -EAGAIN) {
+                queue_read(slot);
+            } else if (result < 0) {
+                fail(s, "read", -result);
+                finish(slot);
+            } else if (result == 0) {
+                finish(slot);
+            } else {
+                s.filled += static_cast<size_t>(result);
+                if (s.filled < s.bytes.size()) {
+                    queue_read(slot);
+                } else if (s.sized) {
+                    finish(slot);
+                } else {
+                    s.bytes.resize(s.bytes.size() * 2);
+                    queue_read(slot);
+                }
+            }
+            break;
+        default:
+            free_slots.push_back(slot);
+            break;
+        }
+    };
+
+    for (;;) {
+        while (!free_slots.empty() && next < paths.size() && !cancelled.load(std::memory_order_relaxed)) {
+            size_t slot = free_slots.back();
+            free_slots.pop_back();
+
+            ReadSlot& s = slots[slot];
+            s.fd = -1;
+            s.waiting = 2;
+            s.error = 0;
+            s.failed = nullptr;
+            s.filled = 0;
+            s.result.index = next;
+            s.result.path = paths[next];
+            s.result.error.clear();
+            const std::string& path = paths[next++];
+
+            queue_open(ring, slot, path, O_RDONLY | O_CLOEXEC, 0);
+            io_uring_sqe& sqe = ring.next_sqe();
+            sqe.opcode = IORING_OP_STATX;
+            sqe.fd = AT_FDCWD;
+            sqe.addr = reinterpret_cast<uint64_t>(path.c_str());
+            sqe.len = STATX_SIZE;
+            sqe.off = reinterpret_cast<uint64_t>(&s.info);
+            sqe.user_data = tag(slot, OP_STATX);
+        }
+        if (free_slots.size() == depth) break;
+
+        ring.submit(1);
+        ring.drain(complete);
+    }
+
+    if (callback_error) std::rethrow_exception(callback_error);
+}
+
+/// One file being written through the ring
+struct WriteSlot {
+    int fd = -1;
+    int error = 0;
+    const char* failed = nullptr;
+    size_t index = 0;
+    size_t written = 0;
+};
+
+size_t write_with_uring(Uring& ring, size_t depth, const std::vector<FileWrite>& writes,
+                        const AsyncFileWriter::Callback& on_written) {
+    std::vector<WriteSlot> slots(depth);
+    std::vector<size_t> free_slots;
+    for (size_t slot = depth; slot-- > 0;) free_slots.push_back(slot);
+    size_t next = 0;
+    size_t failures = 0;
+    std::exception_ptr callback_error;
+
+    auto queue_write = [&](size_t slot) {
+        WriteSlot& s = slots[slot];
+        const FileWrite& write = writes[s.index];
+        io_uring_sqe& sqe = ring.next_sqe();
+        sqe.opcode = IORING_OP_WRITE;
+        sqe.fd = s.fd;
+        sqe.addr = reinterpret_cast<uint64_t>(write.data.data() + s.written);
+        sqe.len = static_cast<uint32_t>(std::min<size_t>(write.data.size() - s.written, 1u << 30));
+        sqe.off = s.written;
+        sqe.user_data = tag(slot, OP_WRITE);
+    };
+
+    auto close = [&](size_t slot) {
+        WriteSlot& s = slots[slot];
+        if (s.fd >= 0) {
+            queue_close(ring, slot, s.fd);
+            s.fd = -1;
+            return;
+        }
+
+        // Not opened: report right away
+        std::string error = io_error(s.failed, writes[s.index].path, s.error);
+        ++failures;
+        if (on_written && !callback_error) {
+            try {
+                on_written(s.index, error);
+            } catch (...) {
+                callback_error = std::current_exception();
+            }
+        }
+        free_slots.push_back(slot);
+    };
+
+    auto complete = [&](uint64_t user_data, int32_t result) {
+        size_t slot = static_cast<size_t>(user_data >> OP_BITS);
+        WriteSlot& s = slots[slot];
+
+        switch (static_cast<RingOp>(user_data & ((1u << OP_BITS) - 1))) {
+        case OP_OPEN:
+            if (result < 0) {
+                s.error = -result;
+                s.failed = "open";
+                close(slot);
+            } else {
+                s.fd = result;
+                if (writes[s.index].data.empty()) close(slot);
+                else queue_write(slot);
+            }
+            break;
+        case OP_WRITE:
+            if (result == -EINTR || result == -EAGAIN) {
+                queue_write(slot);
+            } else if (result < 0) {
+                s.error = -result;
+                s.failed = "write";
+                close(slot);
+            } else {
+                s.written += static_cast<size_t>(result);
+                if (s.written < writes[s.index].data.size()) queue_write(slot);
+                else close(slot);
+            }
+            break;
+        default: {
+            if (result < 0 && s.error == 0) {
+                s.error = -result;
+                s.failed = "close";
+            }
+            std::string error = s.error != 0 ? io_error(s.failed, writes[s.index].path, s.error) : std::string();
+            if (!error.empty()) ++failures;
+            if (on_written && !callback_error) {
+                try {
+                    on_written(s.index, error);
+                } catch (...) {
+                    callback_error = std::current_exception();
+                }
+            }
+            free_slots.push_back(slot);
+            break;
+        }
+        }
+    };
+
+    for (;;) {
+        while (!free_slots.empty() && next < writes.size() && !callback_error) {
+            size_t slot = free_slots.back();
+            free_slots.pop_back();
+            slots[slot] = WriteSlot{};
+            slots[slot].index = next;
+            queue_open(ring, slot, writes[next++].path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        }
+        if (free_slots.size() == depth) break;
+
+        ring.submit(1);
+        ring.drain(complete);
+    }
+
+    if (callback_error) std::rethrow_exception(callback_error);
+    return failures;
+}
+
+#endif
+
+IoBackend resolve_backend(IoBackend requested) {
+    if (requested == IoBackend::ThreadPool) return requested;
+    if (io_uring_available()) return IoBackend::IoUring;
+    if (requested == IoBackend::IoUring) {
+        throw std::runtime_error("io_uring is not available");
+    }
+    return IoBackend::ThreadPool;
+}
+
+AsyncIoOptions clamp_options(AsyncIoOptions options) {
+    options.queue_depth = std::min(std::max<size_t>(options.queue_depth, 1), MAX_QUEUE_DEPTH);
+    options.threads = std::max<size_t>(options.threads, 1);
+    return options;
+}
+
+} // namespace
+
+// ============================================================================
+// Backend Selection
+// ============================================================================
+
+const char* io_backend_name(IoBackend backend) {
+    switch (backend) {
+        case IoBackend::Auto:       return "auto";
+        case IoBackend::IoUring:    return "io_uring";
+        case IoBackend::ThreadPool: return "thread_pool";
+    }
+    return "unknown";
+}
+
+bool io_uring_available() {
+#ifdef ORSF_IO_URING
+    static const bool available = Uring::create(2) != nullptr;
+    return available;
+#else
+    return false;
+#endif
+}
+
+// ============================================================================
+// Async File Reader Implementation
+// ============================================================================
+
+AsyncFileReader::AsyncFileReader(AsyncIoOptions options)
+    : options_(clamp_options(options)), backend_(resolve_backend(options.backend)) {}
+
+AsyncFileReader::~AsyncFileReader() = default;
+
+void AsyncFileReader::read_files(const std::vector<std::string>& paths, const Callback& on_read) {
+    cancelled_.store(false, std::memory_order_relaxed);
+    if (paths.empty()) return;
+
+#ifdef ORSF_IO_URING
+    if (backend_ == IoBackend::IoUring) {
+        size_t depth = std::min(options_.queue_depth, paths.size());
+        auto ring = Uring::create(ring_entries(depth));
+        if (!ring) {
+            throw std::runtime_error("Failed to create io_uring");
+        }
+        read_with_uring(*ring, depth, paths, cancelled_, on_read);
+        return;
+    }
+#endif
+
+    ThreadPoolExecutor pool(std::min(options_.threads, paths.size()));
+    std::mutex callback_mutex;
+    pool.parallel_for(paths.size(), [&](size_t index, size_t) {
+        if (cancelled_.load(std::memory_order_relaxed)) return;
+
+        FileReadResult file;
+        file.index = index;
+        file.path = paths[index];
+        std::vector<uint8_t> bytes;
+        read_whole_file(paths[index], bytes, file.error);
+        file.data.append(std::move(bytes));
+
+        std::lock_guard<std::mutex> lock(callback_mutex);
+        on_read(file);
+    });
+}
+
+// ============================================================================
+// Async File Writer Implementation
+// ============================================================================
+
+AsyncFileWriter::AsyncFileWriter(AsyncIoOptions options)
+    : options_(clamp_options(options)), backend_(resolve_backend(options.backend)) {}
+
+AsyncFileWriter::~AsyncFileWriter() = default;
+
+size_t AsyncFileWriter::write_files(const std::vector<FileWrite>& writes, const Callback& on_written) {
+    if (writes.empty()) return 0;
+
+#ifdef ORSF_IO_URING
+    if (backend_ == IoBackend::IoUring) {
+        size_t depth = std::min(options_.queue_depth, writes.size());
+        auto ring = Uring::create(ring_entries(depth));
+        if (!ring) {
+            throw std::runtime_error("Failed to create io_uring");
+        }
+        return write_with_uring(*ring, depth, writes, on_written);
+    }
+#endif
+
+    ThreadPoolExecutor pool(std::min(options_.threads, writes.size()));
+    std::mutex callback_mutex;
+    std::atomic<size_t> failures{0};
+    pool.parallel_for(writes.size(), [&](size_t index, size_t) {
+        std::string error;
+        write_whole_file(writes[index], error);
+        if (!error.empty()) failures.fetch_add(1, std::memory_order_relaxed);
+        if (on_written) {
+            std::lock_guard<std::mutex> lock(callback_mutex);
+            on_written(index, error);
+        }
+    });
+    return failures.load();
+}
+
+} // namespace orsf
@@ -0,0 +1,177 @@
+#include "orsf/footprint.hpp"
+
+namespace orsf {
+
+namespace {
+
+/// Parent, left and right links plus color, as in libstdc++, libc++ and MSVC
+constexpr size_t MAP_NODE_HEADER = 4 * sizeof(void*);
+
+void add_block(FootprintSection& section, size_t bytes) {
+    section.heap_bytes += bytes;
+    section.allocations += 1;
+}
+
+void add(FootprintSection& section, const std::string& text) {
+    // Inline (SSO) strings point into the string object itself
+    const char* data = text.data();
+    const char* self = reinterpret_cast<const char*>(&text);
+    if (data >= self && data < self + sizeof(std::string)) return;
+    add_block(section, text.capacity() + 1);
+}
+
+void add(FootprintSection& section, const std::optional<std::string>& text) {
+    if (text) add(section, *text);
+}
+
+template <typename T>
+void add_vector_storage(FootprintSection& section, const std::vector<T>& items) {
+    if (items.capacity() > 0) add_block(section, items.capacity() * sizeof(T));
+}
+
+void add(FootprintSection& section, const json& value);
+
+void add(FootprintSection& section, const std::map<std::string, json>& map) {
+    for (const auto& entry : map) {
+        add_block(section, MAP_NODE_HEADER + sizeof(std::pair<const std::string, json>));
+        add(section, entry.first);
+        add(section, entry.second);
+    }
+}
+
+void add(FootprintSection& section, const json& value) {
+    switch (value.type()) {
+        case json::value_t::object: {
+            add_block(section, sizeof(json::object_t));
+            const auto& object = value.get_ref<const json::object_t&>();
+            for (const auto& entry : object) {
+                add_block(section, MAP_NODE_HEADER + sizeof(json::object_t::value_type));
+                add(section, entry.first);
+                add(section, entry.second);
+            }
+            break;
+        }
+        case json::value_t::array: {
+            add_block(section, sizeof(json::array_t));
+            const auto& array = value.get_ref<const json::array_t&>();
+            add_vector_storage(section, array);
+            for (const auto& item : array) add(section, item);
+            break;
+        }
+        case json::value_t::string:
+            add_block(section, sizeof(json::string_t));
+            add(section, value.get_ref<const json::string_t&>());
+            break;
+        case json::value_t::binary: {
+            add_block(section, sizeof(json::binary_t));
+            add_vector_storage(section, static_cast<const std::vector<uint8_t>&>(value.get_binary()));
+            break;
+        }
+        default:
+            break;  // Numbers, booleans and null live inside the json value
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// Memory Footprint Implementation
+// ============================================================================
+
+FootprintSection& FootprintSection::operator+=(const FootprintSection& other) {
+    heap_bytes += other.heap_bytes;
+    allocations += other.allocations;
+    return *this;
+}
+
+FootprintSection MemoryFootprint::heap() const {
+    FootprintSection total;
+    total += metadata;
+    total += car;
+    total += context;
+    total += setup;
+    total += strategy;
+    total += compat;
+    return total;
+}
+
+json MemoryFootprint::to_json() const {
+    auto section = [](const FootprintSection& s) {
+        return json{{"heap_bytes", s.heap_bytes}, {"allocations", s.allocations}};
+    };
+    FootprintSection all = heap();
+    return {
+        {"inline_bytes", inline_bytes},
+        {"heap_bytes", all.heap_bytes},
+        {"allocations", all.allocations},
+        {"total_bytes", total_bytes()},
+        {"sections", {
+            {"metadata", section(metadata)},
+            {"car", section(car)},
+            {"context", section(context)},
+            {"setup", section(setup)},
+            {"strategy", section(strategy)},
+            {"compat", section(compat)},
+        }},
+    };
+}
+
+MemoryFootprint memory_footprint(const ORSF& orsf) {
+    MemoryFootprint footprint;
+
+    // The schema string belongs to the document header; count it with metadata
+    add(footprint.metadata, orsf.schema);
+    const Metadata& m = orsf.metadata;
+    add(footprint.metadata, m.id);
+    add(footprint.metadata, m.name);
+    add(footprint.metadata, m.notes);
+    add(footprint.metadata, m.created_at);
+    add(footprint.metadata, m.updated_at);
+    add(footprint.metadata, m.created_by);
+    add(footprint.metadata, m.source);
+    add(footprint.metadata, m.origin_sim);
+    if (m.tags) {
+        add_vector_storage(footprint.metadata, *m.tags);
+        for (const auto& tag : *m.tags) add(footprint.metadata, tag);
+    }
+
+    add(footprint.car, orsf.car.make);
+    add(footprint.car, orsf.car.model);
+    add(footprint.car, orsf.car.variant);
+    add(footprint.car, orsf.car.car_class);
+    add(footprint.car, orsf.car.bop_id);
+
+    if (orsf.context) {
+        add(footprint.context, orsf.context->track);
+        add(footprint.context, orsf.context->layout);
+        add(footprint.context, orsf.context->rubber);
+        add(footprint.context, orsf.context->session_type);
+        add(footprint.context, orsf.context->fuel_rule);
+    }
+
+    // Only these subsystems hold heap data; the rest are optional numbers
+    const Setup& s = orsf.setup;
+    if (s.tires) add(footprint.setup, s.tires->compound);
+    if (s.gearing && s.gearing->gear_ratios) add_vector_storage(footprint.setup, *s.gearing->gear_ratios);
+    if (s.brakes) {
+        add(footprint.setup, s.brakes->pad_compound);
+        add(footprint.setup, s.brakes->disc_type);
+    }
+
+    if (s.strategy) {
+        add(footprint.strategy, s.strategy->tire_change_policy);
+        add(footprint.strategy, s.strategy->notes);
+        add(footprint.strategy, s.strategy->custom);
+    }
+
+    if (orsf.compat) add(footprint.compat, *orsf.compat);
+    return footprint;
+}
+
+FootprintSection memory_footprint(const json& value) {
+    FootprintSection section;
+    add(section, value);
+    return section;
+}
+
+} // namespace orsf
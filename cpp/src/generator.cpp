@@ -0,0 +1,389 @@
+#include "orsf/generator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace orsf {
+
+namespace {
+
+/// SplitMix64 (small, fast and good enough for synthetic data)
+class Random {
+public:
+    explicit Random(uint64_t seed) : state_(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    /// Uniform in [0, 1)
+    double uniform() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+    bool chance(double probability) { return uniform() < probability; }
+
+    double real(double min, double max) { return min + (max - min) * uniform(); }
+
+    /// Uniform in [min, max], rounded to a multiple of step (and to 6 decimals, as typed by hand)
+    double stepped(double min, double max, double step) {
+        double value = min + step * static_cast<double>(integer(0, static_cast<int64_t>((max - min) / step)));
+        return std::round(value * 1e6) / 1e6;
+    }
+
+    /// Uniform in [min, max]
+    int64_t integer(int64_t min, int64_t max) {
+        return min + static_cast<int64_t>(next() % static_cast<uint64_t>(max - min + 1));
+    }
+
+    template <typename T, size_t N>
+    const T& pick(const T (&items)[N]) { return items[next() % N]; }
+
+private:
+    uint64_t state_;
+};
+
+// Independent streams per setup
+enum Stream : uint64_t { Content = 1, Validity = 2, Errors = 3 };
+
+Random stream(uint64_t seed, uint64_t index, Stream which) {
+    Random mix(seed ^ (index * 0xd1b54a32d192ed03ULL) ^ (static_cast<uint64_t>(which) << 56));
+    return Random(mix.next());
+}
+
+const char* const MAKES[] = {"Porsche", "Ferrari", "BMW", "Mercedes-AMG", "Audi", "McLaren", "Lamborghini", "Aston Martin"};
+const char* const MODELS[] = {"911 GT3 R", "296 GT3", "M4 GT3", "AMG GT3 Evo", "R8 LMS GT3 Evo II", "720S GT3 Evo", "Huracan GT3 Evo2", "Vantage AMR GT3"};
+const char* const CLASSES[] = {"GT3", "GT3", "GT3", "GTE", "LMP2", "LMDh", "GT4", "TCR", "F3", "F4"};
+const char* const TRACKS[] = {"Monza", "Spa-Francorchamps", "Nurburgring", "Silverstone", "Suzuka", "Daytona", "Road Atlanta", "Imola"};
+const char* const RUBBER[] = {"green", "low", "medium", "high", "saturated"};
+const char* const SESSIONS[] = {"practice", "qualifying", "race"};
+const char* const COMPOUNDS[] = {"Soft", "Medium", "Hard", "Wet"};
+const char* const SIMS[] = {"iracing", "acc", "rf2", "ams2", "lmu"};
+const char* const TAGS[] = {"quali", "race", "wet", "stable", "aggressive", "baseline", "low-fuel", "night"};
+
+std::string padded(uint64_t value, int width) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%0*llu", width, static_cast<unsigned long long>(value));
+    return buffer;
+}
+
+/// Set optional to a value with the given probability
+template <typename T, typename Make>
+void maybe(Random& random, double rate, std::optional<T>& field, Make make) {
+    if (random.chance(rate)) field = make();
+}
+
+CornerSuspension make_corner(Random& random, double fill, bool front) {
+    CornerSuspension c;
+    maybe(random, fill, c.camber_deg, [&] { return random.stepped(front ? -4.5 : -3.5, -0.5, 0.1); });
+    maybe(random, fill, c.toe_deg, [&] { return random.stepped(-0.3, 0.3, 0.01); });
+    if (front) maybe(random, fill, c.caster_deg, [&] { return random.stepped(4.0, 12.0, 0.1); });
+    maybe(random, fill, c.spring_rate_n_mm, [&] { return random.stepped(80.0, 300.0, 5.0); });
+    maybe(random, fill, c.ride_height_mm, [&] { return random.stepped(45.0, 90.0, 0.5); });
+    maybe(random, fill, c.bumpstop_gap_mm, [&] { return random.stepped(0.0, 25.0, 0.5); });
+    maybe(random, fill, c.bumpstop_rate_n_mm, [&] { return random.stepped(200.0, 1500.0, 50.0); });
+    maybe(random, fill, c.packer_mm, [&] { return random.stepped(0.0, 20.0, 1.0); });
+    maybe(random, fill, c.damper_bump_slow_n_s_m, [&] { return random.stepped(1000.0, 9000.0, 250.0); });
+    maybe(random, fill, c.damper_bump_fast_n_s_m, [&] { return random.stepped(500.0, 6000.0, 250.0); });
+    maybe(random, fill, c.damper_rebound_slow_n_s_m, [&] { return random.stepped(2000.0, 14000.0, 250.0); });
+    maybe(random, fill, c.damper_rebound_fast_n_s_m, [&] { return random.stepped(1000.0, 9000.0, 250.0); });
+    return c;
+}
+
+json make_compat_blob(Random& random, size_t max_bytes) {
+    // Sim-specific key/value dumps: mostly numbers, some strings and nesting
+    json blob = json::object();
+    size_t target = static_cast<size_t>(random.integer(64, static_cast<int64_t>(std::max<size_t>(max_bytes, 64))));
+    size_t approximate = 2;
+    for (size_t i = 0; approximate < target; ++i) {
+        std::string key = "Param" + padded(i, 4);
+        switch (random.next() % 4) {
+            case 0: blob[key] = random.stepped(-100.0, 100.0, 0.01); break;
+            case 1: blob[key] = random.integer(0, 50); break;
+            case 2: blob[key] = std::string(random.pick(COMPOUNDS)) + "_" + padded(random.next() % 1000, 3); break;
+            default: blob[key] = json::array({random.integer(0, 9), random.integer(0, 9), random.integer(0, 9)}); break;
+        }
+        approximate += key.size() + 16;
+    }
+    return blob;
+}
+
+using Injector = void (*)(ORSF&, Random&);
+
+// Each injector produces at least one Error-severity finding; all keep the
+// setup loadable by ORSF::from_json (schema stays valid)
+const Injector INJECTORS[] = {
+    [](ORSF& orsf, Random& random) {
+        if (!orsf.context) orsf.context = Context{};
+        orsf.context->wetness = random.real(1.1, 3.0);
+    },
+    [](ORSF& orsf, Random& random) {
+        if (!orsf.setup.brakes) orsf.setup.brakes = Brakes{};
+        orsf.setup.brakes->brake_bias_pct = random.chance(0.5) ? random.real(101.0, 160.0) : -random.real(1.0, 50.0);
+    },
+    [](ORSF& orsf, Random& random) {
+        if (!orsf.setup.gearing) orsf.setup.gearing = Gearing{};
+        if (!orsf.setup.gearing->gear_ratios) orsf.setup.gearing->gear_ratios = std::vector<double>{2.9, 2.1, 1.6};
+        auto& ratios = orsf.setup.gearing->gear_ratios.value();
+        ratios[random.next() % ratios.size()] = -random.real(0.1, 3.0);
+    },
+    [](ORSF& orsf, Random& random) {
+        if (!orsf.setup.drivetrain) orsf.setup.drivetrain = Drivetrain{};
+        orsf.setup.drivetrain->lsd_clutch_plates = static_cast<int>(random.integer(-4, 0));
+    },
+    [](ORSF& orsf, Random& random) {
+        if (!orsf.setup.fuel) orsf.setup.fuel = Fuel{};
+        orsf.setup.fuel->per_lap_consumption_l = -random.real(0.0, 3.0);
+    },
+    [](ORSF& orsf, Random& random) {
+        if (!orsf.setup.suspension) orsf.setup.suspension = Suspension{};
+        auto& corner = orsf.setup.suspension->rear_right;
+        if (!corner) corner = CornerSuspension{};
+        corner->spring_rate_n_mm = -random.stepped(0.0, 200.0, 5.0);
+    },
+    [](ORSF& orsf, Random& random) {
+        if (!orsf.setup.aero) orsf.setup.aero = Aerodynamics{};
+        orsf.setup.aero->radiator_opening_pct = random.real(100.5, 250.0);
+    },
+    [](ORSF& orsf, Random&) {
+        orsf.metadata.name.clear();
+    },
+    [](ORSF& orsf, Random& random) {
+        if (!orsf.setup.fuel) orsf.setup.fuel = Fuel{};
+        orsf.setup.fuel->stint_target_laps = static_cast<int>(random.integer(-10, 0));
+    },
+};
+
+} // namespace
+
+// ============================================================================
+// Setup Generator Implementation
+// ============================================================================
+
+SetupGenerator::SetupGenerator(GeneratorOptions options) : options_(std::move(options)) {
+    options_.min_gears = std::max<size_t>(options_.min_gears, 1);
+    options_.max_gears = std::max(options_.max_gears, options_.min_gears);
+    options_.max_custom_entries = std::max<size_t>(options_.max_custom_entries, 1);
+    options_.max_errors = std::max<size_t>(options_.max_errors, 1);
+}
+
+bool SetupGenerator::is_invalid(uint64_t index) const {
+    return stream(options_.seed, index, Validity).chance(options_.error_rate);
+}
+
+ORSF SetupGenerator::generate(uint64_t index) const {
+    Random random = stream(options_.seed, index, Content);
+    const bool dense = random.chance(options_.dense_share);
+    const double fill = dense ? options_.dense_fill_rate : options_.sparse_fill_rate;
+
+    ORSF orsf;
+
+    // Metadata and car
+    const int64_t day = random.integer(1, 28);
+    const int64_t hour = random.integer(0, 20);
+    orsf.metadata.id = "gen-" + padded(options_.seed, 4) + "-" + padded(index, 8);
+    orsf.metadata.name = std::string(random.pick(TRACKS)) + " " + random.pick(SESSIONS) + " #" + std::to_string(index);
+    orsf.metadata.created_at = "2024-" + padded(static_cast<uint64_t>(random.integer(1, 12)), 2) + "-" +
+                               padded(static_cast<uint64_t>(day), 2) + "T" + padded(static_cast<uint64_t>(hour), 2) + ":00:00Z";
+    maybe(random, fill, orsf.metadata.updated_at, [&] {
+        return orsf.metadata.created_at.substr(0, 11) + padded(static_cast<uint64_t>(hour + 3), 2) + ":30:00Z";
+    });
+    maybe(random, fill / 2, orsf.metadata.notes, [&] { return std::string("Generated setup for load testing"); });
+    maybe(random, fill, orsf.metadata.created_by, [&] { return "driver" + std::to_string(random.integer(1, 500)); });
+    maybe(random, fill, orsf.metadata.origin_sim, [&] { return std::string(random.pick(SIMS)); });
+    maybe(random, fill / 2, orsf.metadata.tags, [&] {
+        std::vector<std::string> tags;
+        for (int64_t i = random.integer(1, 4); i > 0; --i) tags.push_back(random.pick(TAGS));
+        return tags;
+    });
+
+    size_t car = random.next() % (sizeof(MAKES) / sizeof(MAKES[0]));
+    orsf.car.make = MAKES[car];
+    orsf.car.model = MODELS[car];
+    maybe(random, fill, orsf.car.car_class, [&] { return std::string(random.pick(CLASSES)); });
+    maybe(random, fill / 2, orsf.car.variant, [&] { return std::to_string(random.integer(2019, 2025)); });
+
+    if (random.chance(options_.context_rate)) {
+        Context ctx;
+        double ambient = random.stepped(5.0, 38.0, 0.5);
+        maybe(random, fill, ctx.track, [&] { return std::string(random.pick(TRACKS)); });
+        maybe(random, fill / 2, ctx.layout, [&] { return std::string("GP"); });
+        maybe(random, fill, ctx.ambient_temp_c, [&] { return ambient; });
+        maybe(random, fill, ctx.track_temp_c, [&] { return ambient + random.stepped(0.0, 25.0, 0.5); });
+        maybe(random, fill, ctx.rubber, [&] { return std::string(random.pick(RUBBER)); });
+        maybe(random, fill, ctx.wetness, [&] { return random.chance(0.8) ? 0.0 : random.stepped(0.0, 1.0, 0.05); });
+        maybe(random, fill, ctx.session_type, [&] { return std::string(random.pick(SESSIONS)); });
+        orsf.context = ctx;
+    }
+
+    // Setup subsystems
+    Setup& setup = orsf.setup;
+    if (random.chance(fill)) {
+        Aerodynamics a;
+        maybe(random, fill, a.front_wing, [&] { return random.stepped(0.0, 15.0, 1.0); });
+        maybe(random, fill, a.rear_wing, [&] { return random.stepped(0.0, 20.0, 1.0); });
+        maybe(random, fill, a.front_downforce_n, [&] { return random.stepped(1000.0, 6000.0, 10.0); });
+        maybe(random, fill, a.rear_downforce_n, [&] { return random.stepped(1500.0, 9000.0, 10.0); });
+        maybe(random, fill, a.front_ride_height_mm, [&] { return random.stepped(45.0, 80.0, 0.5); });
+        maybe(random, fill, a.rear_ride_height_mm, [&] { return random.stepped(55.0, 100.0, 0.5); });
+        maybe(random, fill, a.rake_mm, [&] { return random.stepped(0.0, 30.0, 0.5); });
+        maybe(random, fill, a.brake_duct_front_pct, [&] { return random.stepped(0.0, 100.0, 5.0); });
+        maybe(random, fill, a.brake_duct_rear_pct, [&] { return random.stepped(0.0, 100.0, 5.0); });
+        maybe(random, fill, a.radiator_opening_pct, [&] { return random.stepped(0.0, 100.0, 5.0); });
+        setup.aero = a;
+    }
+
+    if (random.chance(fill)) {
+        // All four corners are present whenever suspension is
+        Suspension s;
+        s.front_left = make_corner(random, fill, true);
+        s.front_right = make_corner(random, fill, true);
+        s.rear_left = make_corner(random, fill, false);
+        s.rear_right = make_corner(random, fill, false);
+        maybe(random, fill, s.front_arb, [&] { return random.stepped(1.0, 10.0, 1.0); });
+        maybe(random, fill, s.rear_arb, [&] { return random.stepped(1.0, 10.0, 1.0); });
+        maybe(random, fill / 2, s.heave_spring_n_mm, [&] { return random.stepped(100.0, 600.0, 10.0); });
+        maybe(random, fill / 2, s.heave_packer_mm, [&] { return random.stepped(0.0, 20.0, 1.0); });
+        setup.suspension = s;
+    }
+
+    if (random.chance(fill)) {
+        Tires t;
+        double base = random.stepped(150.0, 200.0, 0.5);
+        maybe(random, fill, t.compound, [&] { return std::string(random.pick(COMPOUNDS)); });
+        maybe(random, fill, t.pressure_fl_kpa, [&] { return base + random.stepped(-3.0, 3.0, 0.5); });
+        maybe(random, fill, t.pressure_fr_kpa, [&] { return base + random.stepped(-3.0, 3.0, 0.5); });
+        maybe(random, fill, t.pressure_rl_kpa, [&] { return base + random.stepped(-3.0, 3.0, 0.5); });
+        maybe(random, fill, t.pressure_rr_kpa, [&] { return base + random.stepped(-3.0, 3.0, 0.5); });
+        maybe(random, fill / 2, t.stagger_mm, [&] { return random.stepped(0.0, 10.0, 0.5); });
+        setup.tires = t;
+    }
+
+    if (random.chance(fill)) {
+        Drivetrain d;
+        maybe(random, fill, d.diff_preload_nm, [&] { return random.stepped(20.0, 200.0, 10.0); });
+        maybe(random, fill, d.diff_power_ramp_pct, [&] { return random.stepped(10.0, 90.0, 5.0); });
+        maybe(random, fill, d.diff_coast_ramp_pct, [&] { return random.stepped(10.0, 90.0, 5.0); });
+        maybe(random, fill, d.final_drive_ratio, [&] { return random.stepped(2.8, 4.5, 0.01); });
+        maybe(random, fill, d.lsd_clutch_plates, [&] { return static_cast<int>(random.integer(2, 12)); });
+        setup.drivetrain = d;
+    }
+
+    if (random.chance(fill)) {
+        Gearing g;
+        maybe(random, fill, g.gear_ratios, [&] {
+            auto gears = static_cast<size_t>(random.integer(static_cast<int64_t>(options_.min_gears),
+                                                            static_cast<int64_t>(options_.max_gears)));
+            std::vector<double> ratios(gears);
+            double ratio = random.stepped(2.8, 3.6, 0.01);
+            for (auto& r : ratios) {
+                r = ratio;
+                ratio *= random.real(0.72, 0.86);
+            }
+            return ratios;
+        });
+        maybe(random, fill, g.reverse_ratio, [&] { return random.stepped(2.5, 3.5, 0.01); });
+        setup.gearing = g;
+    }
+
+    if (random.chance(fill)) {
+        Brakes b;
+        maybe(random, fill / 2, b.pad_compound, [&] { return "Pad " + std::to_string(random.integer(1, 4)); });
+        maybe(random, fill / 2, b.disc_type, [&] { return std::string("Steel"); });
+        maybe(random, fill, b.brake_bias_pct, [&] { return random.stepped(50.0, 62.0, 0.1); });
+        maybe(random, fill, b.max_force_n, [&] { return random.stepped(1500.0, 3000.0, 10.0); });
+        setup.brakes = b;
+    }
+
+    if (random.chance(fill)) {
+        Electronics e;
+        maybe(random, fill, e.tc_level, [&] { return static_cast<int>(random.integer(0, 12)); });
+        maybe(random, fill, e.tc2_level, [&] { return static_cast<int>(random.integer(0, 12)); });
+        maybe(random, fill, e.abs_level, [&] { return static_cast<int>(random.integer(0, 12)); });
+        maybe(random, fill, e.engine_map, [&] { return static_cast<int>(random.integer(1, 8)); });
+        maybe(random, fill, e.engine_brake_level, [&] { return static_cast<int>(random.integer(1, 8)); });
+        maybe(random, fill, e.pit_limiter_kph, [&] { return random.stepped(50.0, 80.0, 1.0); });
+        setup.electronics = e;
+    }
+
+    if (random.chance(fill)) {
+        Fuel f;
+        maybe(random, fill, f.start_fuel_l, [&] { return random.stepped(5.0, 120.0, 1.0); });
+        maybe(random, fill, f.per_lap_consumption_l, [&] { return random.stepped(1.5, 4.5, 0.05); });
+        maybe(random, fill, f.stint_target_laps, [&] { return static_cast<int>(random.integer(5, 40)); });
+        maybe(random, fill, f.mixture_setting, [&] { return static_cast<int>(random.integer(1, 5)); });
+        setup.fuel = f;
+    }
+
+    if (random.chance(options_.strategy_rate)) {
+        Strategy s;
+        maybe(random, fill, s.tire_change_policy, [&] { return std::string(random.chance(0.5) ? "all" : "fronts"); });
+        maybe(random, fill / 2, s.notes, [&] { return std::string("Box on lap ") + std::to_string(random.integer(10, 30)); });
+        for (int64_t i = random.integer(1, static_cast<int64_t>(options_.max_custom_entries)); i > 0; --i) {
+            std::string key = "custom_" + padded(random.next() % 100, 2);
+            switch (random.next() % 3) {
+                case 0: s.custom[key] = random.stepped(0.0, 100.0, 0.5); break;
+                case 1: s.custom[key] = random.pick(TAGS); break;
+                default: s.custom[key] = {{"lap", random.integer(1, 60)}, {"fuel", random.stepped(0.0, 100.0, 1.0)}}; break;
+            }
+        }
+        setup.strategy = s;
+    }
+
+    if (random.chance(options_.compat_rate)) {
+        std::map<std::string, json> compat;
+        for (int64_t i = random.integer(1, 2); i > 0; --i) {
+            compat[random.pick(SIMS)] = make_compat_blob(random, options_.max_compat_bytes);
+        }
+        orsf.compat = std::move(compat);
+    }
+
+    if (is_invalid(index)) {
+        Random errors = stream(options_.seed, index, Errors);
+        for (int64_t i = errors.integer(1, static_cast<int64_t>(options_.max_errors)); i > 0; --i) {
+            errors.pick(INJECTORS)(orsf, errors);
+        }
+    }
+    return orsf;
+}
+
+std::vector<ORSF> SetupGenerator::generate_range(uint64_t first, size_t count) const {
+    std::vector<ORSF> setups;
+    setups.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        setups.push_back(generate(first + i));
+    }
+    return setups;
+}
+
+void SetupGenerator::write_ndjson(uint64_t first, size_t count, OutputSink& sink) const {
+    std::string line;
+    for (size_t i = 0; i < count; ++i) {
+        line = generate(first + i).to_json_string();
+        line.push_back('\n');
+        sink.write(line);
+    }
+    sink.flush();
+}
+
+void SetupGenerator::write_files(const std::string& directory, uint64_t first, size_t count, int indent) const {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        throw std::runtime_error("Failed to create directory " + directory + ": " + error.message());
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        std::string path = (std::filesystem::path(directory) / ("setup_" + padded(first + i, 8) + ".json")).string();
+        std::ofstream file(path);
+        if (!(file << generate(first + i).to_json_string(indent) << '\n')) {
+            throw std::runtime_error("Failed to write " + path);
+        }
+    }
+}
+
+} // namespace orsf
@@ -0,0 +1,197 @@
+#include "orsf/incremental.hpp"
+#include "orsf/columnar.hpp"
+#include <stdexcept>
+
+namespace orsf {
+
+namespace {
+
+// Field paths read by each rule group (indexed by RuleGroup)
+const std::vector<std::vector<std::string>>& group_dependencies() {
+    static const std::vector<std::vector<std::string>> dependencies = {
+        {"schema"},
+        {"metadata"},
+        {"car"},
+        {"context"},
+        {"setup.aero"},
+        {"setup.suspension.front_left"},
+        {"setup.suspension.front_right"},
+        {"setup.suspension.rear_left"},
+        {"setup.suspension.rear_right"},
+        {"setup.suspension.heave_spring_n_mm"},
+        {"setup.tires"},
+        {"setup.drivetrain"},
+        {"setup.gearing"},
+        {"setup.brakes"},
+        {"setup.electronics"},
+        {"setup.fuel"},
+        {"context.ambient_temp_c", "context.track_temp_c"},
+    };
+    return dependencies;
+}
+
+// True if `path` equals `prefix` or names a field nested below it
+bool is_within(const std::string& path, const std::string& prefix) {
+    if (path.size() < prefix.size() || path.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    if (path.size() == prefix.size()) return true;
+
+    const char next = path[prefix.size()];
+    return next == '.' || next == '[';
+}
+
+const std::optional<CornerSuspension>& corner_of(
+    const ORSF& orsf,
+    std::optional<CornerSuspension> Suspension::*corner
+) {
+    static const std::optional<CornerSuspension> none;
+    if (!orsf.setup.suspension.has_value()) return none;
+    return orsf.setup.suspension.value().*corner;
+}
+
+} // namespace
+
+// ============================================================================
+// Incremental Validator Implementation
+// ============================================================================
+
+const std::vector<ValidationError>& IncrementalValidator::validate(const ORSF& orsf) {
+    for (size_t i = 0; i < GROUP_COUNT; ++i) {
+        group_errors_[i].clear();
+        run_group(static_cast<RuleGroup>(i), orsf, group_errors_[i]);
+    }
+
+    initialized_ = true;
+    last_run_count_ = GROUP_COUNT;
+    rebuild_errors();
+    return errors_;
+}
+
+const std::vector<ValidationError>& IncrementalValidator::revalidate(
+    const ORSF& orsf,
+    const std::vector<std::string>& changed_fields
+) {
+    std::vector<RuleGroup> groups;
+    std::array<bool, GROUP_COUNT> seen{};
+
+    for (const auto& field : changed_fields) {
+        for (RuleGroup group : groups_for_field(field)) {
+            size_t index = static_cast<size_t>(group);
+            if (!seen[index]) {
+                seen[index] = true;
+                groups.push_back(group);
+            }
+        }
+    }
+
+    return revalidate(orsf, groups);
+}
+
+const std::vector<ValidationError>& IncrementalValidator::revalidate(
+    const ORSF& orsf,
+    const std::vector<RuleGroup>& groups
+) {
+    for (RuleGroup group : groups) {
+        if (static_cast<size_t>(group) >= GROUP_COUNT) {
+            throw std::runtime_error("Invalid rule group: " + std::to_string(static_cast<size_t>(group)));
+        }
+    }
+
+    if (!initialized_) {
+        return validate(orsf);
+    }
+
+    last_run_count_ = 0;
+    for (RuleGroup group : groups) {
+        auto& errors = group_errors_[static_cast<size_t>(group)];
+        errors.clear();
+        run_group(group, orsf, errors);
+        ++last_run_count_;
+    }
+
+    if (last_run_count_ > 0) {
+        rebuild_errors();
+    }
+    return errors_;
+}
+
+std::vector<RuleGroup> IncrementalValidator::groups_for_field(const std::string& path) {
+    std::vector<RuleGroup> groups;
+    const auto& dependencies = group_dependencies();
+
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+        for (const auto& dependency : dependencies[i]) {
+            // Edited field below a dependency, or a whole section containing it
+            if (is_within(path, dependency) || path.empty() || is_within(dependency, path)) {
+                groups.push_back(static_cast<RuleGroup>(i));
+                break;
+            }
+        }
+    }
+
+    return groups;
+}
+
+void IncrementalValidator::reset() {
+    for (auto& errors : group_errors_) {
+        errors.clear();
+    }
+    errors_.clear();
+    initialized_ = false;
+    last_run_count_ = 0;
+}
+
+void IncrementalValidator::run_group(RuleGroup group, const ORSF& orsf, std::vector<ValidationError>& errors) {
+    const Setup& setup = orsf.setup;
+
+    switch (group) {
+        case RuleGroup::Schema:      Validator::validate_schema(orsf, errors); break;
+        case RuleGroup::Metadata:    Validator::validate_metadata(orsf.metadata, errors); break;
+        case RuleGroup::Car:         Validator::validate_car(orsf.car, errors); break;
+        case RuleGroup::Context:     Validator::validate_context(orsf.context, errors); break;
+        case RuleGroup::Aero:        Validator::validate_aero(setup.aero, errors); break;
+
+        case RuleGroup::FrontLeft:
+            Validator::validate_corner_suspension(
+                corner_of(orsf, &Suspension::front_left), "setup.suspension.front_left", errors);
+            break;
+        case RuleGroup::FrontRight:
+            Validator::validate_corner_suspension(
+                corner_of(orsf, &Suspension::front_right), "setup.suspension.front_right", errors);
+            break;
+        case RuleGroup::RearLeft:
+            Validator::validate_corner_suspension(
+                corner_of(orsf, &Suspension::rear_left), "setup.suspension.rear_left", errors);
+            break;
+        case RuleGroup::RearRight:
+            Validator::validate_corner_suspension(
+                corner_of(orsf, &Suspension::rear_right), "setup.suspension.rear_right", errors);
+            break;
+
+        case RuleGroup::SuspensionChassis:
+            if (setup.suspension.has_value() && setup.suspension->heave_spring_n_mm.has_value()) {
+                ColumnRule::positive("setup.suspension.heave_spring_n_mm")
+                    .check_value(setup.suspension->heave_spring_n_mm.value(), errors);
+            }
+            break;
+
+        case RuleGroup::Tires:       Validator::validate_tires(setup.tires, errors); break;
+        case RuleGroup::Drivetrain:  Validator::validate_drivetrain(setup.drivetrain, errors); break;
+        case RuleGroup::Gearing:     Validator::validate_gearing(setup.gearing, errors); break;
+        case RuleGroup::Brakes:      Validator::validate_brakes(setup.brakes, errors); break;
+        case RuleGroup::Electronics: Validator::validate_electronics(setup.electronics, errors); break;
+        case RuleGroup::Fuel:        Validator::validate_fuel(setup.fuel, errors); break;
+        case RuleGroup::CrossField:  Validator::validate_cross_field(orsf, errors); break;
+        case RuleGroup::Count:       break;
+    }
+}
+
+void IncrementalValidator::rebuild_errors() {
+    errors_.clear();
+    for (const auto& errors : group_errors_) {
+        errors_.insert(errors_.end(), errors.begin(), errors.end());
+    }
+}
+
+} // namespace orsf
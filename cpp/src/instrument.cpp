@@ -0,0 +1,263 @@
+#include "orsf/instrument.hpp"
+#include "orsf/epoch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace orsf {
+
+namespace {
+
+constexpr size_t FIELD_COUNT = 5;
+
+constexpr const char* STAGE_NAMES[STAGE_COUNT] = {
+    "parse", "serialize", "validate", "flatten", "map_to_native",
+    "map_to_orsf", "lookup_table", "adapter_encode", "adapter_decode", "adapter_validate",
+};
+
+/// Counters written only by their owning thread
+///
+/// The owner updates with a relaxed load and store (no lock prefix);
+/// snapshot readers on other threads see each value whole.
+struct ThreadBlock {
+    std::array<std::array<std::atomic<uint64_t>, FIELD_COUNT>, STAGE_COUNT> counters{};
+
+    void add(size_t stage, size_t field, uint64_t value) {
+        auto& counter = counters[stage][field];
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    void add_to(StageSnapshot& snapshot) const {
+        for (size_t s = 0; s < STAGE_COUNT; ++s) {
+            StageCounters& c = snapshot.stages[s];
+            c.calls += counters[s][0].load(std::memory_order_relaxed);
+            c.nanoseconds += counters[s][1].load(std::memory_order_relaxed);
+            c.bytes += counters[s][2].load(std::memory_order_relaxed);
+            c.errors += counters[s][3].load(std::memory_order_relaxed);
+            c.allocations += counters[s][4].load(std::memory_order_relaxed);
+        }
+    }
+};
+
+using SinkList = std::vector<std::shared_ptr<StageSink>>;
+
+struct State {
+    std::mutex mutex;                       ///< Guards blocks, retired and baseline
+    std::vector<ThreadBlock*> blocks;
+    StageSnapshot retired;                  ///< Totals of exited threads
+    StageSnapshot baseline;                 ///< Totals at the last reset()
+
+    // Own epochs, so remove_sink waits only for sink calls in flight
+    std::mutex sinks_mutex;                 ///< Serializes add_sink and remove_sink
+    ReaderEpochs sink_epochs;
+    Published<SinkList> sinks{sink_epochs};
+    std::atomic<bool> has_sinks{false};
+};
+
+// Never destroyed, so threads exiting during static destruction can still retire
+State& state() {
+    static State* instance = new State();
+    return *instance;
+}
+
+StageSnapshot raw_totals(State& s) {
+    StageSnapshot totals = s.retired;
+    for (const ThreadBlock* block : s.blocks) block->add_to(totals);
+    return totals;
+}
+
+/// Registers the thread's block on first use and retires it on thread exit
+struct ThreadHandle {
+    ThreadBlock* block = nullptr;
+
+    ThreadBlock& get() {
+        if (block == nullptr) {
+            block = new ThreadBlock();
+            State& s = state();
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.blocks.push_back(block);
+        }
+        return *block;
+    }
+
+    ~ThreadHandle() {
+        if (block == nullptr) return;
+        State& s = state();
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            block->add_to(s.retired);
+            s.blocks.erase(std::find(s.blocks.begin(), s.blocks.end(), block));
+        }
+        delete block;
+    }
+};
+
+thread_local ThreadHandle thread_handle;
+thread_local uint64_t thread_allocation_count = 0;
+thread_local uint32_t active_stages = 0;
+thread_local uint64_t current_item_id = NO_ITEM;
+
+} // namespace
+
+const char* stage_name(Stage stage) {
+    size_t index = static_cast<size_t>(stage);
+    return index < STAGE_COUNT ? STAGE_NAMES[index] : "unknown";
+}
+
+// ============================================================================
+// Stage Counters Implementation
+// ============================================================================
+
+StageCounters& StageCounters::operator+=(const StageCounters& other) {
+    calls += other.calls;
+    nanoseconds += other.nanoseconds;
+    bytes += other.bytes;
+    errors += other.errors;
+    allocations += other.allocations;
+    return *this;
+}
+
+StageCounters& StageCounters::operator-=(const StageCounters& other) {
+    calls -= other.calls;
+    nanoseconds -= other.nanoseconds;
+    bytes -= other.bytes;
+    errors -= other.errors;
+    allocations -= other.allocations;
+    return *this;
+}
+
+json StageSnapshot::to_json() const {
+    json j = json::object();
+    for (size_t s = 0; s < STAGE_COUNT; ++s) {
+        const StageCounters& c = stages[s];
+        j[STAGE_NAMES[s]] = {
+            {"calls", c.calls}, {"nanoseconds", c.nanoseconds}, {"bytes", c.bytes},
+            {"errors", c.errors}, {"allocations", c.allocations}
+        };
+    }
+    return j;
+}
+
+// ============================================================================
+// Instrumentation Implementation
+// ============================================================================
+
+StageSnapshot Instrumentation::snapshot() {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    StageSnapshot totals = raw_totals(s);
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+        totals.stages[i] -= s.baseline.stages[i];
+    }
+    return totals;
+}
+
+void Instrumentation::reset() {
+    // Blocks belong to their threads, so reset moves the baseline instead of zeroing them
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.baseline = raw_totals(s);
+}
+
+void Instrumentation::add_sink(std::shared_ptr<StageSink> sink) {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.sinks_mutex);
+    auto current = s.sinks.load();
+    auto sinks = current ? std::make_shared<SinkList>(*current) : std::make_shared<SinkList>();
+    if (std::find(sinks->begin(), sinks->end(), sink) != sinks->end()) return;
+    sinks->push_back(std::move(sink));
+    s.sinks.store(std::move(sinks));
+    s.has_sinks.store(true, std::memory_order_release);
+}
+
+void Instrumentation::remove_sink(const std::shared_ptr<StageSink>& sink) {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.sinks_mutex);
+    auto current = s.sinks.load();
+    if (!current) return;
+    auto sinks = std::make_shared<SinkList>(*current);
+    sinks->erase(std::remove(sinks->begin(), sinks->end(), sink), sinks->end());
+    s.has_sinks.store(!sinks->empty(), std::memory_order_release);
+    s.sinks.store(std::move(sinks));  // Waits for calls still iterating the old list
+}
+
+void Instrumentation::note_allocation(uint64_t count) noexcept {
+    thread_allocation_count += count;
+}
+
+uint64_t Instrumentation::thread_allocations() noexcept {
+    return thread_allocation_count;
+}
+
+uint64_t Instrumentation::current_item() noexcept {
+    return current_item_id;
+}
+
+void Instrumentation::record(const StageEvent& event) {
+    size_t stage = static_cast<size_t>(event.stage);
+    ThreadBlock& block = thread_handle.get();
+    block.add(stage, 0, 1);
+    block.add(stage, 1, static_cast<uint64_t>(event.duration.count()));
+    block.add(stage, 2, event.bytes);
+    block.add(stage, 3, event.errors);
+    block.add(stage, 4, event.allocations);
+
+    State& s = state();
+    if (s.has_sinks.load(std::memory_order_acquire)) {
+        Published<SinkList>::Reader sinks(s.sinks);
+        if (sinks) {
+            for (const auto& sink : *sinks) sink->on_stage(event);
+        }
+    }
+}
+
+// ============================================================================
+// Scoped Stage Implementation
+// ============================================================================
+
+ScopedStage::ScopedStage(Stage stage)
+    : stage_(stage),
+      active_((active_stages & (1u << static_cast<uint32_t>(stage))) == 0),
+      exceptions_(std::uncaught_exceptions()),
+      allocations_(thread_allocation_count) {
+    if (active_) {
+        active_stages |= 1u << static_cast<uint32_t>(stage);
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedStage::~ScopedStage() {
+    if (!active_) return;
+    active_stages &= ~(1u << static_cast<uint32_t>(stage_));
+
+    StageEvent event;
+    event.stage = stage_;
+    event.item = current_item_id;
+    event.start = start_;
+    event.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+    event.bytes = bytes_;
+    event.errors = errors_ + (std::uncaught_exceptions() > exceptions_ ? 1 : 0);
+    event.allocations = thread_allocation_count - allocations_;
+
+    try {
+        Instrumentation::record(event);
+    } catch (...) {
+        // Registering the thread block can fail only on allocation failure; drop the event
+    }
+}
+
+// ============================================================================
+// Scoped Item Implementation
+// ============================================================================
+
+ScopedItem::ScopedItem(uint64_t item) noexcept : previous_(current_item_id) {
+    current_item_id = item;
+}
+
+ScopedItem::~ScopedItem() {
+    current_item_id = previous_;
+}
+
+} // namespace orsf
@@ -0,0 +1,434 @@
+#include "orsf/library_cache.hpp"
+#include "orsf/cache.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace orsf {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t MAGIC_SIZE = 8;
+constexpr uint32_t CACHE_VERSION = 2;
+constexpr uint32_t TRAILER = 0xFFFFFFFFu;
+constexpr int64_t RACY_WINDOW_NS = 2'000'000'000;  ///< Coarsest common mtime granularity (FAT)
+constexpr size_t PARSE_CHUNK = 4096;                ///< Changed files read and parsed per round
+constexpr size_t WRITE_CHUNK = 1 << 20;
+
+/// mtime and size of a file, as compared against the cache
+struct FileStamp {
+    bool ok = false;
+    int64_t mtime_ns = 0;
+    uint64_t size = 0;
+};
+
+FileStamp stamp_file(const std::string& path) {
+    FileStamp stamp;
+#ifdef _WIN32
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    if (error) return stamp;
+    auto mtime = std::filesystem::last_write_time(path, error);
+    if (error) return stamp;
+    stamp.mtime_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count();
+    stamp.size = size;
+#else
+    struct stat info;
+    if (::stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode)) return stamp;
+#ifdef __APPLE__
+    stamp.mtime_ns = static_cast<int64_t>(info.st_mtimespec.tv_sec) * 1'000'000'000 + info.st_mtimespec.tv_nsec;
+#else
+    stamp.mtime_ns = static_cast<int64_t>(info.st_mtim.tv_sec) * 1'000'000'000 + info.st_mtim.tv_nsec;
+#endif
+    stamp.size = static_cast<uint64_t>(info.st_size);
+#endif
+    stamp.ok = true;
+    return stamp;
+}
+
+/// Now on the clock file mtimes are measured with
+int64_t now_ns() {
+#ifdef _WIN32
+    auto now = std::filesystem::file_time_type::clock::now();
+#else
+    auto now = std::chrono::system_clock::now();
+#endif
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+}
+
+// ----------------------------------------------------------------------------
+// Cache file form (little-endian, length-prefixed strings)
+// ----------------------------------------------------------------------------
+
+void put_u32(ByteBuffer& out, uint32_t value) {
+    uint8_t* p = out.grow(4);
+    for (int i = 0; i < 4; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+void put_u64(ByteBuffer& out, uint64_t value) {
+    uint8_t* p = out.grow(8);
+    for (int i = 0; i < 8; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+void put_string(ByteBuffer& out, std::string_view value) {
+    put_u32(out, static_cast<uint32_t>(value.size()));
+    out.append(value);
+}
+
+class CacheReader {
+public:
+    explicit CacheReader(ByteSpan data)
+        : data_(reinterpret_cast<const uint8_t*>(data.data())), size_(data.size()) {}
+
+    uint32_t u32() {
+        need(4);
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) value |= static_cast<uint32_t>(data_[pos_ + i]) << (8 * i);
+        pos_ += 4;
+        return value;
+    }
+
+    uint64_t u64() {
+        need(8);
+        uint64_t value = 0;
+        for (int i = 0; i < 8; ++i) value |= static_cast<uint64_t>(data_[pos_ + i]) << (8 * i);
+        pos_ += 8;
+        return value;
+    }
+
+    ByteSpan bytes(size_t size) {
+        need(size);
+        ByteSpan value(data_ + pos_, size);
+        pos_ += size;
+        return value;
+    }
+
+    std::string string() {
+        uint32_t size = u32();
+        return std::string(bytes(size).as_chars());
+    }
+
+    size_t remaining() const { return size_ - pos_; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+
+    void need(size_t size) const {
+        if (size > size_ - pos_) {
+            throw std::runtime_error("Truncated library cache");
+        }
+    }
+};
+
+/// Whole cache file, mapped where possible
+std::shared_ptr<const void> map_cache_file(const std::string& path, ByteSpan& data) {
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return nullptr;
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (address != MAP_FAILED) {
+        data = ByteSpan(address, size);
+        return std::shared_ptr<const void>(address, [size](const void* mapped) {
+            ::munmap(const_cast<void*>(mapped), size);
+        });
+    }
+#endif
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return nullptr;
+    auto bytes = std::make_shared<std::vector<uint8_t>>(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    data = ByteSpan(bytes->data(), bytes->size());
+    return bytes;
+}
+
+/// Parse one file's bytes into a cache entry
+void parse_entry(LibraryCacheEntry& entry, ByteSpan data) {
+    try {
+        ORSF setup = parse_orsf_json(data);
+        entry.listing = SetupListing::from_setup(setup);
+        entry.hash = content_hash(setup);
+        auto encoded = std::make_shared<std::vector<uint8_t>>(json::to_cbor(setup.to_json()));
+        entry.encoded = ByteSpan(encoded->data(), encoded->size());
+        entry.storage = std::move(encoded);
+    } catch (const std::exception& e) {
+        entry.error = e.what();
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// Listing and Entries
+// ============================================================================
+
+SetupListing SetupListing::from_setup(const ORSF& setup) {
+    SetupListing listing;
+    listing.id = setup.metadata.id;
+    listing.name = setup.metadata.name;
+    listing.car = setup.car.model.empty() ? setup.car.make : setup.car.make + " " + setup.car.model;
+    if (setup.context && setup.context->track) listing.track = *setup.context->track;
+    if (setup.metadata.tags) listing.tags = *setup.metadata.tags;
+    listing.created_at = setup.metadata.created_at;
+    return listing;
+}
+
+bool SetupListing::operator==(const SetupListing& other) const {
+    return id == other.id && name == other.name && car == other.car && track == other.track &&
+           tags == other.tags && created_at == other.created_at;
+}
+
+ORSF LibraryCacheEntry::setup() const {
+    if (!ok()) {
+        throw std::runtime_error("Cached setup failed to load: " + error);
+    }
+    json j;
+    try {
+        const auto* first = reinterpret_cast<const uint8_t*>(encoded.data());
+        j = json::from_cbor(first, first + encoded.size());
+    } catch (const json::exception& e) {
+        throw std::runtime_error(std::string("Corrupt cached setup: ") + e.what());
+    }
+    return ORSF::from_json(j);
+}
+
+json LibraryRefreshStats::to_json() const {
+    return {
+        {"files", files},
+        {"reused", reused},
+        {"parsed", parsed},
+        {"failed", failed},
+        {"missing", missing},
+        {"removed", removed},
+        {"elapsed_ms", static_cast<double>(elapsed.count()) / 1e6},
+    };
+}
+
+// ============================================================================
+// Library Cache Implementation
+// ============================================================================
+
+LibraryCache::LibraryCache(std::string cache_path, AsyncIoOptions io)
+    : cache_path_(std::move(cache_path)), io_(io) {}
+
+void LibraryCache::clear() {
+    entries_.clear();
+    index_.clear();
+    trusted_before_ns_ = 0;
+}
+
+void LibraryCache::rebuild_index() {
+    index_.clear();
+    index_.reserve(entries_.size());
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        index_.emplace(entries_[i].path, i);
+    }
+}
+
+const LibraryCacheEntry* LibraryCache::find(const std::string& path) const {
+    auto it = index_.find(path);
+    return it == index_.end() ? nullptr : &entries_[it->second];
+}
+
+bool LibraryCache::load() {
+    clear();
+
+    ByteSpan data;
+    std::shared_ptr<const void> storage = map_cache_file(cache_path_, data);
+    if (!storage || data.size() < MAGIC_SIZE ||
+        data.as_chars().substr(0, MAGIC_SIZE) != std::string_view(MAGIC, MAGIC_SIZE)) {
+        return false;
+    }
+
+    std::vector<LibraryCacheEntry> entries;
+    int64_t trusted_before = 0;
+    try {
+        CacheReader r(data);
+        r.bytes(MAGIC_SIZE);
+        if (r.u32() != CACHE_VERSION) return false;
+        trusted_before = static_cast<int64_t>(r.u64());
+
+        // Each entry takes at least 64 bytes, so a corrupt count cannot over-allocate
+        uint64_t count = r.u64();
+        if (count > r.remaining() / 64) return false;
+        entries.resize(static_cast<size_t>(count));
+        for (auto& entry : entries) {
+            entry.path = r.string();
+            entry.mtime_ns = static_cast<int64_t>(r.u64());
+            entry.size = r.u64();
+            entry.hash = r.u64();
+            entry.error = r.string();
+            entry.listing.id = r.string();
+            entry.listing.name = r.string();
+            entry.listing.car = r.string();
+            entry.listing.track = r.string();
+            entry.listing.tags.resize(r.u32());
+            for (auto& tag : entry.listing.tags) tag = r.string();
+            entry.listing.created_at = r.string();
+            entry.encoded = r.bytes(static_cast<size_t>(r.u64()));
+            if (!entry.encoded.empty()) entry.storage = storage;
+        }
+        if (r.u32() != TRAILER || r.u64() != count) return false;
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    entries_ = std::move(entries);
+    trusted_before_ns_ = trusted_before;
+    rebuild_index();
+    return true;
+}
+
+LibraryRefreshStats LibraryCache::refresh(const std::vector<std::string>& paths) {
+    return refresh(paths, *default_executor());
+}
+
+LibraryRefreshStats LibraryCache::refresh(const std::vector<std::string>& paths, Executor& executor) {
+    const auto start = Clock::now();
+    const int64_t trusted_before = now_ns() - RACY_WINDOW_NS;
+    LibraryRefreshStats stats;
+    stats.files = paths.size();
+
+    std::vector<FileStamp> stamps(paths.size());
+    executor.parallel_for(paths.size(), [&](size_t i, size_t) { stamps[i] = stamp_file(paths[i]); });
+
+    // Reuse unchanged entries; collect the rest for parsing
+    std::vector<LibraryCacheEntry> entries;
+    entries.reserve(paths.size());
+    std::vector<size_t> changed;            ///< Positions in entries
+    std::vector<std::string> changed_paths;
+    size_t kept = 0;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        const FileStamp& stamp = stamps[i];
+        if (!stamp.ok) {
+            ++stats.missing;
+            continue;
+        }
+
+        auto it = index_.find(paths[i]);
+        if (it != index_.end()) {
+            LibraryCacheEntry& cached = entries_[it->second];
+            ++kept;
+            if (cached.mtime_ns == stamp.mtime_ns && cached.size == stamp.size &&
+                cached.mtime_ns < trusted_before_ns_) {
+                entries.push_back(std::move(cached));
+                cached.mtime_ns = INT64_MIN;    // moved out; a repeated path is parsed again
+                ++stats.reused;
+                continue;
+            }
+        }
+
+        LibraryCacheEntry entry;
+        entry.path = paths[i];
+        entry.mtime_ns = stamp.mtime_ns;
+        entry.size = stamp.size;
+        changed.push_back(entries.size());
+        changed_paths.push_back(paths[i]);
+        entries.push_back(std::move(entry));
+    }
+    stats.removed = entries_.size() - std::min(kept, entries_.size());
+
+    // Read changed files in chunks (bounded memory), parse each chunk in parallel
+    AsyncFileReader reader(io_);
+    for (size_t first = 0; first < changed.size(); first += PARSE_CHUNK) {
+        size_t count = std::min(PARSE_CHUNK, changed.size() - first);
+        std::vector<std::string> chunk_paths(changed_paths.begin() + first, changed_paths.begin() + first + count);
+        std::vector<ByteBuffer> contents(count);
+
+        reader.read_files(chunk_paths, [&](FileReadResult& file) {
+            LibraryCacheEntry& entry = entries[changed[first + file.index]];
+            if (file.ok()) contents[file.index] = std::move(file.data);
+            else entry.error = std::move(file.error);
+        });
+
+        executor.parallel_for(count, [&](size_t i, size_t) {
+            LibraryCacheEntry& entry = entries[changed[first + i]];
+            if (entry.ok()) parse_entry(entry, contents[i].span());
+        });
+        for (size_t i = 0; i < count; ++i) {
+            if (!entries[changed[first + i]].ok()) ++stats.failed;
+        }
+    }
+    stats.parsed = changed.size();
+
+    entries_ = std::move(entries);
+    trusted_before_ns_ = trusted_before;
+    rebuild_index();
+    stats.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+    return stats;
+}
+
+void LibraryCache::save() const {
+    std::string temporary = cache_path_ + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Failed to open " + temporary);
+        }
+
+        ByteBuffer out;
+        out.reserve(WRITE_CHUNK + (64 << 10));
+        auto flush = [&] {
+            file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+            out.clear();
+        };
+
+        out.append(std::string_view(MAGIC, MAGIC_SIZE));
+        put_u32(out, CACHE_VERSION);
+        put_u64(out, static_cast<uint64_t>(trusted_before_ns_));
+        put_u64(out, entries_.size());
+        for (const auto& entry : entries_) {
+            put_string(out, entry.path);
+            put_u64(out, static_cast<uint64_t>(entry.mtime_ns));
+            put_u64(out, entry.size);
+            put_u64(out, entry.hash);
+            put_string(out, entry.error);
+            put_string(out, entry.listing.id);
+            put_string(out, entry.listing.name);
+            put_string(out, entry.listing.car);
+            put_string(out, entry.listing.track);
+            put_u32(out, static_cast<uint32_t>(entry.listing.tags.size()));
+            for (const auto& tag : entry.listing.tags) put_string(out, tag);
+            put_string(out, entry.listing.created_at);
+            put_u64(out, entry.encoded.size());
+            out.append(entry.encoded);
+            if (out.size() >= WRITE_CHUNK) flush();
+        }
+        put_u32(out, TRAILER);
+        put_u64(out, entries_.size());
+        flush();
+
+        if (!file.flush()) {
+            throw std::runtime_error("Failed to write " + temporary);
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, cache_path_, error);
+    if (error) {
+        std::filesystem::remove(temporary, error);
+        throw std::runtime_error("Failed to replace " + cache_path_);
+    }
+}
+
+} // namespace orsf
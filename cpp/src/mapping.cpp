@@ -1,14 +1,194 @@
 #include "orsf/mapping.hpp"
 #include "orsf/utils.hpp"
+#include "orsf/instrument.hpp"
+#include <cmath>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
 
 namespace orsf {
 
+namespace {
+
+template<typename T>
+std::optional<double> as_double(const std::optional<T>& value) {
+    if (!value.has_value()) return std::nullopt;
+    return static_cast<double>(value.value());
+}
+
+// Integer fields (levels, counts) take the nearest value
+template<typename T>
+void assign(std::optional<T>& field, double value) {
+    if constexpr (std::is_integral_v<T>) {
+        field = static_cast<T>(std::lround(value));
+    } else {
+        field = static_cast<T>(value);
+    }
+}
+
+// Accessors for optional setup sections (setup.<section>.<field>)
+#define ORSF_SECTION_GETTER(section, field) \
+    [](const ORSF& o) -> std::optional<double> { \
+        if (!o.setup.section.has_value()) return std::nullopt; \
+        return as_double(o.setup.section->field); \
+    }
+
+// Accessors for per-corner suspension fields
+#define ORSF_CORNER_GETTER(corner, field) \
+    [](const ORSF& o) -> std::optional<double> { \
+        if (!o.setup.suspension.has_value() || !o.setup.suspension->corner.has_value()) return std::nullopt; \
+        return as_double(o.setup.suspension->corner->field); \
+    }
+
+#define ORSF_CONTEXT_GETTER(field) \
+    [](const ORSF& o) -> std::optional<double> { \
+        if (!o.context.has_value()) return std::nullopt; \
+        return as_double(o.context->field); \
+    }
+
+// Mutators matching the accessors above; missing sections are created
+#define ORSF_SECTION_SETTER(section, field) \
+    [](ORSF& o, double value) { \
+        if (!o.setup.section.has_value()) o.setup.section.emplace(); \
+        assign(o.setup.section->field, value); \
+    }
+
+#define ORSF_CORNER_SETTER(corner, field) \
+    [](ORSF& o, double value) { \
+        if (!o.setup.suspension.has_value()) o.setup.suspension.emplace(); \
+        if (!o.setup.suspension->corner.has_value()) o.setup.suspension->corner.emplace(); \
+        assign(o.setup.suspension->corner->field, value); \
+    }
+
+#define ORSF_CONTEXT_SETTER(field) \
+    [](ORSF& o, double value) { \
+        if (!o.context.has_value()) o.context.emplace(); \
+        assign(o.context->field, value); \
+    }
+
+// Table entries: path, accessor and mutator of one field
+#define ORSF_SECTION_FIELD(section, field) \
+    {"setup." #section "." #field, ORSF_SECTION_GETTER(section, field), ORSF_SECTION_SETTER(section, field)}
+
+#define ORSF_CORNER_FIELD(corner, field) \
+    {"setup.suspension." #corner "." #field, ORSF_CORNER_GETTER(corner, field), ORSF_CORNER_SETTER(corner, field)}
+
+#define ORSF_CONTEXT_FIELD(field) \
+    {"context." #field, ORSF_CONTEXT_GETTER(field), ORSF_CONTEXT_SETTER(field)}
+
+#define ORSF_CORNER_ENTRIES(corner) \
+    ORSF_CORNER_FIELD(corner, camber_deg), \
+    ORSF_CORNER_FIELD(corner, toe_deg), \
+    ORSF_CORNER_FIELD(corner, caster_deg), \
+    ORSF_CORNER_FIELD(corner, spring_rate_n_mm), \
+    ORSF_CORNER_FIELD(corner, ride_height_mm), \
+    ORSF_CORNER_FIELD(corner, bumpstop_gap_mm), \
+    ORSF_CORNER_FIELD(corner, bumpstop_rate_n_mm), \
+    ORSF_CORNER_FIELD(corner, packer_mm), \
+    ORSF_CORNER_FIELD(corner, damper_bump_slow_n_s_m), \
+    ORSF_CORNER_FIELD(corner, damper_bump_fast_n_s_m), \
+    ORSF_CORNER_FIELD(corner, damper_rebound_slow_n_s_m), \
+    ORSF_CORNER_FIELD(corner, damper_rebound_fast_n_s_m)
+
+using FieldSetter = void (*)(ORSF&, double);
+
+struct FieldEntry {
+    const char* path;
+    FieldGetter getter;
+    FieldSetter setter;
+};
+
+// Every numeric ORSF field, in schema order
+const std::vector<FieldEntry>& field_table() {
+    static const std::vector<FieldEntry> table = {
+        ORSF_CONTEXT_FIELD(ambient_temp_c),
+        ORSF_CONTEXT_FIELD(track_temp_c),
+        ORSF_CONTEXT_FIELD(wetness),
+
+        ORSF_SECTION_FIELD(aero, front_wing),
+        ORSF_SECTION_FIELD(aero, rear_wing),
+        ORSF_SECTION_FIELD(aero, front_downforce_n),
+        ORSF_SECTION_FIELD(aero, rear_downforce_n),
+        ORSF_SECTION_FIELD(aero, front_ride_height_mm),
+        ORSF_SECTION_FIELD(aero, rear_ride_height_mm),
+        ORSF_SECTION_FIELD(aero, rake_mm),
+        ORSF_SECTION_FIELD(aero, brake_duct_front_pct),
+        ORSF_SECTION_FIELD(aero, brake_duct_rear_pct),
+        ORSF_SECTION_FIELD(aero, radiator_opening_pct),
+
+        ORSF_CORNER_ENTRIES(front_left),
+        ORSF_CORNER_ENTRIES(front_right),
+        ORSF_CORNER_ENTRIES(rear_left),
+        ORSF_CORNER_ENTRIES(rear_right),
+        ORSF_SECTION_FIELD(suspension, front_arb),
+        ORSF_SECTION_FIELD(suspension, rear_arb),
+        ORSF_SECTION_FIELD(suspension, heave_spring_n_mm),
+        ORSF_SECTION_FIELD(suspension, heave_packer_mm),
+
+        ORSF_SECTION_FIELD(tires, pressure_fl_kpa),
+        ORSF_SECTION_FIELD(tires, pressure_fr_kpa),
+        ORSF_SECTION_FIELD(tires, pressure_rl_kpa),
+        ORSF_SECTION_FIELD(tires, pressure_rr_kpa),
+        ORSF_SECTION_FIELD(tires, stagger_mm),
+
+        ORSF_SECTION_FIELD(drivetrain, diff_preload_nm),
+        ORSF_SECTION_FIELD(drivetrain, diff_power_ramp_pct),
+        ORSF_SECTION_FIELD(drivetrain, diff_coast_ramp_pct),
+        ORSF_SECTION_FIELD(drivetrain, final_drive_ratio),
+        ORSF_SECTION_FIELD(drivetrain, lsd_clutch_plates),
+
+        ORSF_SECTION_FIELD(gearing, reverse_ratio),
+
+        ORSF_SECTION_FIELD(brakes, brake_bias_pct),
+        ORSF_SECTION_FIELD(brakes, max_force_n),
+
+        ORSF_SECTION_FIELD(electronics, tc_level),
+        ORSF_SECTION_FIELD(electronics, tc2_level),
+        ORSF_SECTION_FIELD(electronics, abs_level),
+        ORSF_SECTION_FIELD(electronics, engine_map),
+        ORSF_SECTION_FIELD(electronics, engine_brake_level),
+        ORSF_SECTION_FIELD(electronics, pit_limiter_kph),
+
+        ORSF_SECTION_FIELD(fuel, start_fuel_l),
+        ORSF_SECTION_FIELD(fuel, per_lap_consumption_l),
+        ORSF_SECTION_FIELD(fuel, stint_target_laps),
+        ORSF_SECTION_FIELD(fuel, mixture_setting),
+    };
+    return table;
+}
+
+FieldSetter find_setter(const std::string& path) {
+    static const std::unordered_map<std::string, FieldSetter> index = [] {
+        std::unordered_map<std::string, FieldSetter> result;
+        for (const auto& entry : field_table()) {
+            result.emplace(entry.path, entry.setter);
+        }
+        return result;
+    }();
+
+    auto it = index.find(path);
+    return it != index.end() ? it->second : nullptr;
+}
+
+#undef ORSF_CORNER_ENTRIES
+#undef ORSF_CONTEXT_FIELD
+#undef ORSF_CORNER_FIELD
+#undef ORSF_SECTION_FIELD
+#undef ORSF_CONTEXT_SETTER
+#undef ORSF_CORNER_SETTER
+#undef ORSF_SECTION_SETTER
+#undef ORSF_CONTEXT_GETTER
+#undef ORSF_CORNER_GETTER
+#undef ORSF_SECTION_GETTER
+
+} // namespace
+
 // ============================================================================
 // Mapping Engine Implementation
 // ============================================================================
 
 FlatSetup MappingEngine::flatten_orsf(const ORSF& orsf) {
+    ORSF_STAGE(stage, Flatten);
     FlatSetup flat;
 
     flatten_aero(orsf.setup.aero, flat);
@@ -39,6 +219,7 @@ FlatSetup MappingEngine::map_to_native(
     const ORSF& orsf,
     const std::vector<FieldMapping>& mappings
 ) {
+    ORSF_STAGE(stage, MapToNative);
     FlatSetup native;
 
     for (const auto& mapping : mappings) {
@@ -68,6 +249,7 @@ ORSF MappingEngine::map_to_orsf(
     const std::vector<FieldMapping>& mappings,
     const ORSF& template_orsf
 ) {
+    ORSF_STAGE(stage, MapToOrsf);
     ORSF result = template_orsf;
 
     for (const auto& mapping : mappings) {
@@ -93,186 +275,129 @@ ORSF MappingEngine::map_to_orsf(
 }
 
 std::optional<double> MappingEngine::get_value(const ORSF& orsf, const std::string& path) {
-    auto parts = split_path(path);
-
-    if (parts.empty()) return std::nullopt;
-
-    // Navigate the path
-    if (parts[0] != "setup") return std::nullopt;
-    if (parts.size() < 2) return std::nullopt;
-
-    const std::string& section = parts[1];
-
-    // Aerodynamics
-    if (section == "aero" && orsf.setup.aero.has_value()) {
-        const auto& aero = orsf.setup.aero.value();
-        if (parts.size() < 3) return std::nullopt;
-
-        if (parts[2] == "front_wing") return aero.front_wing;
-        if (parts[2] == "rear_wing") return aero.rear_wing;
-        if (parts[2] == "front_downforce_n") return aero.front_downforce_n;
-        if (parts[2] == "rear_downforce_n") return aero.rear_downforce_n;
-        if (parts[2] == "front_ride_height_mm") return aero.front_ride_height_mm;
-        if (parts[2] == "rear_ride_height_mm") return aero.rear_ride_height_mm;
-        if (parts[2] == "rake_mm") return aero.rake_mm;
-        if (parts[2] == "brake_duct_front_pct") return aero.brake_duct_front_pct;
-        if (parts[2] == "brake_duct_rear_pct") return aero.brake_duct_rear_pct;
-        if (parts[2] == "radiator_opening_pct") return aero.radiator_opening_pct;
-    }
+    // Same field list as the precompiled getters, so MappingPlan agrees with get_value
+    FieldGetter getter = find_getter(path);
+    if (getter == nullptr) return std::nullopt;
+    return getter(orsf);
+}
 
-    // Suspension
-    if (section == "suspension" && orsf.setup.suspension.has_value()) {
-        const auto& susp = orsf.setup.suspension.value();
-        if (parts.size() < 3) return std::nullopt;
-
-        // Corner-specific
-        const CornerSuspension* corner = nullptr;
-        if (parts[2] == "front_left") corner = susp.front_left.has_value() ? &susp.front_left.value() : nullptr;
-        else if (parts[2] == "front_right") corner = susp.front_right.has_value() ? &susp.front_right.value() : nullptr;
-        else if (parts[2] == "rear_left") corner = susp.rear_left.has_value() ? &susp.rear_left.value() : nullptr;
-        else if (parts[2] == "rear_right") corner = susp.rear_right.has_value() ? &susp.rear_right.value() : nullptr;
-
-        if (corner && parts.size() >= 4) {
-            if (parts[3] == "camber_deg") return corner->camber_deg;
-            if (parts[3] == "toe_deg") return corner->toe_deg;
-            if (parts[3] == "caster_deg") return corner->caster_deg;
-            if (parts[3] == "spring_rate_n_mm") return corner->spring_rate_n_mm;
-            if (parts[3] == "ride_height_mm") return corner->ride_height_mm;
-            if (parts[3] == "bumpstop_gap_mm") return corner->bumpstop_gap_mm;
-            if (parts[3] == "bumpstop_rate_n_mm") return corner->bumpstop_rate_n_mm;
-            if (parts[3] == "damper_bump_slow_n_s_m") return corner->damper_bump_slow_n_s_m;
-            if (parts[3] == "damper_bump_fast_n_s_m") return corner->damper_bump_fast_n_s_m;
-            if (parts[3] == "damper_rebound_slow_n_s_m") return corner->damper_rebound_slow_n_s_m;
-            if (parts[3] == "damper_rebound_fast_n_s_m") return corner->damper_rebound_fast_n_s_m;
-        }
+void MappingEngine::set_value(ORSF& orsf, const std::string& path, double value) {
+    // Same field list as get_value, so every readable path round-trips
+    FieldSetter setter = find_setter(path);
+    if (setter == nullptr) return; // Unknown path
+    setter(orsf, value);
+}
 
-        // ARBs
-        if (parts[2] == "front_arb") return susp.front_arb;
-        if (parts[2] == "rear_arb") return susp.rear_arb;
-        if (parts[2] == "heave_spring_n_mm") return susp.heave_spring_n_mm;
-    }
+std::vector<std::string> MappingEngine::split_path(const std::string& path) {
+    return StringUtils::split(path, '.');
+}
 
-    // Tires
-    if (section == "tires" && orsf.setup.tires.has_value()) {
-        const auto& tires = orsf.setup.tires.value();
-        if (parts.size() < 3) return std::nullopt;
+FieldGetter MappingEngine::find_getter(const std::string& path) {
+    static const std::unordered_map<std::string, FieldGetter> index = [] {
+        std::unordered_map<std::string, FieldGetter> result;
+        for (const auto& entry : field_table()) {
+            result.emplace(entry.path, entry.getter);
+        }
+        return result;
+    }();
 
-        if (parts[2] == "pressure_fl_kpa") return tires.pressure_fl_kpa;
-        if (parts[2] == "pressure_fr_kpa") return tires.pressure_fr_kpa;
-        if (parts[2] == "pressure_rl_kpa") return tires.pressure_rl_kpa;
-        if (parts[2] == "pressure_rr_kpa") return tires.pressure_rr_kpa;
-        if (parts[2] == "stagger_mm") return tires.stagger_mm;
-    }
+    auto it = index.find(path);
+    return it != index.end() ? it->second : nullptr;
+}
 
-    // Drivetrain
-    if (section == "drivetrain" && orsf.setup.drivetrain.has_value()) {
-        const auto& dt = orsf.setup.drivetrain.value();
-        if (parts.size() < 3) return std::nullopt;
-
-        if (parts[2] == "diff_preload_nm") return dt.diff_preload_nm;
-        if (parts[2] == "diff_power_ramp_pct") return dt.diff_power_ramp_pct;
-        if (parts[2] == "diff_coast_ramp_pct") return dt.diff_coast_ramp_pct;
-        if (parts[2] == "final_drive_ratio") return dt.final_drive_ratio;
-        if (parts[2] == "lsd_clutch_plates" && dt.lsd_clutch_plates.has_value())
-            return static_cast<double>(dt.lsd_clutch_plates.value());
-    }
+const std::vector<std::string>& MappingEngine::numeric_field_paths() {
+    static const std::vector<std::string> paths = [] {
+        std::vector<std::string> result;
+        for (const auto& entry : field_table()) {
+            result.emplace_back(entry.path);
+        }
+        return result;
+    }();
+    return paths;
+}
 
-    // Brakes
-    if (section == "brakes" && orsf.setup.brakes.has_value()) {
-        const auto& brakes = orsf.setup.brakes.value();
-        if (parts.size() < 3) return std::nullopt;
+std::optional<size_t> MappingEngine::numeric_field_index(const std::string& path) {
+    static const std::unordered_map<std::string, size_t> index = [] {
+        std::unordered_map<std::string, size_t> result;
+        const auto& table = field_table();
+        for (size_t i = 0; i < table.size(); ++i) {
+            result.emplace(table[i].path, i);
+        }
+        return result;
+    }();
 
-        if (parts[2] == "brake_bias_pct") return brakes.brake_bias_pct;
-        if (parts[2] == "max_force_n") return brakes.max_force_n;
-    }
+    auto it = index.find(path);
+    if (it == index.end()) return std::nullopt;
+    return it->second;
+}
 
-    // Electronics
-    if (section == "electronics" && orsf.setup.electronics.has_value()) {
-        const auto& elec = orsf.setup.electronics.value();
-        if (parts.size() < 3) return std::nullopt;
-
-        if (parts[2] == "tc_level" && elec.tc_level.has_value())
-            return static_cast<double>(elec.tc_level.value());
-        if (parts[2] == "abs_level" && elec.abs_level.has_value())
-            return static_cast<double>(elec.abs_level.value());
-        if (parts[2] == "engine_map" && elec.engine_map.has_value())
-            return static_cast<double>(elec.engine_map.value());
-        if (parts[2] == "pit_limiter_kph") return elec.pit_limiter_kph;
+FieldValues MappingEngine::extract_fields(const ORSF& orsf) {
+    const auto& table = field_table();
+    FieldValues values(table.size());
+    for (size_t i = 0; i < table.size(); ++i) {
+        values[i] = table[i].getter(orsf);
     }
+    return values;
+}
 
-    // Fuel
-    if (section == "fuel" && orsf.setup.fuel.has_value()) {
-        const auto& fuel = orsf.setup.fuel.value();
-        if (parts.size() < 3) return std::nullopt;
+// ============================================================================
+// Mapping Plan Implementation
+// ============================================================================
 
-        if (parts[2] == "start_fuel_l") return fuel.start_fuel_l;
-        if (parts[2] == "per_lap_consumption_l") return fuel.per_lap_consumption_l;
-        if (parts[2] == "stint_target_laps" && fuel.stint_target_laps.has_value())
-            return static_cast<double>(fuel.stint_target_laps.value());
+MappingPlan::MappingPlan(std::vector<FieldMapping> mappings)
+    : mappings_(std::move(mappings)) {
+    steps_.reserve(mappings_.size());
+    for (const auto& mapping : mappings_) {
+        auto index = MappingEngine::numeric_field_index(mapping.orsf_path);
+        steps_.push_back(Step{
+            MappingEngine::find_getter(mapping.orsf_path),
+            index.has_value() ? index.value() : NO_FIELD
+        });
     }
-
-    return std::nullopt;
 }
 
-void MappingEngine::set_value(ORSF& orsf, const std::string& path, double value) {
-    auto parts = split_path(path);
-
-    if (parts.empty() || parts[0] != "setup" || parts.size() < 3) {
-        return; // Invalid path
+std::optional<double> MappingPlan::read(const ORSF& orsf, size_t i) const {
+    if (steps_[i].getter != nullptr) {
+        return steps_[i].getter(orsf);
     }
+    return MappingEngine::get_value(orsf, mappings_[i].orsf_path);
+}
 
-    const std::string& section = parts[1];
-    const std::string& field = parts[2];
+void MappingPlan::emit(FlatSetup& native, size_t i, std::optional<double> value) const {
+    const FieldMapping& mapping = mappings_[i];
 
-    // Aerodynamics
-    if (section == "aero") {
-        if (!orsf.setup.aero.has_value()) {
-            orsf.setup.aero = Aerodynamics{};
+    if (value.has_value()) {
+        double mapped_value = value.value();
+        if (mapping.to_native.has_value()) {
+            mapped_value = mapping.to_native.value()(mapped_value);
         }
-        auto& aero = orsf.setup.aero.value();
-
-        if (field == "front_wing") aero.front_wing = value;
-        else if (field == "rear_wing") aero.rear_wing = value;
-        else if (field == "front_downforce_n") aero.front_downforce_n = value;
-        else if (field == "rear_downforce_n") aero.rear_downforce_n = value;
-        else if (field == "front_ride_height_mm") aero.front_ride_height_mm = value;
-        else if (field == "rear_ride_height_mm") aero.rear_ride_height_mm = value;
-        else if (field == "rake_mm") aero.rake_mm = value;
-        else if (field == "brake_duct_front_pct") aero.brake_duct_front_pct = value;
-        else if (field == "brake_duct_rear_pct") aero.brake_duct_rear_pct = value;
-        else if (field == "radiator_opening_pct") aero.radiator_opening_pct = value;
+        native[mapping.native_key] = mapped_value;
+    } else if (mapping.required) {
+        throw std::runtime_error("Required field missing: " + mapping.orsf_path);
     }
+}
 
-    // Tires
-    else if (section == "tires") {
-        if (!orsf.setup.tires.has_value()) {
-            orsf.setup.tires = Tires{};
-        }
-        auto& tires = orsf.setup.tires.value();
-
-        if (field == "pressure_fl_kpa") tires.pressure_fl_kpa = value;
-        else if (field == "pressure_fr_kpa") tires.pressure_fr_kpa = value;
-        else if (field == "pressure_rl_kpa") tires.pressure_rl_kpa = value;
-        else if (field == "pressure_rr_kpa") tires.pressure_rr_kpa = value;
-        else if (field == "stagger_mm") tires.stagger_mm = value;
+FlatSetup MappingPlan::to_native(const ORSF& orsf) const {
+    ORSF_STAGE(stage, MapToNative);
+    FlatSetup native;
+    for (size_t i = 0; i < mappings_.size(); ++i) {
+        emit(native, i, read(orsf, i));
     }
+    return native;
+}
 
-    // Brakes
-    else if (section == "brakes") {
-        if (!orsf.setup.brakes.has_value()) {
-            orsf.setup.brakes = Brakes{};
-        }
-        auto& brakes = orsf.setup.brakes.value();
-
-        if (field == "brake_bias_pct") brakes.brake_bias_pct = value;
-        else if (field == "max_force_n") brakes.max_force_n = value;
+FlatSetup MappingPlan::to_native(const ORSF& orsf, const FieldValues& values) const {
+    ORSF_STAGE(stage, MapToNative);
+    FlatSetup native;
+    for (size_t i = 0; i < mappings_.size(); ++i) {
+        size_t field = steps_[i].field_index;
+        emit(native, i, field != NO_FIELD && field < values.size() ? values[field] : read(orsf, i));
     }
-
-    // Add more sections as needed...
+    return native;
 }
 
-std::vector<std::string> MappingEngine::split_path(const std::string& path) {
-    return StringUtils::split(path, '.');
+ORSF MappingPlan::to_orsf(const FlatSetup& native, const ORSF& template_orsf) const {
+    return MappingEngine::map_to_orsf(native, mappings_, template_orsf);
 }
 
 // ============================================================================
@@ -0,0 +1,423 @@
+#include "orsf/pipeline.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace orsf {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using ItemPtr = std::unique_ptr<ImportItem>;
+
+enum StageIndex : size_t { READ, PARSE, VALIDATE, TRANSFORM, SINK, STAGE_COUNT };
+
+constexpr const char* STAGE_NAMES[STAGE_COUNT] = {"read", "parse", "validate", "transform", "sink"};
+
+/// Spin briefly, then yield, then sleep with growing pauses
+///
+/// Stages wait on queues without locks; a short spin catches the common
+/// case of an item arriving right away, sleeping keeps idle stages cheap.
+class Backoff {
+public:
+    void pause() {
+        if (step_ < 16) {
+            ++step_;
+        } else if (step_ < 32) {
+            ++step_;
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(sleep_);
+            sleep_ = std::min(sleep_ * 2, std::chrono::microseconds(1000));
+        }
+    }
+
+private:
+    unsigned step_ = 0;
+    std::chrono::microseconds sleep_{20};
+};
+
+/// Queue into a stage; closed once all workers of the stage before it finished
+struct Link {
+    explicit Link(size_t capacity) : queue(capacity) {}
+
+    BoundedQueue<ItemPtr> queue;
+    std::atomic<size_t> producers{0};
+};
+
+/// Times and counts of one stage, summed over its workers
+struct StageTotals {
+    std::atomic<uint64_t> items{0};
+    std::atomic<int64_t> busy{0};
+    std::atomic<int64_t> starved{0};
+    std::atomic<int64_t> blocked{0};
+};
+
+int64_t since(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+void read_buffered(ImportItem& item) {
+    std::ifstream file(item.source, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Failed to open " + item.source);
+    }
+    auto text = std::make_shared<std::string>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) {
+        throw std::runtime_error("Failed to read " + item.source);
+    }
+    item.data = ByteSpan(std::string_view(*text));
+    item.storage = std::move(text);
+}
+
+/// Map the file read-only; false if it cannot be mapped (empty, special file)
+bool read_mapped(ImportItem& item) {
+#ifdef _WIN32
+    (void)item;
+    return false;
+#else
+    int fd = ::open(item.source.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open " + item.source + ": " + std::strerror(errno));
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) return false;
+    ::madvise(address, size, MADV_SEQUENTIAL);
+
+    item.data = ByteSpan(address, size);
+    item.storage = std::shared_ptr<const void>(address, [size](const void* mapped) {
+        ::munmap(const_cast<void*>(mapped), size);
+    });
+    return true;
+#endif
+}
+
+} // namespace
+
+// ============================================================================
+// Import Results Implementation
+// ============================================================================
+
+bool ImportItem::invalid() const {
+    return std::any_of(findings.begin(), findings.end(),
+        [](const ValidationError& e) { return e.severity == ValidationSeverity::Error; });
+}
+
+double ImportStageStats::utilization(std::chrono::nanoseconds elapsed) const {
+    double available = static_cast<double>(elapsed.count()) * static_cast<double>(workers);
+    return available > 0.0 ? std::min(1.0, static_cast<double>(busy.count()) / available) : 0.0;
+}
+
+json ImportStats::to_json() const {
+    json stage_list = json::array();
+    for (const auto& stage : stages) {
+        stage_list.push_back({
+            {"name", stage.name},
+            {"workers", stage.workers},
+            {"items", stage.items},
+            {"busy_ms", static_cast<double>(stage.busy.count()) / 1e6},
+            {"starved_ms", static_cast<double>(stage.starved.count()) / 1e6},
+            {"blocked_ms", static_cast<double>(stage.blocked.count()) / 1e6},
+            {"utilization", stage.utilization(elapsed)},
+        });
+    }
+    return {
+        {"elapsed_ms", static_cast<double>(elapsed.count()) / 1e6},
+        {"items", items},
+        {"failed", failed},
+        {"invalid", invalid},
+        {"bytes", bytes},
+        {"cancelled", cancelled},
+        {"stages", std::move(stage_list)},
+    };
+}
+
+// ============================================================================
+// Import Pipeline Implementation
+// ============================================================================
+
+ImportPipeline::ImportPipeline(ImportOptions options) : options_(std::move(options)) {
+    if (!options_.sink) {
+        throw std::runtime_error("ImportPipeline needs a sink");
+    }
+}
+
+ImportStats ImportPipeline::run(const std::vector<std::string>& paths) {
+    cancelled_.store(false, std::memory_order_relaxed);
+    const auto start = Clock::now();
+
+    // Size to the shared executor so a service that caps it caps imports too
+    const size_t shared = default_executor()->concurrency();
+    const size_t requested[STAGE_COUNT] = {
+        options_.read_workers, options_.parse_workers, options_.validate_workers,
+        options_.transform_workers, options_.sink_workers,
+    };
+    size_t workers[STAGE_COUNT];
+
+    // Readers mostly wait on the disk and are not counted against the budget
+    workers[READ] = requested[READ] == 0 ? shared : requested[READ];
+
+    // Automatic compute stages share what the fixed ones leave of the budget
+    size_t fixed = 0;
+    size_t automatic = 0;
+    for (size_t s = PARSE; s < STAGE_COUNT; ++s) {
+        if (requested[s] == 0) ++automatic;
+        else fixed += requested[s];
+    }
+    size_t remaining = shared > fixed ? shared - fixed : 0;
+    size_t total = 0;
+    for (size_t s = PARSE; s < STAGE_COUNT; ++s) {
+        workers[s] = requested[s] != 0 ? requested[s] : std::max<size_t>(1, remaining / automatic);
+        total += workers[s];
+    }
+
+    // Trim the widest stage until the compute threads fit (one per stage at least)
+    while (total > shared) {
+        size_t widest = PARSE;
+        for (size_t s = PARSE + 1; s < STAGE_COUNT; ++s) {
+            if (workers[s] > workers[widest]) widest = s;
+        }
+        if (workers[widest] == 1) break;
+        --workers[widest];
+        --total;
+    }
+
+    // One thread drives the reader; its queue depth provides the parallelism
+    std::unique_ptr<AsyncFileReader> reader;
+    if (options_.async_io) {
+        reader = std::make_unique<AsyncFileReader>(options_.io);
+        workers[READ] = 1;
+    }
+
+    // links[s] feeds stage s + 1
+    std::vector<std::unique_ptr<Link>> links;
+    for (size_t s = 0; s + 1 < STAGE_COUNT; ++s) {
+        links.push_back(std::make_unique<Link>(options_.queue_capacity));
+        links.back()->producers.store(workers[s], std::memory_order_relaxed);
+    }
+
+    StageTotals totals[STAGE_COUNT];
+    std::atomic<size_t> next_path{0};
+    std::atomic<uint64_t> failed{0};
+    std::atomic<uint64_t> invalid{0};
+    std::atomic<uint64_t> bytes{0};
+    std::mutex error_mutex;
+    std::exception_ptr run_error;
+
+    auto fail = [&](std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!run_error) run_error = error;
+        cancel();
+    };
+
+    auto pop = [this](Link& link, ItemPtr& item) {
+        Backoff backoff;
+        while (!cancelled()) {
+            if (link.queue.try_pop(item)) return true;
+            if (link.producers.load(std::memory_order_acquire) == 0) {
+                // Producers finished; anything they pushed is visible now
+                return link.queue.try_pop(item);
+            }
+            backoff.pause();
+        }
+        return false;
+    };
+
+    auto push = [this](Link& link, ItemPtr& item) {
+        Backoff backoff;
+        while (!cancelled()) {
+            if (link.queue.try_push(item)) return true;
+            backoff.pause();
+        }
+        return false;
+    };
+
+    auto process = [&](size_t stage, ImportItem& item) {
+        switch (stage) {
+        case READ:
+            item.bytes = item.data.size();
+            bytes.fetch_add(item.bytes, std::memory_order_relaxed);
+            break;
+        case PARSE:
+            if (options_.adapter) {
+                item.setup = options_.adapter->decode_native(item.data);
+            } else {
+                item.setup = parse_orsf_json(item.data);
+            }
+            break;
+        case VALIDATE:
+            if (options_.validate) item.findings = Validator::validate(item.setup);
+            break;
+        case TRANSFORM:
+            if (options_.transform) options_.transform(item);
+            break;
+        default:
+            break;
+        }
+    };
+
+    // Read stage in async_io mode: files arrive from the reader in completion order
+    auto async_reader = [&] {
+        Link& out = *links[READ];
+        int64_t busy = 0;
+        int64_t blocked = 0;
+        uint64_t items = 0;
+
+        auto began = Clock::now();
+        try {
+            reader->read_files(paths, [&](FileReadResult& file) {
+                if (cancelled()) {
+                    reader->cancel();
+                    return;
+                }
+                auto item = std::make_unique<ImportItem>();
+                item->index = file.index;
+                item->source = std::string(file.path);
+                item->error = std::move(file.error);
+                auto buffer = std::make_shared<ByteBuffer>(std::move(file.data));
+                item->data = buffer->span();
+                item->storage = std::move(buffer);
+                process(READ, *item);
+                ++items;
+
+                auto pushed = Clock::now();
+                if (!push(out, item)) reader->cancel();
+                blocked += since(pushed);
+            });
+        } catch (...) {
+            fail(std::current_exception());
+        }
+        busy = since(began) - blocked;
+
+        out.producers.fetch_sub(1, std::memory_order_release);
+        totals[READ].items.fetch_add(items, std::memory_order_relaxed);
+        totals[READ].busy.fetch_add(busy, std::memory_order_relaxed);
+        totals[READ].blocked.fetch_add(blocked, std::memory_order_relaxed);
+    };
+
+    auto worker = [&](size_t stage) {
+        Link* in = stage == READ ? nullptr : links[stage - 1].get();
+        Link* out = stage == SINK ? nullptr : links[stage].get();
+        int64_t busy = 0;
+        int64_t starved = 0;
+        int64_t blocked = 0;
+        uint64_t items = 0;
+
+        for (;;) {
+            ItemPtr item;
+            auto waited = Clock::now();
+            if (in) {
+                if (!pop(*in, item)) break;
+            } else {
+                size_t index = next_path.fetch_add(1, std::memory_order_relaxed);
+                if (index >= paths.size() || cancelled()) break;
+                item = std::make_unique<ImportItem>();
+                item->index = index;
+                item->source = paths[index];
+            }
+            starved += since(waited);
+
+            auto began = Clock::now();
+            if (stage == SINK) {
+                if (!item->ok()) failed.fetch_add(1, std::memory_order_relaxed);
+                if (item->invalid()) invalid.fetch_add(1, std::memory_order_relaxed);
+                try {
+                    options_.sink(*item);
+                } catch (...) {
+                    fail(std::current_exception());
+                }
+            } else if (stage == READ) {
+                try {
+                    if (!options_.use_mmap || !read_mapped(*item)) read_buffered(*item);
+                } catch (const std::exception& e) {
+                    item->error = e.what();
+                }
+                process(stage, *item);
+            } else if (item->ok()) {
+                try {
+                    process(stage, *item);
+                } catch (const std::exception& e) {
+                    item->error = e.what();
+                }
+                if (stage == PARSE) {
+                    item->data = ByteSpan();
+                    item->storage.reset();
+                }
+            }
+            busy += since(began);
+            ++items;
+
+            if (out) {
+                auto pushed = Clock::now();
+                bool ok = push(*out, item);
+                blocked += since(pushed);
+                if (!ok) break;
+            }
+        }
+
+        if (out) out->producers.fetch_sub(1, std::memory_order_release);
+        totals[stage].items.fetch_add(items, std::memory_order_relaxed);
+        totals[stage].busy.fetch_add(busy, std::memory_order_relaxed);
+        totals[stage].starved.fetch_add(starved, std::memory_order_relaxed);
+        totals[stage].blocked.fetch_add(blocked, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> threads;
+    try {
+        for (size_t s = 0; s < STAGE_COUNT; ++s) {
+            if (s == READ && reader) {
+                threads.emplace_back(async_reader);
+                continue;
+            }
+            for (size_t w = 0; w < workers[s]; ++w) threads.emplace_back(worker, s);
+        }
+    } catch (...) {
+        cancel();
+        for (auto& thread : threads) thread.join();
+        throw;
+    }
+    for (auto& thread : threads) thread.join();
+
+    if (run_error) std::rethrow_exception(run_error);
+
+    ImportStats stats;
+    stats.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+    stats.cancelled = cancelled();
+    stats.failed = failed.load();
+    stats.invalid = invalid.load();
+    stats.bytes = bytes.load();
+    for (size_t s = 0; s < STAGE_COUNT; ++s) {
+        ImportStageStats stage;
+        stage.name = STAGE_NAMES[s];
+        stage.workers = workers[s];
+        stage.items = totals[s].items.load();
+        stage.busy = std::chrono::nanoseconds(totals[s].busy.load());
+        stage.starved = std::chrono::nanoseconds(totals[s].starved.load());
+        stage.blocked = std::chrono::nanoseconds(totals[s].blocked.load());
+        stats.stages.push_back(std::move(stage));
+    }
+    stats.items = stats.stages[SINK].items;
+    return stats;
+}
+
+} // namespace orsf
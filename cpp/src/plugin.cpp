@@ -0,0 +1,323 @@
+#include "orsf/plugin.hpp"
+#include "orsf/instrument.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
+namespace orsf {
+
+namespace {
+
+/// Current resident set size in bytes (0 if unavailable)
+int64_t resident_bytes() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    int64_t size = 0;
+    int64_t resident = 0;
+    if (statm >> size >> resident) {
+        return resident * static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+PluginAdapterEntry entry_from_json(const json& j) {
+    PluginAdapterEntry entry;
+    entry.id = j.at("id").get<std::string>();
+    entry.version = j.at("version").get<std::string>();
+    entry.car_keys = j.at("car_keys").get<std::vector<std::string>>();
+    entry.description = j.value("description", "");
+    entry.file_extension = j.value("file_extension", "");
+
+    if (j.contains("signatures")) {
+        for (const auto& signature : j.at("signatures")) {
+            std::optional<size_t> offset;
+            if (signature.contains("offset")) offset = signature.at("offset").get<size_t>();
+            entry.signatures.emplace_back(signature.at("bytes").get<std::string>(), offset);
+        }
+    }
+    return entry;
+}
+
+} // namespace
+
+// ============================================================================
+// Plugin Manifest Implementation
+// ============================================================================
+
+PluginManifest PluginManifest::from_json(const json& j, const std::string& directory) {
+    PluginManifest manifest;
+    try {
+        std::string format = j.at("format").get<std::string>();
+        if (format != FORMAT) {
+            throw std::runtime_error("Invalid plugin manifest format: " + format + " (expected " + FORMAT + ")");
+        }
+
+        manifest.name = j.at("name").get<std::string>();
+        std::filesystem::path library = j.at("library").get<std::string>();
+        if (library.is_relative()) library = std::filesystem::path(directory) / library;
+        manifest.library = library.lexically_normal().string();
+
+        for (const auto& adapter : j.at("adapters")) {
+            manifest.adapters.push_back(entry_from_json(adapter));
+        }
+    } catch (const json::exception& e) {
+        throw std::runtime_error(std::string("Failed to parse plugin manifest: ") + e.what());
+    }
+
+    if (manifest.name.empty()) {
+        throw std::runtime_error("Plugin manifest has no name");
+    }
+    for (const auto& adapter : manifest.adapters) {
+        if (adapter.id.empty() || adapter.car_keys.empty()) {
+            throw std::runtime_error("Plugin manifest " + manifest.name + " has an adapter without id or car keys");
+        }
+    }
+    return manifest;
+}
+
+// ============================================================================
+// Plugin Implementation
+// ============================================================================
+
+size_t PluginReport::loaded_count() const {
+    return static_cast<size_t>(std::count_if(plugins.begin(), plugins.end(),
+        [](const PluginStats& stats) { return stats.loaded; }));
+}
+
+std::chrono::nanoseconds PluginReport::total_load_time() const {
+    std::chrono::nanoseconds total{0};
+    for (const auto& stats : plugins) total += stats.load_time;
+    return total;
+}
+
+int64_t PluginReport::total_resident_bytes() const {
+    int64_t total = 0;
+    for (const auto& stats : plugins) total += stats.resident_bytes;
+    return total;
+}
+
+Plugin::Plugin(PluginManifest manifest) : manifest_(std::move(manifest)) {}
+
+Plugin::~Plugin() {
+#if !defined(_WIN32)
+    if (handle_ != nullptr) dlclose(handle_);
+#endif
+}
+
+void Plugin::load() {
+    if (api_.load(std::memory_order_acquire) != nullptr) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (api_.load(std::memory_order_relaxed) != nullptr) return;
+    if (!error_.empty()) throw std::runtime_error(error_);
+
+#if defined(_WIN32)
+    error_ = "Plugins are not supported on this platform: " + manifest_.name;
+    throw std::runtime_error(error_);
+#else
+    int64_t resident_before = resident_bytes();
+    auto start = std::chrono::steady_clock::now();
+
+    void* handle = dlopen(manifest_.library.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr) {
+        const char* reason = dlerror();
+        error_ = "Failed to load plugin " + manifest_.name + ": " + (reason != nullptr ? reason : manifest_.library);
+        throw std::runtime_error(error_);
+    }
+
+    auto entry = reinterpret_cast<orsf_plugin_entry_fn>(dlsym(handle, ORSF_PLUGIN_ENTRY_SYMBOL));
+    const orsf_plugin_api* api = entry != nullptr ? entry() : nullptr;
+    if (api == nullptr || api->abi_version != ORSF_PLUGIN_ABI_VERSION ||
+        api->create_adapter == nullptr || api->destroy_adapter == nullptr) {
+        dlclose(handle);
+        error_ = "Plugin " + manifest_.name + " has no compatible " + ORSF_PLUGIN_ENTRY_SYMBOL + " entry point";
+        throw std::runtime_error(error_);
+    }
+
+    load_time_ = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    resident_bytes_ = resident_bytes() - resident_before;
+    handle_ = handle;
+    api_.store(api, std::memory_order_release);
+#endif
+}
+
+std::shared_ptr<Adapter> Plugin::create(const std::string& id, const std::string& version, const std::string& car_key) {
+    load();
+    const orsf_plugin_api* api = api_.load(std::memory_order_acquire);
+
+    Adapter* adapter = api->create_adapter(id.c_str(), version.c_str(), car_key.c_str());
+    if (adapter == nullptr) {
+        throw std::runtime_error("Plugin " + manifest_.name + " does not provide adapter " +
+                                 id + " " + version + " " + car_key);
+    }
+
+    // Adapters keep the library open and are destroyed by the plugin that made them
+    auto self = shared_from_this();
+    return std::shared_ptr<Adapter>(adapter, [self, api](Adapter* created) { api->destroy_adapter(created); });
+}
+
+PluginStats Plugin::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PluginStats stats;
+    stats.name = manifest_.name;
+    stats.library = manifest_.library;
+    stats.loaded = api_.load(std::memory_order_acquire) != nullptr;
+    stats.load_time = load_time_;
+    stats.resident_bytes = resident_bytes_;
+    stats.error = error_;
+    return stats;
+}
+
+// ============================================================================
+// Plugin Adapter Implementation
+// ============================================================================
+
+PluginAdapter::PluginAdapter(std::shared_ptr<Plugin> plugin, const PluginAdapterEntry& entry, const std::string& car_key)
+    : BaseAdapter(entry.id, entry.version, car_key, entry.description),
+      plugin_(std::move(plugin)),
+      file_extension_(entry.file_extension),
+      signatures_(entry.signatures) {}
+
+const Adapter& PluginAdapter::target() const {
+    if (const Adapter* loaded = target_ptr_.load(std::memory_order_acquire)) {
+        return *loaded;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!target_) {
+        auto created = plugin_->create(metadata().id, metadata().version, metadata().car_key);
+        if (auto program = get_rule_program()) created->set_rule_program(std::move(program));
+        target_ = std::move(created);
+        target_ptr_.store(target_.get(), std::memory_order_release);
+    }
+    return *target_;
+}
+
+std::vector<uint8_t> PluginAdapter::orsf_to_native(const ORSF& orsf) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    auto bytes = target().orsf_to_native(orsf);
+    ORSF_STAGE_BYTES(stage, bytes.size());
+    return bytes;
+}
+
+ORSF PluginAdapter::native_to_orsf(const std::vector<uint8_t>& data) const {
+    ORSF_STAGE(stage, AdapterDecode);
+    ORSF_STAGE_BYTES(stage, data.size());
+    return target().native_to_orsf(data);
+}
+
+ORSF PluginAdapter::decode_native(ByteSpan data) const {
+    ORSF_STAGE(stage, AdapterDecode);
+    ORSF_STAGE_BYTES(stage, data.size());
+    return target().decode_native(data);
+}
+
+void PluginAdapter::encode_native(const ORSF& orsf, ByteBuffer& out) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    size_t start = out.size();
+    target().encode_native(orsf, out);
+    ORSF_STAGE_BYTES(stage, out.size() - start);
+    (void)start;
+}
+
+void PluginAdapter::encode_extracted(const ORSF& orsf, const FieldValues& values, ByteBuffer& out) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    size_t start = out.size();
+    target().encode_extracted(orsf, values, out);
+    ORSF_STAGE_BYTES(stage, out.size() - start);
+    (void)start;
+}
+
+void PluginAdapter::write_native(const ORSF& orsf, OutputSink& sink) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    target().write_native(orsf, sink);
+}
+
+std::vector<ValidationError> PluginAdapter::validate_orsf(const ORSF& orsf) const {
+    ORSF_STAGE(stage, AdapterValidate);
+    return target().validate_orsf(orsf);
+}
+
+std::string PluginAdapter::get_suggested_filename() const {
+    return target().get_suggested_filename();
+}
+
+bool PluginAdapter::sniff(ByteSpan head) const {
+    // The manifest signatures stand in for the real check until the adapter is chosen
+    if (!is_loaded() && !signatures_.empty()) return true;
+    return target().sniff(head);
+}
+
+std::optional<std::string> PluginAdapter::get_install_path() const {
+    return target().get_install_path();
+}
+
+std::vector<FieldMapping> PluginAdapter::get_field_mappings() const {
+    return target().get_field_mappings();
+}
+
+void PluginAdapter::set_rule_program(std::shared_ptr<const RuleProgram> program) {
+    BaseAdapter::set_rule_program(program);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (target_) target_->set_rule_program(std::move(program));
+}
+
+// ============================================================================
+// Plugin Index Implementation
+// ============================================================================
+
+PluginIndex PluginIndex::scan(const std::string& directory) {
+    namespace fs = std::filesystem;
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<fs::path> paths;
+    try {
+        const std::string suffix = PluginManifest::SUFFIX;
+        for (const auto& file : fs::directory_iterator(directory)) {
+            std::string name = file.path().filename().string();
+            if (file.is_regular_file() && name.size() > suffix.size() &&
+                name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+                paths.push_back(file.path());
+            }
+        }
+    } catch (const fs::filesystem_error& e) {
+        throw std::runtime_error(std::string("Failed to read plugin directory: ") + e.what());
+    }
+    std::sort(paths.begin(), paths.end());
+
+    PluginIndex index;
+    for (const auto& path : paths) {
+        std::ifstream file(path);
+        if (!file) {
+            throw std::runtime_error("Failed to open plugin manifest: " + path.string());
+        }
+
+        json j;
+        try {
+            j = json::parse(file);
+        } catch (const json::exception& e) {
+            throw std::runtime_error("Failed to parse plugin manifest " + path.string() + ": " + e.what());
+        }
+
+        auto plugin = std::make_shared<Plugin>(PluginManifest::from_json(j, directory));
+        for (const auto& entry : plugin->manifest().adapters) {
+            for (const auto& car_key : entry.car_keys) {
+                index.adapters.push_back(std::make_shared<PluginAdapter>(plugin, entry, car_key));
+            }
+        }
+        index.plugins.push_back(std::move(plugin));
+    }
+
+    index.index_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return index;
+}
+
+} // namespace orsf
@@ -0,0 +1,175 @@
+#include "orsf/profile.hpp"
+#include "orsf/instrument.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace orsf {
+
+// ============================================================================
+// Rule Program Implementation
+// ============================================================================
+
+std::shared_ptr<const RuleProgram> RuleProgram::compile(
+    const std::map<std::string, ValidationProfile>& class_profiles,
+    const ValidationProfile* adapter_profile
+) {
+    auto program = std::make_shared<RuleProgram>();
+
+    std::vector<const ValidationProfile*> layers;
+    if (adapter_profile != nullptr) {
+        layers.push_back(adapter_profile);
+    }
+    program->default_program_ = build(layers, false);
+
+    for (const auto& [car_class, profile] : class_profiles) {
+        std::vector<const ValidationProfile*> class_layers = {&profile};
+        if (adapter_profile != nullptr) {
+            class_layers.push_back(adapter_profile);
+        }
+        program->class_programs_.emplace(car_class, build(class_layers, true));
+    }
+
+    return program;
+}
+
+RuleProgram::Program RuleProgram::standard_program(bool known_class) {
+    auto check = [](Check fn, const char* field = "") {
+        Instruction instruction{Op::Check};
+        instruction.check = fn;
+        instruction.rule.field = field;
+        return instruction;
+    };
+
+    // Same order as Validator::validate
+    Program program = {
+        check([](const ORSF& o, std::vector<ValidationError>& e) { Validator::validate_schema(o, e); }),
+        check([](const ORSF& o, std::vector<ValidationError>& e) { Validator::validate_metadata(o.metadata, e); }),
+        check([](const ORSF& o, std::vector<ValidationError>& e) {
+            Validator::check_required("car.make", !o.car.make.empty(), e);
+            Validator::check_required("car.model", !o.car.model.empty(), e);
+        }),
+    };
+    if (!known_class) {
+        program.push_back(check([](const ORSF& o, std::vector<ValidationError>& e) {
+            Validator::check_car_class(o.car, e);
+        }));
+    }
+
+    for (auto& rule : ColumnarValidator::default_rules()) {
+        Instruction instruction{Op::Range};
+        instruction.getter = MappingEngine::find_getter(rule.field);
+        instruction.rule = std::move(rule);
+        program.push_back(std::move(instruction));
+
+        // Checks the validator runs after this range rule's section fields
+        const std::string& field = program.back().rule.field;
+        if (field == "context.wetness") {
+            program.push_back(check([](const ORSF& o, std::vector<ValidationError>& e) {
+                if (o.context.has_value()) Validator::check_rubber(*o.context, e);
+            }));
+        } else if (field == "setup.drivetrain.final_drive_ratio") {
+            program.push_back(check([](const ORSF& o, std::vector<ValidationError>& e) {
+                if (o.setup.drivetrain.has_value()) Validator::check_clutch_plates(*o.setup.drivetrain, e);
+            }, "setup.drivetrain.lsd_clutch_plates"));
+            program.push_back(check([](const ORSF& o, std::vector<ValidationError>& e) {
+                if (o.setup.gearing.has_value()) Validator::check_gear_ratios(*o.setup.gearing, e);
+            }));
+        } else if (field == "setup.fuel.per_lap_consumption_l") {
+            program.push_back(check([](const ORSF& o, std::vector<ValidationError>& e) {
+                if (o.setup.fuel.has_value()) Validator::check_stint_laps(*o.setup.fuel, e);
+            }, "setup.fuel.stint_target_laps"));
+        }
+    }
+
+    program.push_back(check([](const ORSF& o, std::vector<ValidationError>& e) {
+        Validator::validate_cross_field(o, e);
+    }));
+    return program;
+}
+
+RuleProgram::Program RuleProgram::build(const std::vector<const ValidationProfile*>& layers, bool known_class) {
+    // Later layers replace earlier overrides for the same field
+    std::vector<ColumnRule> overrides;
+    std::vector<ProfileRule> extra_rules;
+    for (const ValidationProfile* layer : layers) {
+        std::unordered_set<std::string> layer_fields;
+        for (const auto& rule : layer->overrides) {
+            layer_fields.insert(rule.field);
+        }
+
+        overrides.erase(
+            std::remove_if(overrides.begin(), overrides.end(),
+                [&](const ColumnRule& rule) { return layer_fields.count(rule.field) > 0; }),
+            overrides.end());
+        overrides.insert(overrides.end(), layer->overrides.begin(), layer->overrides.end());
+        extra_rules.insert(extra_rules.end(), layer->extra_rules.begin(), layer->extra_rules.end());
+    }
+
+    // Overrides take the place of the standard rule on their field, or follow the standard rules
+    Program program = standard_program(known_class);
+    for (const auto& rule : overrides) {
+        Instruction instruction{Op::Range};
+        instruction.getter = MappingEngine::find_getter(rule.field);
+        if (instruction.getter == nullptr) {
+            throw std::runtime_error("Unknown numeric field in validation profile: " + rule.field);
+        }
+        instruction.rule = rule;
+
+        auto it = std::find_if(program.begin(), program.end(),
+            [&](const Instruction& standard) { return standard.rule.field == rule.field; });
+        if (it != program.end()) *it = std::move(instruction);
+        else program.push_back(std::move(instruction));
+    }
+
+    for (auto& rule : extra_rules) {
+        Instruction instruction{Op::Extra};
+        instruction.extra = std::move(rule);
+        program.push_back(std::move(instruction));
+    }
+    return program;
+}
+
+std::vector<ValidationError> RuleProgram::validate(const ORSF& orsf) const {
+    ORSF_STAGE(stage, Validate);
+    const Program* program = &default_program_;
+    if (orsf.car.car_class.has_value()) {
+        auto it = class_programs_.find(orsf.car.car_class.value());
+        if (it != class_programs_.end()) {
+            program = &it->second;
+        }
+    }
+
+    std::vector<ValidationError> errors;
+    run(*program, orsf, errors);
+
+    ORSF_STAGE_ERRORS(stage, std::count_if(errors.begin(), errors.end(),
+        [](const ValidationError& e) { return e.severity == ValidationSeverity::Error; }));
+    return errors;
+}
+
+bool RuleProgram::has_class(const std::string& car_class) const {
+    return class_programs_.count(car_class) > 0;
+}
+
+void RuleProgram::run(const Program& program, const ORSF& orsf, std::vector<ValidationError>& errors) {
+    for (const auto& instruction : program) {
+        switch (instruction.op) {
+            case Op::Range: {
+                auto value = instruction.getter(orsf);
+                if (value.has_value()) {
+                    instruction.rule.check_value(value.value(), errors);
+                }
+                break;
+            }
+            case Op::Check:
+                instruction.check(orsf, errors);
+                break;
+            case Op::Extra:
+                instruction.extra(orsf, errors);
+                break;
+        }
+    }
+}
+
+} // namespace orsf
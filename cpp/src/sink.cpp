@@ -0,0 +1,177 @@
+#include "orsf/sink.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace orsf {
+
+// ============================================================================
+// Output Sinks Implementation
+// ============================================================================
+
+void FdSink::write(const void* data, size_t size) {
+    const auto* remaining = static_cast<const char*>(data);
+
+    while (size > 0) {
+#ifdef _WIN32
+        auto written = ::_write(fd_, remaining, static_cast<unsigned int>(size));
+#else
+        auto written = ::write(fd_, remaining, size);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("Failed to write output: ") + std::strerror(errno));
+        }
+        remaining += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void FixedBufferSink::write(const void* data, size_t size) {
+    if (size > capacity_ - size_) {
+        throw std::runtime_error("Output exceeds fixed buffer capacity of " + std::to_string(capacity_) + " bytes");
+    }
+    if (size > 0) {
+        std::memcpy(buffer_ + size_, data, size);
+        size_ += size;
+    }
+}
+
+// ============================================================================
+// Text Writer Implementation
+// ============================================================================
+
+TextWriter::~TextWriter() {
+    try {
+        drain();
+    } catch (...) {
+        // Destructors must not throw; call flush() to observe errors
+    }
+}
+
+void TextWriter::drain() {
+    if (used_ > 0) {
+        size_t used = used_;
+        used_ = 0;
+        sink_.write(buffer_, used);
+    }
+}
+
+void TextWriter::flush() {
+    drain();
+    sink_.flush();
+}
+
+TextWriter& TextWriter::write(std::string_view text) {
+    if (text.size() > BUFFER_SIZE - used_) {
+        drain();
+        if (text.size() >= BUFFER_SIZE) {
+            sink_.write(text.data(), text.size());
+            return *this;
+        }
+    }
+    std::memcpy(buffer_ + used_, text.data(), text.size());
+    used_ += text.size();
+    return *this;
+}
+
+TextWriter& TextWriter::put(char c) {
+    if (used_ == BUFFER_SIZE) drain();
+    buffer_[used_++] = c;
+    return *this;
+}
+
+TextWriter& TextWriter::number(double value) {
+    // Shortest round-trip form never exceeds 32 characters
+    if (BUFFER_SIZE - used_ < 32) drain();
+    auto result = std::to_chars(buffer_ + used_, buffer_ + BUFFER_SIZE, value);
+    used_ = static_cast<size_t>(result.ptr - buffer_);
+    return *this;
+}
+
+TextWriter& TextWriter::number(int64_t value) {
+    if (BUFFER_SIZE - used_ < 24) drain();
+    auto result = std::to_chars(buffer_ + used_, buffer_ + BUFFER_SIZE, value);
+    used_ = static_cast<size_t>(result.ptr - buffer_);
+    return *this;
+}
+
+TextWriter& TextWriter::key_value(std::string_view key, double value) {
+    return write(key).put('=').number(value).put('\n');
+}
+
+TextWriter& TextWriter::key_value(std::string_view key, int64_t value) {
+    return write(key).put('=').number(value).put('\n');
+}
+
+TextWriter& TextWriter::key_value(std::string_view key, std::string_view value) {
+    return write(key).put('=').write(value).put('\n');
+}
+
+TextWriter& TextWriter::section(std::string_view name) {
+    return put('[').write(name).put(']').put('\n');
+}
+
+// ============================================================================
+// JSON Output
+// ============================================================================
+
+namespace {
+
+// Stream buffer forwarding to a TextWriter (json's operator<< writes through it)
+class TextWriterStreambuf : public std::streambuf {
+public:
+    explicit TextWriterStreambuf(TextWriter& writer) : writer_(writer) {}
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            writer_.put(traits_type::to_char_type(c));
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize count) override {
+        writer_.write(std::string_view(s, static_cast<size_t>(count)));
+        return count;
+    }
+
+private:
+    TextWriter& writer_;
+};
+
+} // namespace
+
+void write_orsf_json(const ORSF& orsf, OutputSink& sink, int indent) {
+    TextWriter writer(sink);
+    try {
+        json j = orsf.to_json();
+
+        // operator<< prints compact at width 0, where dump(0) breaks lines
+        if (indent == 0) {
+            writer.write(j.dump(0));
+        } else {
+            // badbit rethrows what the sink threw instead of swallowing it
+            TextWriterStreambuf buffer(writer);
+            std::ostream stream(&buffer);
+            stream.exceptions(std::ios::badbit);
+            stream << std::setw(std::max(indent, 0)) << j;
+        }
+    } catch (const json::exception& e) {
+        throw std::runtime_error(std::string("Failed to serialize ORSF: ") + e.what());
+    }
+    writer.flush();
+}
+
+} // namespace orsf
@@ -0,0 +1,832 @@
+#include "orsf/spec.hpp"
+#include "orsf/instrument.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+
+namespace orsf {
+
+namespace {
+
+struct OpName {
+    TransformOp op;
+    const char* name;
+};
+
+constexpr OpName OP_NAMES[] = {
+    {TransformOp::Scale, "scale"},
+    {TransformOp::Offset, "offset"},
+    {TransformOp::Linear, "linear"},
+    {TransformOp::Invert, "invert"},
+    {TransformOp::Negate, "negate"},
+    {TransformOp::Clamp, "clamp"},
+    {TransformOp::PercentToRatio, "percent_to_ratio"},
+    {TransformOp::RatioToPercent, "ratio_to_percent"},
+    {TransformOp::UnitConvert, "unit"},
+    {TransformOp::Lookup, "lookup"},
+    {TransformOp::ReverseLookup, "reverse_lookup"},
+    {TransformOp::RoundToStep, "round"},
+};
+
+struct UnitName {
+    Unit unit;
+    const char* name;
+};
+
+constexpr UnitName UNIT_NAMES[] = {
+    {Unit::KPA, "kpa"}, {Unit::PSI, "psi"}, {Unit::BAR, "bar"},
+    {Unit::N_MM, "n_mm"}, {Unit::LB_IN, "lb_in"},
+    {Unit::N_S_M, "n_s_m"}, {Unit::LB_S_IN, "lb_s_in"},
+    {Unit::MM, "mm"}, {Unit::INCHES, "inches"}, {Unit::CM, "cm"},
+    {Unit::CELSIUS, "celsius"}, {Unit::FAHRENHEIT, "fahrenheit"}, {Unit::KELVIN, "kelvin"},
+    {Unit::NM, "nm"}, {Unit::LB_FT, "lb_ft"},
+    {Unit::NEWTONS, "newtons"}, {Unit::POUNDS, "pounds"},
+    {Unit::KPH, "kph"}, {Unit::MPH, "mph"}, {Unit::MS, "ms"},
+    {Unit::LITERS, "liters"}, {Unit::GALLONS_US, "gallons_us"}, {Unit::GALLONS_UK, "gallons_uk"},
+};
+
+constexpr uint32_t BINARY_VERSION = 1;
+constexpr size_t MAGIC_SIZE = 8;
+
+TransformOp op_from_name(const std::string& name) {
+    for (const auto& entry : OP_NAMES) {
+        if (name == entry.name) return entry.op;
+    }
+    throw std::runtime_error("Unknown transform op in adapter spec: " + name);
+}
+
+const char* op_name(TransformOp op) {
+    for (const auto& entry : OP_NAMES) {
+        if (entry.op == op) return entry.name;
+    }
+    throw std::runtime_error("Unknown transform op in adapter spec");
+}
+
+Unit unit_from_name(const std::string& name) {
+    std::string lower = StringUtils::to_lower(name);
+    for (const auto& entry : UNIT_NAMES) {
+        if (lower == entry.name) return entry.unit;
+    }
+    throw std::runtime_error("Unknown unit in adapter spec: " + name);
+}
+
+const char* unit_name(Unit unit) {
+    for (const auto& entry : UNIT_NAMES) {
+        if (entry.unit == unit) return entry.name;
+    }
+    throw std::runtime_error("Unknown unit in adapter spec");
+}
+
+bool is_known_unit(uint8_t value) {
+    for (const auto& entry : UNIT_NAMES) {
+        if (static_cast<uint8_t>(entry.unit) == value) return true;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// JSON form
+// ----------------------------------------------------------------------------
+
+TransformStep step_from_json(const json& j) {
+    TransformStep step;
+    step.op = op_from_name(j.at("op").get<std::string>());
+
+    switch (step.op) {
+        case TransformOp::Scale: step.a = j.at("factor").get<double>(); break;
+        case TransformOp::Offset: step.a = j.at("amount").get<double>(); break;
+        case TransformOp::Linear:
+            step.a = j.at("scale").get<double>();
+            step.b = j.at("offset").get<double>();
+            break;
+        case TransformOp::Clamp:
+            step.a = j.at("min").get<double>();
+            step.b = j.at("max").get<double>();
+            break;
+        case TransformOp::UnitConvert:
+            step.from_unit = unit_from_name(j.at("from").get<std::string>());
+            step.to_unit = unit_from_name(j.at("to").get<std::string>());
+            break;
+        case TransformOp::Lookup:
+        case TransformOp::ReverseLookup:
+            for (const auto& entry : j.at("table")) {
+                step.table.emplace_back(entry.at(0).get<double>(), entry.at(1).get<double>());
+            }
+            break;
+        case TransformOp::RoundToStep: step.a = j.at("step").get<double>(); break;
+        default: break;
+    }
+
+    return step;
+}
+
+json step_to_json(const TransformStep& step) {
+    json j;
+    j["op"] = op_name(step.op);
+
+    switch (step.op) {
+        case TransformOp::Scale: j["factor"] = step.a; break;
+        case TransformOp::Offset: j["amount"] = step.a; break;
+        case TransformOp::Linear:
+            j["scale"] = step.a;
+            j["offset"] = step.b;
+            break;
+        case TransformOp::Clamp:
+            j["min"] = step.a;
+            j["max"] = step.b;
+            break;
+        case TransformOp::UnitConvert:
+            j["from"] = unit_name(step.from_unit);
+            j["to"] = unit_name(step.to_unit);
+            break;
+        case TransformOp::Lookup:
+        case TransformOp::ReverseLookup: {
+            json table = json::array();
+            for (const auto& entry : step.table) {
+                table.push_back(json::array({entry.input, entry.output}));
+            }
+            j["table"] = std::move(table);
+            break;
+        }
+        case TransformOp::RoundToStep: j["step"] = step.a; break;
+        default: break;
+    }
+
+    return j;
+}
+
+std::vector<TransformStep> chain_from_json(const json& j, const char* key) {
+    std::vector<TransformStep> chain;
+    if (j.contains(key)) {
+        for (const auto& step : j.at(key)) {
+            chain.push_back(step_from_json(step));
+        }
+    }
+    return chain;
+}
+
+json chain_to_json(const std::vector<TransformStep>& chain) {
+    json j = json::array();
+    for (const auto& step : chain) {
+        j.push_back(step_to_json(step));
+    }
+    return j;
+}
+
+std::optional<TransformFunc> compile_chain(const std::vector<TransformStep>& chain) {
+    if (chain.empty()) return std::nullopt;
+    if (chain.size() == 1) return chain.front().compile();
+
+    std::vector<TransformFunc> transforms;
+    transforms.reserve(chain.size());
+    for (const auto& step : chain) {
+        transforms.push_back(step.compile());
+    }
+    return Transform::compose(transforms);
+}
+
+// ----------------------------------------------------------------------------
+// Binary form (little-endian, length-prefixed strings)
+// ----------------------------------------------------------------------------
+
+class BinaryWriter {
+public:
+    explicit BinaryWriter(ByteBuffer& out) : out_(out) {}
+
+    void u8(uint8_t value) { out_.push_back(static_cast<char>(value)); }
+
+    void u32(uint32_t value) {
+        uint8_t* p = out_.grow(4);
+        for (int i = 0; i < 4; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+
+    void u64(uint64_t value) {
+        uint8_t* p = out_.grow(8);
+        for (int i = 0; i < 8; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+
+    void f64(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        u64(bits);
+    }
+
+    void string(const std::string& value) {
+        u32(static_cast<uint32_t>(value.size()));
+        out_.append(value);
+    }
+
+private:
+    ByteBuffer& out_;
+};
+
+class BinaryReader {
+public:
+    explicit BinaryReader(ByteSpan data)
+        : data_(reinterpret_cast<const uint8_t*>(data.data())), size_(data.size()) {}
+
+    uint8_t u8() {
+        need(1);
+        return data_[pos_++];
+    }
+
+    uint32_t u32() {
+        need(4);
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) value |= static_cast<uint32_t>(data_[pos_ + i]) << (8 * i);
+        pos_ += 4;
+        return value;
+    }
+
+    uint64_t u64() {
+        need(8);
+        uint64_t value = 0;
+        for (int i = 0; i < 8; ++i) value |= static_cast<uint64_t>(data_[pos_ + i]) << (8 * i);
+        pos_ += 8;
+        return value;
+    }
+
+    double f64() {
+        uint64_t bits = u64();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::string string() {
+        uint32_t size = u32();
+        need(size);
+        std::string value(reinterpret_cast<const char*>(data_ + pos_), size);
+        pos_ += size;
+        return value;
+    }
+
+    /// Element count, checked against the bytes left (each element >= min_size bytes)
+    uint32_t count(size_t min_size) {
+        uint32_t value = u32();
+        if (static_cast<uint64_t>(value) * min_size > size_ - pos_) {
+            throw std::runtime_error("Truncated adapter spec bundle");
+        }
+        return value;
+    }
+
+    void skip(size_t size) {
+        need(size);
+        pos_ += size;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+
+    void need(size_t size) const {
+        if (size > size_ - pos_) {
+            throw std::runtime_error("Truncated adapter spec bundle");
+        }
+    }
+};
+
+void write_chain(BinaryWriter& w, const std::vector<TransformStep>& chain) {
+    w.u32(static_cast<uint32_t>(chain.size()));
+    for (const auto& step : chain) {
+        w.u8(static_cast<uint8_t>(step.op));
+        w.f64(step.a);
+        w.f64(step.b);
+        w.u8(static_cast<uint8_t>(step.from_unit));
+        w.u8(static_cast<uint8_t>(step.to_unit));
+        w.u32(static_cast<uint32_t>(step.table.size()));
+        for (const auto& entry : step.table) {
+            w.f64(entry.input);
+            w.f64(entry.output);
+        }
+    }
+}
+
+std::vector<TransformStep> read_chain(BinaryReader& r) {
+    std::vector<TransformStep> chain(r.count(23));
+    for (auto& step : chain) {
+        uint8_t op = r.u8();
+        if (op > static_cast<uint8_t>(TransformOp::RoundToStep)) {
+            throw std::runtime_error("Unknown transform op in adapter spec bundle");
+        }
+        step.op = static_cast<TransformOp>(op);
+        step.a = r.f64();
+        step.b = r.f64();
+
+        uint8_t from = r.u8();
+        uint8_t to = r.u8();
+        if (!is_known_unit(from) || !is_known_unit(to)) {
+            throw std::runtime_error("Unknown unit in adapter spec bundle");
+        }
+        step.from_unit = static_cast<Unit>(from);
+        step.to_unit = static_cast<Unit>(to);
+
+        uint32_t entries = r.count(16);
+        step.table.reserve(entries);
+        for (uint32_t i = 0; i < entries; ++i) {
+            double input = r.f64();
+            step.table.emplace_back(input, r.f64());
+        }
+    }
+    return chain;
+}
+
+bool same_table(const std::vector<LUTEntry>& a, const std::vector<LUTEntry>& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const LUTEntry& x, const LUTEntry& y) {
+        return x.input == y.input && x.output == y.output;
+    });
+}
+
+std::string_view trim(std::string_view text) {
+    size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) return {};
+    size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+} // namespace
+
+// ============================================================================
+// Mapping Spec Implementation
+// ============================================================================
+
+TransformFunc TransformStep::compile() const {
+    switch (op) {
+        case TransformOp::Scale: return Transform::scale(a);
+        case TransformOp::Offset: return Transform::offset(a);
+        case TransformOp::Linear: return Transform::linear(a, b);
+        case TransformOp::Invert: return Transform::invert();
+        case TransformOp::Negate: return Transform::negate();
+        case TransformOp::Clamp: return Transform::clamp(a, b);
+        case TransformOp::PercentToRatio: return Transform::percent_to_ratio();
+        case TransformOp::RatioToPercent: return Transform::ratio_to_percent();
+        case TransformOp::UnitConvert: return Transform::unit_convert(from_unit, to_unit);
+        case TransformOp::Lookup: return Transform::lookup_table(LookupTableConverter(table));
+        case TransformOp::ReverseLookup: {
+            // Interpolating the swapped table equals reverse_lookup() without
+            // rebuilding the reversed table on every call
+            std::vector<LUTEntry> swapped;
+            swapped.reserve(table.size());
+            for (const auto& entry : table) {
+                swapped.emplace_back(entry.output, entry.input);
+            }
+            return Transform::lookup_table(LookupTableConverter(std::move(swapped)));
+        }
+        case TransformOp::RoundToStep: {
+            double step = a;
+            return [step](double x) { return UnitConverter::round_to_step(x, step); };
+        }
+    }
+    throw std::runtime_error("Unknown transform op in adapter spec");
+}
+
+bool TransformStep::operator==(const TransformStep& other) const {
+    return op == other.op && a == other.a && b == other.b &&
+           from_unit == other.from_unit && to_unit == other.to_unit &&
+           same_table(table, other.table);
+}
+
+bool FieldSpec::operator==(const FieldSpec& other) const {
+    return orsf_path == other.orsf_path && native_key == other.native_key &&
+           section == other.section && required == other.required &&
+           to_native == other.to_native && to_orsf == other.to_orsf;
+}
+
+bool TextLayout::operator==(const TextLayout& other) const {
+    return separator == other.separator && header == other.header;
+}
+
+bool MappingSpec::operator==(const MappingSpec& other) const {
+    return metadata.id == other.metadata.id && metadata.version == other.metadata.version &&
+           metadata.car_key == other.metadata.car_key &&
+           metadata.description == other.metadata.description &&
+           metadata.author == other.metadata.author &&
+           file_extension == other.file_extension && suggested_filename == other.suggested_filename &&
+           signatures == other.signatures && layout == other.layout && fields == other.fields;
+}
+
+MappingSpec MappingSpec::from_json(const std::string& json_str) {
+    json j;
+    try {
+        j = json::parse(json_str);
+    } catch (const json::exception& e) {
+        throw std::runtime_error(std::string("Failed to parse adapter spec: ") + e.what());
+    }
+    return from_json(j);
+}
+
+MappingSpec MappingSpec::from_json(const json& j) {
+    MappingSpec spec;
+    try {
+        std::string format = j.at("format").get<std::string>();
+        if (format != JSON_FORMAT) {
+            throw std::runtime_error("Invalid adapter spec format: " + format + " (expected " + JSON_FORMAT + ")");
+        }
+
+        spec.metadata.id = j.at("id").get<std::string>();
+        spec.metadata.version = j.at("version").get<std::string>();
+        spec.metadata.car_key = j.at("car_key").get<std::string>();
+        spec.metadata.description = j.value("description", "");
+        spec.metadata.author = j.value("author", "");
+        spec.file_extension = j.value("file_extension", "");
+        spec.suggested_filename = j.value("suggested_filename", "");
+
+        if (j.contains("signatures")) {
+            for (const auto& signature : j.at("signatures")) {
+                std::optional<size_t> offset;
+                if (signature.contains("offset")) offset = signature.at("offset").get<size_t>();
+                spec.signatures.emplace_back(signature.at("bytes").get<std::string>(), offset);
+            }
+        }
+
+        if (j.contains("layout")) {
+            const json& layout = j.at("layout");
+            spec.layout.separator = layout.value("separator", "=");
+            if (layout.contains("header")) {
+                spec.layout.header = layout.at("header").get<std::vector<std::string>>();
+            }
+        }
+
+        for (const auto& field : j.at("fields")) {
+            FieldSpec f;
+            f.orsf_path = field.at("orsf").get<std::string>();
+            f.native_key = field.at("native").get<std::string>();
+            f.section = field.value("section", "");
+            f.required = field.value("required", false);
+            f.to_native = chain_from_json(field, "to_native");
+            f.to_orsf = chain_from_json(field, "to_orsf");
+            spec.fields.push_back(std::move(f));
+        }
+    } catch (const json::exception& e) {
+        throw std::runtime_error(std::string("Failed to parse adapter spec: ") + e.what());
+    }
+
+    spec.validate();
+    return spec;
+}
+
+json MappingSpec::to_json() const {
+    json j;
+    j["format"] = JSON_FORMAT;
+    j["id"] = metadata.id;
+    j["version"] = metadata.version;
+    j["car_key"] = metadata.car_key;
+    j["description"] = metadata.description;
+    j["author"] = metadata.author;
+    j["file_extension"] = file_extension;
+    j["suggested_filename"] = suggested_filename;
+
+    json signature_list = json::array();
+    for (const auto& signature : signatures) {
+        json s;
+        s["bytes"] = signature.bytes;
+        if (signature.offset.has_value()) s["offset"] = signature.offset.value();
+        signature_list.push_back(std::move(s));
+    }
+    j["signatures"] = std::move(signature_list);
+
+    j["layout"] = {{"separator", layout.separator}, {"header", layout.header}};
+
+    json field_list = json::array();
+    for (const auto& field : fields) {
+        json f;
+        f["orsf"] = field.orsf_path;
+        f["native"] = field.native_key;
+        if (!field.section.empty()) f["section"] = field.section;
+        if (field.required) f["required"] = true;
+        if (!field.to_native.empty()) f["to_native"] = chain_to_json(field.to_native);
+        if (!field.to_orsf.empty()) f["to_orsf"] = chain_to_json(field.to_orsf);
+        field_list.push_back(std::move(f));
+    }
+    j["fields"] = std::move(field_list);
+
+    return j;
+}
+
+void MappingSpec::encode_binary(const std::vector<MappingSpec>& specs, ByteBuffer& out) {
+    BinaryWriter w(out);
+    out.append(std::string_view(BINARY_MAGIC, MAGIC_SIZE));
+    w.u32(BINARY_VERSION);
+    w.u32(static_cast<uint32_t>(specs.size()));
+
+    for (const auto& spec : specs) {
+        w.string(spec.metadata.id);
+        w.string(spec.metadata.version);
+        w.string(spec.metadata.car_key);
+        w.string(spec.metadata.description);
+        w.string(spec.metadata.author);
+        w.string(spec.file_extension);
+        w.string(spec.suggested_filename);
+
+        w.u32(static_cast<uint32_t>(spec.signatures.size()));
+        for (const auto& signature : spec.signatures) {
+            w.string(signature.bytes);
+            w.u8(signature.offset.has_value() ? 1 : 0);
+            w.u64(signature.offset.value_or(0));
+        }
+
+        w.string(spec.layout.separator);
+        w.u32(static_cast<uint32_t>(spec.layout.header.size()));
+        for (const auto& line : spec.layout.header) {
+            w.string(line);
+        }
+
+        w.u32(static_cast<uint32_t>(spec.fields.size()));
+        for (const auto& field : spec.fields) {
+            w.string(field.orsf_path);
+            w.string(field.native_key);
+            w.string(field.section);
+            w.u8(field.required ? 1 : 0);
+            write_chain(w, field.to_native);
+            write_chain(w, field.to_orsf);
+        }
+    }
+}
+
+std::vector<MappingSpec> MappingSpec::decode_binary(ByteSpan data) {
+    if (data.size() < MAGIC_SIZE || data.as_chars().substr(0, MAGIC_SIZE) != std::string_view(BINARY_MAGIC, MAGIC_SIZE)) {
+        throw std::runtime_error("Not an adapter spec bundle");
+    }
+
+    BinaryReader r(data);
+    r.skip(MAGIC_SIZE);
+    uint32_t version = r.u32();
+    if (version != BINARY_VERSION) {
+        throw std::runtime_error("Unsupported adapter spec bundle version: " + std::to_string(version));
+    }
+
+    std::vector<MappingSpec> specs(r.count(1));
+    for (auto& spec : specs) {
+        spec.metadata.id = r.string();
+        spec.metadata.version = r.string();
+        spec.metadata.car_key = r.string();
+        spec.metadata.description = r.string();
+        spec.metadata.author = r.string();
+        spec.file_extension = r.string();
+        spec.suggested_filename = r.string();
+
+        uint32_t signature_count = r.count(13);
+        spec.signatures.reserve(signature_count);
+        for (uint32_t i = 0; i < signature_count; ++i) {
+            std::string bytes = r.string();
+            bool has_offset = r.u8() != 0;
+            uint64_t offset = r.u64();
+            spec.signatures.emplace_back(std::move(bytes),
+                has_offset ? std::optional<size_t>(static_cast<size_t>(offset)) : std::nullopt);
+        }
+
+        spec.layout.separator = r.string();
+        spec.layout.header.resize(r.count(4));
+        for (auto& line : spec.layout.header) {
+            line = r.string();
+        }
+
+        spec.fields.resize(r.count(21));
+        for (auto& field : spec.fields) {
+            field.orsf_path = r.string();
+            field.native_key = r.string();
+            field.section = r.string();
+            field.required = r.u8() != 0;
+            field.to_native = read_chain(r);
+            field.to_orsf = read_chain(r);
+        }
+
+        spec.validate();
+    }
+
+    return specs;
+}
+
+void MappingSpec::validate() const {
+    if (metadata.id.empty()) {
+        throw std::runtime_error("Adapter spec has no id");
+    }
+    if (layout.separator.empty()) {
+        throw std::runtime_error("Adapter spec " + metadata.id + " has an empty separator");
+    }
+
+    std::set<std::string_view> keys;
+    for (const auto& field : fields) {
+        if (!MappingEngine::numeric_field_index(field.orsf_path).has_value()) {
+            throw std::runtime_error("Unknown ORSF field in adapter spec " + metadata.id + ": " + field.orsf_path);
+        }
+        if (field.native_key.empty() || field.native_key.find('\n') != std::string::npos) {
+            throw std::runtime_error("Invalid native key in adapter spec " + metadata.id + " for " + field.orsf_path);
+        }
+        if (!keys.insert(field.native_key).second) {
+            throw std::runtime_error("Duplicate native key in adapter spec " + metadata.id + ": " + field.native_key);
+        }
+
+        for (const auto* chain : {&field.to_native, &field.to_orsf}) {
+            for (const auto& step : *chain) {
+                bool table_op = step.op == TransformOp::Lookup || step.op == TransformOp::ReverseLookup;
+                if (table_op && step.table.empty()) {
+                    throw std::runtime_error("Empty lookup table in adapter spec " + metadata.id + " for " + field.orsf_path);
+                }
+                if (step.op == TransformOp::UnitConvert &&
+                    UnitConverter::base_unit(step.from_unit) != UnitConverter::base_unit(step.to_unit)) {
+                    throw std::runtime_error("Unit conversion between different quantities in adapter spec " +
+                                             metadata.id + " for " + field.orsf_path);
+                }
+                if (step.op == TransformOp::Clamp && !(step.a <= step.b)) {
+                    throw std::runtime_error("Clamp minimum above maximum in adapter spec " + metadata.id + " for " + field.orsf_path);
+                }
+            }
+        }
+    }
+}
+
+std::vector<FieldMapping> MappingSpec::compile_mappings() const {
+    std::vector<FieldMapping> mappings;
+    mappings.reserve(fields.size());
+    for (const auto& field : fields) {
+        mappings.emplace_back(
+            field.orsf_path,
+            field.native_key,
+            compile_chain(field.to_native),
+            compile_chain(field.to_orsf),
+            field.required
+        );
+    }
+    return mappings;
+}
+
+// ============================================================================
+// Spec Adapter Implementation
+// ============================================================================
+
+SpecAdapter::SpecAdapter(MappingSpec spec)
+    : BaseAdapter(spec.metadata.id, spec.metadata.version, spec.metadata.car_key,
+                  spec.metadata.description, spec.metadata.author),
+      spec_(std::move(spec)) {
+    spec_.validate();
+    mappings_ = spec_.compile_mappings();
+
+    // Fields without a section come first, then each section in order of appearance
+    std::vector<std::string_view> sections;
+    for (size_t i = 0; i < spec_.fields.size(); ++i) {
+        const std::string& section = spec_.fields[i].section;
+        if (section.empty()) {
+            write_order_.push_back(i);
+        } else if (std::find(sections.begin(), sections.end(), section) == sections.end()) {
+            sections.push_back(section);
+        }
+    }
+    for (std::string_view section : sections) {
+        for (size_t i = 0; i < spec_.fields.size(); ++i) {
+            if (spec_.fields[i].section == section) write_order_.push_back(i);
+        }
+    }
+
+    // Compile the plan now so conversions never touch the spec
+    mapping_plan();
+}
+
+std::vector<std::shared_ptr<Adapter>> SpecAdapter::load(ByteSpan data) {
+    std::vector<MappingSpec> specs;
+    std::string_view text = data.as_chars();
+
+    if (text.substr(0, MAGIC_SIZE) == std::string_view(MappingSpec::BINARY_MAGIC, MAGIC_SIZE)) {
+        specs = MappingSpec::decode_binary(data);
+    } else {
+        json j;
+        try {
+            j = json::parse(text.begin(), text.end());
+        } catch (const json::exception& e) {
+            throw std::runtime_error(std::string("Failed to parse adapter spec: ") + e.what());
+        }
+
+        if (j.is_array()) {
+            for (const auto& entry : j) {
+                specs.push_back(MappingSpec::from_json(entry));
+            }
+        } else {
+            specs.push_back(MappingSpec::from_json(j));
+        }
+    }
+
+    std::vector<std::shared_ptr<Adapter>> adapters;
+    adapters.reserve(specs.size());
+    for (auto& spec : specs) {
+        adapters.push_back(std::make_shared<SpecAdapter>(std::move(spec)));
+    }
+    return adapters;
+}
+
+std::vector<std::shared_ptr<Adapter>> SpecAdapter::load_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Failed to open adapter spec: " + path);
+    }
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return load(ByteSpan(bytes));
+}
+
+std::vector<uint8_t> SpecAdapter::orsf_to_native(const ORSF& orsf) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    ByteBuffer out;
+    encode_native(orsf, out);
+    ORSF_STAGE_BYTES(stage, out.size());
+    return out.release();
+}
+
+ORSF SpecAdapter::native_to_orsf(const std::vector<uint8_t>& data) const {
+    return decode_native(ByteSpan(data));
+}
+
+ORSF SpecAdapter::decode_native(ByteSpan data) const {
+    ORSF_STAGE(stage, AdapterDecode);
+    ORSF_STAGE_BYTES(stage, data.size());
+    return flat_to_orsf(parse_native(data), ORSF());
+}
+
+void SpecAdapter::encode_native(const ORSF& orsf, ByteBuffer& out) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    size_t start = out.size();
+    append_flat(orsf_to_flat(orsf), out);
+    ORSF_STAGE_BYTES(stage, out.size() - start);
+    (void)start;
+}
+
+void SpecAdapter::encode_extracted(const ORSF& orsf, const FieldValues& values, ByteBuffer& out) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    size_t start = out.size();
+    append_flat(orsf_to_flat(orsf, values), out);
+    ORSF_STAGE_BYTES(stage, out.size() - start);
+    (void)start;
+}
+
+void SpecAdapter::write_native(const ORSF& orsf, OutputSink& sink) const {
+    ORSF_STAGE(stage, AdapterEncode);
+    TextWriter writer(sink);
+    write_flat(orsf_to_flat(orsf), writer);
+    writer.flush();
+}
+
+std::string SpecAdapter::get_suggested_filename() const {
+    if (!spec_.suggested_filename.empty()) return spec_.suggested_filename;
+    return spec_.file_extension.empty() ? "setup" : "setup." + spec_.file_extension;
+}
+
+FlatSetup SpecAdapter::parse_native(ByteSpan data) const {
+    FlatSetup flat;
+    std::string_view text = data.as_chars();
+    const std::string& separator = spec_.layout.separator;
+
+    while (!text.empty()) {
+        size_t end = text.find('\n');
+        std::string_view line = trim(text.substr(0, end));
+        text = end == std::string_view::npos ? std::string_view() : text.substr(end + 1);
+
+        if (line.empty() || line.front() == '#' || line.front() == ';' || line.front() == '[') continue;
+
+        size_t split = line.find(separator);
+        if (split == std::string_view::npos) continue;
+
+        std::string_view key = trim(line.substr(0, split));
+        std::string_view value = trim(line.substr(split + separator.size()));
+
+        double number = 0.0;
+        auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), number);
+        if (ec != std::errc() || ptr != value.data() + value.size()) {
+            throw std::runtime_error("Invalid value for native key " + std::string(key) + ": " + std::string(value));
+        }
+        flat[std::string(key)] = number;
+    }
+
+    return flat;
+}
+
+void SpecAdapter::append_flat(const FlatSetup& flat, ByteBuffer& out) const {
+    ByteBufferSink sink(out);
+    TextWriter writer(sink);
+    write_flat(flat, writer);
+    writer.flush();
+}
+
+void SpecAdapter::write_flat(const FlatSetup& flat, TextWriter& writer) const {
+    for (const auto& line : spec_.layout.header) {
+        writer.write(line).put('\n');
+    }
+
+    const std::string* current_section = nullptr;
+    for (size_t index : write_order_) {
+        const FieldSpec& field = spec_.fields[index];
+        auto it = flat.find(field.native_key);
+        if (it == flat.end()) continue;
+
+        if (!field.section.empty() && (current_section == nullptr || *current_section != field.section)) {
+            writer.section(field.section);
+            current_section = &field.section;
+        }
+        writer.write(field.native_key).write(spec_.layout.separator).number(it->second).put('\n');
+    }
+}
+
+} // namespace orsf
@@ -0,0 +1,378 @@
+#include "orsf/streaming.hpp"
+#include "orsf/columnar.hpp"
+#include <iterator>
+#include <unordered_map>
+
+namespace orsf {
+
+namespace {
+
+// Forward iterator over raw bytes that records how far the parser has read
+class CountingIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const char*;
+    using reference = const char&;
+
+    CountingIterator(const char* position, const char** high_water)
+        : position_(position), high_water_(high_water) {}
+
+    reference operator*() const { return *position_; }
+
+    CountingIterator& operator++() {
+        ++position_;
+        if (position_ > *high_water_) *high_water_ = position_;
+        return *this;
+    }
+
+    CountingIterator operator++(int) {
+        CountingIterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    bool operator==(const CountingIterator& other) const { return position_ == other.position_; }
+    bool operator!=(const CountingIterator& other) const { return position_ != other.position_; }
+
+private:
+    const char* position_;
+    const char** high_water_;
+};
+
+// Numeric range rules keyed by field path (same rules as Validator)
+const std::unordered_map<std::string, ColumnRule>& numeric_rules() {
+    static const std::unordered_map<std::string, ColumnRule> rules = [] {
+        std::unordered_map<std::string, ColumnRule> result;
+        for (auto& rule : ColumnarValidator::default_rules()) {
+            result.emplace(rule.field, rule);
+        }
+        return result;
+    }();
+    return rules;
+}
+
+const char* const GEAR_RATIOS_PATH = "setup.gearing.gear_ratios";
+
+class ValidatingSax : public nlohmann::json_sax<json> {
+public:
+    explicit ValidatingSax(const StreamingValidationOptions& options, std::vector<ValidationError>& errors)
+        : options_(options), errors_(errors) {}
+
+    bool stopped() const { return stopped_; }
+    bool failed() const { return failed_; }
+
+    bool null() override {
+        begin_value();
+        return true;
+    }
+
+    bool boolean(bool) override {
+        begin_value();
+        return check_type_of_non_number_or_string();
+    }
+
+    bool number_integer(number_integer_t value) override {
+        begin_value();
+        return on_number(static_cast<double>(value));
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        begin_value();
+        return on_number(static_cast<double>(value));
+    }
+
+    bool number_float(number_float_t value, const string_t&) override {
+        begin_value();
+        return on_number(value);
+    }
+
+    bool string(string_t& value) override {
+        begin_value();
+        return on_string(value);
+    }
+
+    bool binary(binary_t&) override {
+        begin_value();
+        return check_type_of_non_number_or_string();
+    }
+
+    bool start_object(std::size_t) override {
+        begin_value();
+        if (path_ == "metadata") seen_metadata_ = true;
+        if (path_ == "car") seen_car_ = true;
+        frames_.push_back(Frame{false, path_.size(), 0});
+        return true;
+    }
+
+    bool key(string_t& name) override {
+        path_.resize(frames_.back().path_length);
+        if (!path_.empty()) path_ += '.';
+        path_ += name;
+        return true;
+    }
+
+    bool end_object() override {
+        path_.resize(frames_.back().path_length);
+        frames_.pop_back();
+        return on_object_end();
+    }
+
+    bool start_array(std::size_t) override {
+        begin_value();
+        if (path_ == GEAR_RATIOS_PATH) {
+            in_gear_ratios_ = true;
+            gear_ratios_.clear();
+        }
+        frames_.push_back(Frame{true, path_.size(), 0});
+        return true;
+    }
+
+    bool end_array() override {
+        path_.resize(frames_.back().path_length);
+        frames_.pop_back();
+
+        if (in_gear_ratios_ && path_ == GEAR_RATIOS_PATH) {
+            in_gear_ratios_ = false;
+            Gearing gearing;
+            gearing.gear_ratios = gear_ratios_;
+            Validator::validate_gearing(gearing, errors_);
+            return keep_going();
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) override {
+        failed_ = true;
+        errors_.push_back(ValidationError(
+            ValidationSeverity::Error,
+            ValidationCode::InvalidFormat,
+            path_.empty() ? "$" : path_,
+            std::string("JSON parse error: ") + ex.what(),
+            std::nullopt,
+            "byte " + std::to_string(position)
+        ));
+        return false;
+    }
+
+private:
+    struct Frame {
+        bool is_array;
+        size_t path_length;     ///< Path length of the container itself
+        size_t index;           ///< Next element index (arrays)
+    };
+
+    const StreamingValidationOptions& options_;
+    std::vector<ValidationError>& errors_;
+
+    std::vector<Frame> frames_;
+    std::string path_;
+    bool stopped_ = false;
+    bool failed_ = false;
+    size_t checked_ = 0;        ///< Errors already checked for stop_on_error
+
+    bool seen_metadata_ = false;
+    bool seen_car_ = false;
+    Metadata metadata_;
+    Car car_;
+    std::optional<double> ambient_temp_c_;
+    std::optional<double> track_temp_c_;
+    bool in_gear_ratios_ = false;
+    std::vector<double> gear_ratios_;
+
+    // Set path_ for the next array element
+    void begin_value() {
+        if (!frames_.empty() && frames_.back().is_array) {
+            Frame& frame = frames_.back();
+            path_.resize(frame.path_length);
+            path_ += '[';
+            path_ += std::to_string(frame.index++);
+            path_ += ']';
+        }
+    }
+
+    bool keep_going() {
+        if (options_.max_errors > 0 && errors_.size() >= options_.max_errors) {
+            stopped_ = true;
+        }
+        if (options_.stop_on_error) {
+            for (; checked_ < errors_.size(); ++checked_) {
+                if (errors_[checked_].severity == ValidationSeverity::Error) {
+                    stopped_ = true;
+                    break;
+                }
+            }
+        }
+        return !stopped_;
+    }
+
+    bool in_gear_array() const {
+        return in_gear_ratios_ && frames_.size() >= 1 && frames_.back().is_array &&
+               frames_.back().path_length == std::char_traits<char>::length(GEAR_RATIOS_PATH);
+    }
+
+    bool is_numeric_field() const {
+        return numeric_rules().count(path_) > 0 ||
+               path_ == "setup.drivetrain.lsd_clutch_plates" ||
+               path_ == "setup.fuel.stint_target_laps";
+    }
+
+    bool is_string_field() const {
+        return path_ == "schema" || path_ == "metadata.id" || path_ == "metadata.name" ||
+               path_ == "metadata.created_at" || path_ == "metadata.updated_at" ||
+               path_ == "car.make" || path_ == "car.model" || path_ == "car.car_class" ||
+               path_ == "context.rubber";
+    }
+
+    bool type_error(const char* expected) {
+        errors_.push_back(ValidationError(
+            ValidationSeverity::Error,
+            ValidationCode::InvalidFormat,
+            path_,
+            "Unexpected value type",
+            expected
+        ));
+        return keep_going();
+    }
+
+    bool check_type_of_non_number_or_string() {
+        if (in_gear_array() || is_numeric_field()) return type_error("number");
+        if (is_string_field()) return type_error("string");
+        return true;
+    }
+
+    bool on_number(double value) {
+        if (in_gear_array()) {
+            gear_ratios_.push_back(value);
+            return true;
+        }
+
+        auto it = numeric_rules().find(path_);
+        if (it != numeric_rules().end()) {
+            if (path_ == "context.ambient_temp_c") ambient_temp_c_ = value;
+            if (path_ == "context.track_temp_c") track_temp_c_ = value;
+
+            it->second.check_value(value, errors_);
+            return keep_going();
+        }
+
+        if (path_ == "setup.drivetrain.lsd_clutch_plates") {
+            Drivetrain drivetrain;
+            drivetrain.lsd_clutch_plates = static_cast<int>(value);
+            Validator::validate_drivetrain(drivetrain, errors_);
+            return keep_going();
+        }
+
+        if (path_ == "setup.fuel.stint_target_laps") {
+            Fuel fuel;
+            fuel.stint_target_laps = static_cast<int>(value);
+            Validator::validate_fuel(fuel, errors_);
+            return keep_going();
+        }
+
+        if (is_string_field()) return type_error("string");
+        return true;
+    }
+
+    bool on_string(const std::string& value) {
+        if (path_ == "schema") {
+            ORSF schema_only;
+            schema_only.schema = value;
+            Validator::validate_schema(schema_only, errors_);
+            return keep_going();
+        }
+
+        if (path_ == "metadata.id") metadata_.id = value;
+        else if (path_ == "metadata.name") metadata_.name = value;
+        else if (path_ == "metadata.created_at") metadata_.created_at = value;
+        else if (path_ == "metadata.updated_at") metadata_.updated_at = value;
+        else if (path_ == "car.make") car_.make = value;
+        else if (path_ == "car.model") car_.model = value;
+        else if (path_ == "car.car_class") car_.car_class = value;
+        else if (path_ == "context.rubber") {
+            Context context;
+            context.rubber = value;
+            Validator::validate_context(context, errors_);
+            return keep_going();
+        }
+        else if (in_gear_array() || is_numeric_field()) {
+            return type_error("number");
+        }
+
+        return true;
+    }
+
+    bool on_object_end() {
+        if (path_ == "metadata") {
+            Validator::validate_metadata(metadata_, errors_);
+            return keep_going();
+        }
+
+        if (path_ == "car") {
+            Validator::validate_car(car_, errors_);
+            return keep_going();
+        }
+
+        if (path_ == "context") {
+            ORSF temperatures;
+            temperatures.context = Context{};
+            temperatures.context->ambient_temp_c = ambient_temp_c_;
+            temperatures.context->track_temp_c = track_temp_c_;
+            Validator::validate_cross_field(temperatures, errors_);
+            return keep_going();
+        }
+
+        // End of document: required sections that never appeared
+        if (frames_.empty()) {
+            if (!seen_metadata_) Validator::validate_metadata(Metadata{}, errors_);
+            if (!seen_car_) Validator::validate_car(Car{}, errors_);
+            return keep_going();
+        }
+
+        return true;
+    }
+};
+
+} // namespace
+
+// ============================================================================
+// Streaming Validator Implementation
+// ============================================================================
+
+bool StreamingValidationResult::is_valid() const {
+    if (syntax_error) return false;
+    for (const auto& error : errors) {
+        if (error.severity == ValidationSeverity::Error) return false;
+    }
+    return true;
+}
+
+StreamingValidationResult StreamingValidator::validate(
+    const char* data,
+    size_t size,
+    const StreamingValidationOptions& options
+) {
+    StreamingValidationResult result;
+    ValidatingSax sax(options, result.errors);
+
+    const char* high_water = data;
+    CountingIterator first(data, &high_water);
+    CountingIterator last(data + size, &high_water);
+
+    bool finished = json::sax_parse(first, last, &sax);
+
+    result.syntax_error = sax.failed();
+    result.complete = finished && !sax.stopped();
+    result.bytes_scanned = result.complete ? size : static_cast<size_t>(high_water - data);
+    return result;
+}
+
+StreamingValidationResult StreamingValidator::validate(
+    const std::string& json_str,
+    const StreamingValidationOptions& options
+) {
+    return validate(json_str.data(), json_str.size(), options);
+}
+
+} // namespace orsf
@@ -0,0 +1,170 @@
+#include "orsf/trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace orsf {
+
+namespace {
+
+std::atomic<uint64_t> next_tracer_id{1};
+
+/// Rings this thread writes to, by tracer id (ids are never reused)
+constexpr size_t MAX_THREAD_RINGS = 16;
+thread_local std::vector<std::pair<uint64_t, void*>> thread_rings;
+
+/// Write nanoseconds as microseconds with three decimals
+void write_micros(TextWriter& writer, int64_t ns) {
+    writer.number(ns / 1000).put('.');
+    int64_t fraction = ns % 1000;
+    if (fraction < 100) writer.put('0');
+    if (fraction < 10) writer.put('0');
+    writer.number(fraction);
+}
+
+} // namespace
+
+// ============================================================================
+// Tracer Implementation
+// ============================================================================
+
+Tracer::Tracer(TraceOptions options)
+    : options_(std::move(options)),
+      id_(next_tracer_id.fetch_add(1, std::memory_order_relaxed)),
+      origin_(std::chrono::steady_clock::now()) {
+    options_.events_per_thread = std::max<size_t>(options_.events_per_thread, 1);
+    options_.sample_every = std::max<uint64_t>(options_.sample_every, 1);
+}
+
+Tracer::~Tracer() = default;
+
+Tracer::Ring& Tracer::thread_ring() {
+    for (const auto& entry : thread_rings) {
+        if (entry.first == id_) return *static_cast<Ring*>(entry.second);
+    }
+
+    auto ring = std::make_unique<Ring>();
+    ring->records.reserve(options_.events_per_thread);
+    Ring* result = ring.get();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ring->thread = static_cast<uint32_t>(rings_.size() + 1);
+        rings_.push_back(std::move(ring));
+    }
+
+    // Entries of destroyed tracers are never matched again; keep the list short
+    if (thread_rings.size() >= MAX_THREAD_RINGS) thread_rings.erase(thread_rings.begin());
+    thread_rings.emplace_back(id_, result);
+    return *result;
+}
+
+void Tracer::on_stage(const StageEvent& event) {
+    bool keep = event.item == NO_ITEM ? options_.keep_untagged : event.item % options_.sample_every == 0;
+    keep = keep && event.duration >= options_.min_duration && event.start >= origin_;
+
+    Ring* ring;
+    try {
+        ring = &thread_ring();
+    } catch (...) {
+        return;  // Sinks must not throw; lose the event instead
+    }
+
+    std::lock_guard<std::mutex> lock(ring->mutex);
+    if (!keep) {
+        ++ring->sampled_out;
+        return;
+    }
+
+    Record record{
+        event.stage, event.item,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(event.start - origin_).count(),
+        event.duration.count(), event.bytes, event.errors
+    };
+    if (ring->records.size() < options_.events_per_thread) {
+        ring->records.push_back(record);
+    } else {
+        ring->records[ring->written % options_.events_per_thread] = record;
+    }
+    ++ring->written;
+}
+
+void Tracer::write_json(OutputSink& sink) const {
+    TextWriter writer(sink);
+    TraceStats totals = stats();
+    bool first = true;
+    auto separator = [&] {
+        writer.write(first ? "\n" : ",\n");
+        first = false;
+    };
+
+    writer.write("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& ring : rings_) {
+        std::lock_guard<std::mutex> ring_lock(ring->mutex);
+        const int64_t tid = ring->thread;
+
+        separator();
+        writer.write("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":").number(tid)
+              .write(",\"args\":{\"name\":\"orsf thread ").number(tid).write("\"}}");
+
+        // Oldest first: once the ring has wrapped, the next slot holds the oldest record
+        const size_t count = ring->records.size();
+        const size_t oldest = ring->written > count ? static_cast<size_t>(ring->written % count) : 0;
+        for (size_t i = 0; i < count; ++i) {
+            const Record& record = ring->records[(oldest + i) % count];
+            separator();
+            writer.write("{\"name\":\"").write(stage_name(record.stage))
+                  .write("\",\"cat\":\"orsf\",\"ph\":\"X\",\"pid\":1,\"tid\":").number(tid)
+                  .write(",\"ts\":");
+            write_micros(writer, record.start_ns);
+            writer.write(",\"dur\":");
+            write_micros(writer, record.duration_ns);
+            writer.write(",\"args\":{");
+            if (record.item != NO_ITEM) {
+                writer.write("\"setup\":").number(static_cast<int64_t>(record.item)).put(',');
+            }
+            writer.write("\"bytes\":").number(static_cast<int64_t>(record.bytes))
+                  .write(",\"errors\":").number(static_cast<int64_t>(record.errors)).write("}}");
+        }
+    }
+
+    writer.write("\n],\"otherData\":{\"recorded\":").number(static_cast<int64_t>(totals.recorded))
+          .write(",\"overwritten\":").number(static_cast<int64_t>(totals.overwritten))
+          .write(",\"sampled_out\":").number(static_cast<int64_t>(totals.sampled_out))
+          .write(",\"sample_every\":").number(static_cast<int64_t>(options_.sample_every))
+          .write("}}\n");
+    writer.flush();
+}
+
+std::string Tracer::to_json_string() const {
+    std::string out;
+    StringSink sink(out);
+    write_json(sink);
+    return out;
+}
+
+void Tracer::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& ring : rings_) {
+        std::lock_guard<std::mutex> ring_lock(ring->mutex);
+        ring->records.clear();
+        ring->written = 0;
+        ring->sampled_out = 0;
+    }
+}
+
+TraceStats Tracer::stats() const {
+    TraceStats stats;
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.threads = rings_.size();
+    for (const auto& ring : rings_) {
+        std::lock_guard<std::mutex> ring_lock(ring->mutex);
+        stats.recorded += ring->written;
+        stats.overwritten += ring->written - ring->records.size();
+        stats.sampled_out += ring->sampled_out;
+    }
+    return stats;
+}
+
+} // namespace orsf
@@ -0,0 +1,127 @@
+#include "orsf/transcode.hpp"
+#include <stdexcept>
+
+namespace orsf {
+
+namespace {
+
+// True if set_value stores the path so that reading it back gives the same value
+bool round_trips(const std::string& path, FieldGetter getter) {
+    if (getter == nullptr) return false;
+
+    constexpr double probe = 0.5;   // Detects integer storage
+    ORSF orsf;
+    MappingEngine::set_value(orsf, path, probe);
+    auto value = getter(orsf);
+    return value.has_value() && value.value() == probe;
+}
+
+} // namespace
+
+// ============================================================================
+// Transcoder Implementation
+// ============================================================================
+
+Transcoder::Transcoder(std::shared_ptr<const MappingPlan> from, std::shared_ptr<const MappingPlan> to)
+    : from_(std::move(from)), to_(std::move(to)) {
+    if (!from_ || !to_) {
+        throw std::runtime_error("Transcoder requires two mapping plans");
+    }
+
+    for (const auto& mapping : from_->mappings()) {
+        if (mapping.required) required_.push_back(&mapping);
+    }
+
+    steps_.reserve(to_->mappings().size());
+    for (const auto& target : to_->mappings()) {
+        Step step;
+        step.target = &target;
+        step.getter = MappingEngine::find_getter(target.orsf_path);
+
+        for (const auto& source : from_->mappings()) {
+            if (source.orsf_path != target.orsf_path) continue;
+
+            TransformFunc transform;
+            if (source.to_orsf.has_value() && target.to_native.has_value()) {
+                transform = [to_orsf = source.to_orsf.value(), to_native = target.to_native.value()](double x) {
+                    return to_native(to_orsf(x));
+                };
+            } else if (source.to_orsf.has_value()) {
+                transform = source.to_orsf.value();
+            } else if (target.to_native.has_value()) {
+                transform = target.to_native.value();
+            }
+            step.sources.push_back(Source{&source, std::move(transform)});
+        }
+
+        step.pivot = !step.sources.empty() && !round_trips(target.orsf_path, step.getter);
+        if (step.pivot) ++pivot_count_;
+        steps_.push_back(std::move(step));
+    }
+}
+
+Transcoder::Transcoder(const BaseAdapter& from, const BaseAdapter& to)
+    : Transcoder(from.mapping_plan(), to.mapping_plan()) {}
+
+FlatSetup Transcoder::transcode(const FlatSetup& native, const ORSF& template_orsf) const {
+    for (const FieldMapping* mapping : required_) {
+        if (native.find(mapping->native_key) == native.end()) {
+            throw std::runtime_error("Required native field missing: " + mapping->native_key);
+        }
+    }
+
+    // Only fields that cannot be fused need the materialized ORSF
+    std::optional<ORSF> pivot;
+    if (pivot_count_ > 0) {
+        pivot = from_->to_orsf(native, template_orsf);
+    }
+
+    FlatSetup out;
+    for (const auto& step : steps_) {
+        if (step.pivot) {
+            emit(out, step, read(step, pivot.value()));
+            continue;
+        }
+
+        // Last source present in the native values wins, as in map_to_orsf
+        bool fused = false;
+        for (auto it = step.sources.rbegin(); it != step.sources.rend(); ++it) {
+            auto found = native.find(it->mapping->native_key);
+            if (found == native.end()) continue;
+
+            double value = it->transform ? it->transform(found->second) : found->second;
+            out[step.target->native_key] = value;
+            fused = true;
+            break;
+        }
+
+        if (!fused) {
+            emit(out, step, read(step, template_orsf));
+        }
+    }
+
+    return out;
+}
+
+std::optional<double> Transcoder::read(const Step& step, const ORSF& orsf) const {
+    if (step.getter != nullptr) {
+        return step.getter(orsf);
+    }
+    return MappingEngine::get_value(orsf, step.target->orsf_path);
+}
+
+void Transcoder::emit(FlatSetup& out, const Step& step, std::optional<double> value) const {
+    const FieldMapping& target = *step.target;
+
+    if (value.has_value()) {
+        double mapped_value = value.value();
+        if (target.to_native.has_value()) {
+            mapped_value = target.to_native.value()(mapped_value);
+        }
+        out[target.native_key] = mapped_value;
+    } else if (target.required) {
+        throw std::runtime_error("Required field missing: " + target.orsf_path);
+    }
+}
+
+} // namespace orsf
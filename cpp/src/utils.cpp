@@ -1,11 +1,11 @@
 #include "orsf/utils.hpp"
+#include "orsf/instrument.hpp"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
 #include <stdexcept>
 #include <cctype>
-#include <regex>
 
 namespace orsf {
 
@@ -21,6 +21,23 @@ double UnitConverter::convert(double value, Unit from, Unit to) {
     return from_base(base, to);
 }
 
+Unit UnitConverter::base_unit(Unit unit) {
+    switch (unit) {
+        case Unit::KPA: case Unit::PSI: case Unit::BAR: return Unit::KPA;
+        case Unit::N_MM: case Unit::LB_IN: return Unit::N_MM;
+        case Unit::N_S_M: case Unit::LB_S_IN: return Unit::N_S_M;
+        case Unit::MM: case Unit::INCHES: case Unit::CM: return Unit::MM;
+        case Unit::CELSIUS: case Unit::FAHRENHEIT: case Unit::KELVIN: return Unit::CELSIUS;
+        case Unit::NM: case Unit::LB_FT: return Unit::NM;
+        case Unit::NEWTONS: case Unit::POUNDS: return Unit::NEWTONS;
+        case Unit::KPH: case Unit::MPH: case Unit::MS: return Unit::KPH;
+        case Unit::LITERS: case Unit::GALLONS_US: case Unit::GALLONS_UK: return Unit::LITERS;
+
+        default:
+            throw std::runtime_error("Unknown unit in base_unit lookup");
+    }
+}
+
 double UnitConverter::to_base(double value, Unit unit) {
     switch (unit) {
         // Pressure (base: kPa)
@@ -142,6 +159,7 @@ LookupTableConverter::LookupTableConverter(std::vector<LUTEntry> table)
 }
 
 double LookupTableConverter::interpolate(double value) const {
+    ORSF_STAGE(stage, LookupTable);
     if (table_.empty()) {
         throw std::runtime_error("Empty lookup table");
     }
@@ -163,6 +181,7 @@ double LookupTableConverter::interpolate(double value) const {
 }
 
 double LookupTableConverter::reverse_lookup(double value) const {
+    ORSF_STAGE(stage, LookupTable);
     if (table_.empty()) {
         throw std::runtime_error("Empty lookup table");
     }
@@ -346,12 +365,40 @@ std::string DateTimeUtils::now_iso8601() {
 }
 
 bool DateTimeUtils::is_valid_iso8601(const std::string& timestamp) {
-    // Basic ISO8601 regex pattern (simplified)
+    // Basic ISO8601 pattern (simplified)
     // Matches: YYYY-MM-DDTHH:MM:SS(.sss)?(Z|[+-]HH:MM)?
-    std::regex iso8601_pattern(
-        R"(\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}(\.\d{3})?(Z|[+-]\d{2}:\d{2})?)"
-    );
-    return std::regex_match(timestamp, iso8601_pattern);
+    // Hand-matched: validation calls this per setup, and std::regex
+    // compiles (thousands of allocations) on every construction
+    size_t pos = 0;
+    auto digits = [&](size_t count) {
+        for (size_t i = 0; i < count; ++i, ++pos) {
+            if (pos >= timestamp.size() || timestamp[pos] < '0' || timestamp[pos] > '9') return false;
+        }
+        return true;
+    };
+    auto literal = [&](char c) {
+        if (pos >= timestamp.size() || timestamp[pos] != c) return false;
+        ++pos;
+        return true;
+    };
+
+    if (!(digits(4) && literal('-') && digits(2) && literal('-') && digits(2) && literal('T') &&
+          digits(2) && literal(':') && digits(2) && literal(':') && digits(2))) {
+        return false;
+    }
+    if (pos < timestamp.size() && timestamp[pos] == '.') {
+        ++pos;
+        if (!digits(3)) return false;
+    }
+    if (pos < timestamp.size()) {
+        if (timestamp[pos] == 'Z') {
+            ++pos;
+        } else if (timestamp[pos] == '+' || timestamp[pos] == '-') {
+            ++pos;
+            if (!(digits(2) && literal(':') && digits(2))) return false;
+        }
+    }
+    return pos == timestamp.size();
 }
 
 int64_t DateTimeUtils::iso8601_to_unix(const std::string& timestamp) {
@@ -1,5 +1,7 @@
 #include "orsf/validator.hpp"
 #include "orsf/utils.hpp"
+#include "orsf/instrument.hpp"
+#include <algorithm>
 #include <sstream>
 
 namespace orsf {
@@ -37,6 +39,7 @@ std::string ValidationError::to_string() const {
 // ============================================================================
 
 std::vector<ValidationError> Validator::validate(const ORSF& orsf) {
+    ORSF_STAGE(stage, Validate);
     std::vector<ValidationError> errors;
 
     validate_schema(orsf, errors);
@@ -46,6 +49,8 @@ std::vector<ValidationError> Validator::validate(const ORSF& orsf) {
     validate_setup(orsf.setup, errors);
     validate_cross_field(orsf, errors);
 
+    ORSF_STAGE_ERRORS(stage, std::count_if(errors.begin(), errors.end(),
+        [](const ValidationError& e) { return e.severity == ValidationSeverity::Error; }));
     return errors;
 }
 
@@ -93,7 +98,10 @@ void Validator::validate_metadata(const Metadata& metadata, std::vector<Validati
 void Validator::validate_car(const Car& car, std::vector<ValidationError>& errors) {
     check_required("car.make", !car.make.empty(), errors);
     check_required("car.model", !car.model.empty(), errors);
+    check_car_class(car, errors);
+}
 
+void Validator::check_car_class(const Car& car, std::vector<ValidationError>& errors) {
     // Validate class if present
     if (car.car_class.has_value()) {
         const std::vector<std::string> valid_classes = {
@@ -141,6 +149,10 @@ void Validator::validate_context(const std::optional<Context>& context, std::vec
         check_range("context.wetness", ctx.wetness.value(), 0.0, 1.0, errors);
     }
 
+    check_rubber(ctx, errors);
+}
+
+void Validator::check_rubber(const Context& ctx, std::vector<ValidationError>& errors) {
     // Rubber level validation
     if (ctx.rubber.has_value()) {
         const std::vector<std::string> valid_levels = {
@@ -334,6 +346,10 @@ void Validator::validate_drivetrain(const std::optional<Drivetrain>& drivetrain,
         check_positive("setup.drivetrain.final_drive_ratio", d.final_drive_ratio.value(), errors);
     }
 
+    check_clutch_plates(d, errors);
+}
+
+void Validator::check_clutch_plates(const Drivetrain& d, std::vector<ValidationError>& errors) {
     // Clutch plates should be positive
     if (d.lsd_clutch_plates.has_value()) {
         if (d.lsd_clutch_plates.value() <= 0) {
@@ -351,7 +367,15 @@ void Validator::validate_gearing(const std::optional<Gearing>& gearing, std::vec
     if (!gearing.has_value()) return;
 
     const Gearing& g = gearing.value();
+    check_gear_ratios(g, errors);
+
+    // Reverse ratio should be positive
+    if (g.reverse_ratio.has_value()) {
+        check_positive("setup.gearing.reverse_ratio", g.reverse_ratio.value(), errors);
+    }
+}
 
+void Validator::check_gear_ratios(const Gearing& g, std::vector<ValidationError>& errors) {
     if (g.gear_ratios.has_value()) {
         const auto& ratios = g.gear_ratios.value();
 
@@ -376,11 +400,6 @@ void Validator::validate_gearing(const std::optional<Gearing>& gearing, std::vec
             }
         }
     }
-
-    // Reverse ratio should be positive
-    if (g.reverse_ratio.has_value()) {
-        check_positive("setup.gearing.reverse_ratio", g.reverse_ratio.value(), errors);
-    }
 }
 
 void Validator::validate_brakes(const std::optional<Brakes>& brakes, std::vector<ValidationError>& errors) {
@@ -425,6 +444,10 @@ void Validator::validate_fuel(const std::optional<Fuel>& fuel, std::vector<Valid
         check_positive("setup.fuel.per_lap_consumption_l", f.per_lap_consumption_l.value(), errors);
     }
 
+    check_stint_laps(f, errors);
+}
+
+void Validator::check_stint_laps(const Fuel& f, std::vector<ValidationError>& errors) {
     // Stint target laps should be positive
     if (f.stint_target_laps.has_value()) {
         if (f.stint_target_laps.value() <= 0) {
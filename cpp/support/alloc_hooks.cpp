@@ -0,0 +1,131 @@
+#include "alloc_hooks.hpp"
+#include "orsf/instrument.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace orsf {
+
+namespace {
+
+// Trivially initialized, so safe to touch from operator new at any time
+thread_local uint64_t thread_allocations = 0;
+thread_local uint64_t thread_bytes = 0;
+std::atomic<uint64_t> process_allocations{0};
+std::atomic<uint64_t> process_bytes{0};
+
+void count(size_t size) noexcept {
+    ++thread_allocations;
+    thread_bytes += size;
+    process_allocations.fetch_add(1, std::memory_order_relaxed);
+    process_bytes.fetch_add(size, std::memory_order_relaxed);
+    Instrumentation::note_allocation();
+}
+
+void* allocate(size_t size) noexcept {
+    count(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocate_aligned(size_t size, std::align_val_t alignment) noexcept {
+    count(size);
+    size_t align = static_cast<size_t>(alignment);
+    if (align < sizeof(void*)) align = sizeof(void*);
+    void* ptr = nullptr;
+#if defined(_WIN32)
+    ptr = _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+    if (posix_memalign(&ptr, align, size == 0 ? 1 : size) != 0) ptr = nullptr;
+#endif
+    return ptr;
+}
+
+void release_aligned(void* ptr) noexcept {
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+} // namespace
+
+AllocationCounter::AllocationCounter() noexcept : start_(thread_total()) {}
+
+AllocationCount AllocationCounter::count() const noexcept {
+    AllocationCount now = thread_total();
+    return AllocationCount{now.allocations - start_.allocations, now.bytes - start_.bytes};
+}
+
+void AllocationCounter::restart() noexcept {
+    start_ = thread_total();
+}
+
+AllocationCount AllocationCounter::thread_total() noexcept {
+    return AllocationCount{thread_allocations, thread_bytes};
+}
+
+AllocationCount AllocationCounter::process_total() noexcept {
+    return AllocationCount{process_allocations.load(std::memory_order_relaxed),
+                           process_bytes.load(std::memory_order_relaxed)};
+}
+
+} // namespace orsf
+
+// ============================================================================
+// Global Operator New/Delete Replacements
+// ============================================================================
+
+void* operator new(size_t size) {
+    if (void* ptr = orsf::allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    if (void* ptr = orsf::allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return orsf::allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return orsf::allocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    if (void* ptr = orsf::allocate_aligned(size, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    if (void* ptr = orsf::allocate_aligned(size, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return orsf::allocate_aligned(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return orsf::allocate_aligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { orsf::release_aligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { orsf::release_aligned(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { orsf::release_aligned(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { orsf::release_aligned(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { orsf::release_aligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { orsf::release_aligned(ptr); }
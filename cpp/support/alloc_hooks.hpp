@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace orsf {
+
+// ============================================================================
+// Allocation Counting (tests and benchmarks only)
+// ============================================================================
+
+/// Allocations and bytes requested through global operator new
+struct AllocationCount {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+/// Counts allocations made by the current thread while alive
+///
+/// Only meaningful in programs linked with orsf_alloc_hooks, which replaces
+/// the global operator new/delete. The hooks also report every allocation
+/// to Instrumentation::note_allocation, so instrumented stages fill in
+/// their allocation counters.
+///
+///     AllocationCounter counter;
+///     auto setup = ORSF::from_json(text);
+///     counter.count().allocations;    // allocations made by the parse
+class AllocationCounter {
+public:
+    AllocationCounter() noexcept;
+
+    /// Allocations since construction (or the last restart)
+    AllocationCount count() const noexcept;
+
+    void restart() noexcept;
+
+    /// Totals for the current thread since it started
+    static AllocationCount thread_total() noexcept;
+
+    /// Totals for all threads since the program started
+    static AllocationCount process_total() noexcept;
+
+private:
+    AllocationCount start_;
+};
+
+} // namespace orsf
@@ -0,0 +1,36 @@
+#include "orsf/plugin.hpp"
+#include <cstring>
+
+// Adapter plugin used by test_plugin.cpp
+namespace {
+
+class PluginTestAdapter : public orsf::BaseAdapter {
+public:
+    explicit PluginTestAdapter(const std::string& car_key)
+        : BaseAdapter("plugsim", "1.0", car_key, "Adapter from a plugin") {}
+
+    std::vector<uint8_t> orsf_to_native(const orsf::ORSF& orsf) const override {
+        std::string text = "PLUGSIM " + std::string(car_key()) + " " + orsf.metadata.name;
+        return std::vector<uint8_t>(text.begin(), text.end());
+    }
+
+    orsf::ORSF native_to_orsf(const std::vector<uint8_t>& data) const override {
+        orsf::ORSF orsf;
+        orsf.metadata.name = std::string(data.begin(), data.end());
+        return orsf;
+    }
+
+    std::string get_suggested_filename() const override { return "setup.plug"; }
+    std::string get_file_extension() const override { return "plug"; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+    std::vector<orsf::FieldMapping> get_field_mappings() const override { return {}; }
+};
+
+orsf::Adapter* create_adapter(const char* id, const char* version, const char* car_key) {
+    if (std::strcmp(id, "plugsim") != 0 || std::strcmp(version, "1.0") != 0) return nullptr;
+    return new PluginTestAdapter(car_key);
+}
+
+} // namespace
+
+ORSF_PLUGIN(create_adapter)
@@ -1,8 +1,34 @@
 #include <catch2/catch_test_macros.hpp>
 #include "orsf/orsf.hpp"
+#include <atomic>
+#include <thread>
 
 using namespace orsf;
 
+namespace {
+
+struct CarAdapter : ExampleAdapter {
+    CarAdapter(const std::string& version, const std::string& car_key) {
+        metadata_.version = version;
+        metadata_.car_key = car_key;
+    }
+};
+
+struct StaticTestAdapter : BaseAdapter {
+    StaticTestAdapter() : BaseAdapter("static_test", "1.0", "generic") {}
+
+    std::vector<uint8_t> orsf_to_native(const ORSF&) const override { return {}; }
+    ORSF native_to_orsf(const std::vector<uint8_t>&) const override { return ORSF{}; }
+    std::string get_suggested_filename() const override { return "static_test.json"; }
+    std::string get_file_extension() const override { return "json"; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+    std::vector<FieldMapping> get_field_mappings() const override { return {}; }
+};
+
+} // namespace
+
+ORSF_REGISTER_ADAPTER(StaticTestAdapter);
+
 TEST_CASE("AdapterRegistry is a singleton", "[adapter]") {
     auto& registry1 = AdapterRegistry::instance();
     auto& registry2 = AdapterRegistry::instance();
@@ -68,6 +94,173 @@ TEST_CASE("AdapterRegistry can get all adapters", "[adapter]") {
     registry.clear();
 }
 
+TEST_CASE("AdapterRegistry resolves by index in registration order", "[adapter]") {
+    auto& registry = AdapterRegistry::instance();
+    registry.clear();
+
+    auto gt3_v1 = std::make_shared<CarAdapter>("1.0", "gt3");
+    auto gt4_v1 = std::make_shared<CarAdapter>("1.0", "gt4");
+    auto gt4_v2 = std::make_shared<CarAdapter>("2.0", "gt4");
+    registry.register_adapter(gt3_v1);
+    registry.register_adapter(gt4_v1);
+    registry.register_adapter(gt4_v2);
+
+    REQUIRE(registry.resolve("example", "2.0", "gt4") == gt4_v2);
+    REQUIRE(registry.resolve("example", "", "gt4") == gt4_v1);
+    REQUIRE(registry.resolve("example", "2.0") == gt4_v2);
+    REQUIRE(registry.resolve("example") == gt3_v1);
+
+    // No match for version/car falls back to the first adapter for the game
+    REQUIRE(registry.resolve("example", "3.0", "gt4") == gt3_v1);
+
+    REQUIRE(registry.get_adapters_for_game("example").size() == 3);
+    REQUIRE(registry.get_adapters_for_game("other").empty());
+
+    registry.unregister_adapter("example", "1.0", "gt3");
+    REQUIRE(registry.resolve("example") == gt4_v1);
+
+    registry.clear();
+}
+
+TEST_CASE("AdapterRegistry resolves while adapters are registered", "[adapter]") {
+    auto& registry = AdapterRegistry::instance();
+    registry.clear();
+    registry.register_adapter(std::make_shared<ExampleAdapter>());
+
+    std::atomic<bool> running{true};
+    std::atomic<int> misses{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            while (running) {
+                if (!registry.resolve("example", "1.0", "generic")) ++misses;
+                if (registry.get_adapters_for_game("example").empty()) ++misses;
+            }
+        });
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        auto adapter = std::make_shared<ExampleAdapter>();
+        registry.register_adapter(adapter);
+        registry.unregister_adapter("other", "1.0", std::to_string(i));
+    }
+    running = false;
+    for (auto& reader : readers) reader.join();
+
+    REQUIRE(misses == 0);
+    REQUIRE(registry.get_all_adapters().size() == 201);
+
+    registry.clear();
+}
+
+TEST_CASE("Frozen AdapterRegistry resolves from a perfect-hash table", "[adapter]") {
+    AdapterRegistry registry;
+
+    std::vector<std::shared_ptr<Adapter>> adapters;
+    for (int i = 0; i < 300; ++i) {
+        adapters.push_back(std::make_shared<CarAdapter>(i % 2 == 0 ? "1.0" : "2.0", "car" + std::to_string(i)));
+    }
+    registry.register_adapters(adapters);
+
+    // Same answers before and after freezing
+    std::vector<std::shared_ptr<Adapter>> before;
+    for (int i = 0; i < 300; ++i) {
+        before.push_back(registry.resolve("example", "", "car" + std::to_string(i)));
+    }
+    auto first_v2 = registry.resolve("example", "2.0");
+
+    registry.freeze();
+    REQUIRE(registry.is_frozen());
+
+    for (int i = 0; i < 300; ++i) {
+        std::string car_key = "car" + std::to_string(i);
+        REQUIRE(registry.resolve("example", "", car_key) == before[i]);
+        REQUIRE(registry.resolve("example", i % 2 == 0 ? "1.0" : "2.0", car_key) == adapters[i]);
+    }
+    REQUIRE(registry.resolve("example", "2.0") == first_v2);
+    REQUIRE(registry.resolve("example", "9.9", "car1") == adapters[0]);
+    REQUIRE(registry.resolve("missing") == nullptr);
+    REQUIRE(registry.get_all_adapters().size() == 300);
+
+    SECTION("Mutations throw") {
+        REQUIRE_THROWS_AS(registry.register_adapter(std::make_shared<ExampleAdapter>()), std::runtime_error);
+        REQUIRE_THROWS_AS(registry.unregister_adapter("example", "1.0", "car0"), std::runtime_error);
+        REQUIRE_THROWS_AS(registry.clear(), std::runtime_error);
+        REQUIRE_THROWS_AS(registry.register_class_profile("GT3", ValidationProfile{}), std::runtime_error);
+    }
+
+    SECTION("Freezing again is a no-op") {
+        registry.freeze();
+        REQUIRE(registry.resolve("example", "1.0", "car0") == adapters[0]);
+    }
+}
+
+TEST_CASE("Frozen empty AdapterRegistry resolves nothing", "[adapter]") {
+    AdapterRegistry registry;
+    registry.freeze();
+    REQUIRE(registry.resolve("example") == nullptr);
+}
+
+TEST_CASE("ORSF_REGISTER_ADAPTER adds adapters to the link-time table", "[adapter]") {
+    AdapterRegistry registry;
+    REQUIRE(registry.register_static_adapters() >= 1);
+
+    auto adapter = registry.resolve("static_test");
+    REQUIRE(adapter != nullptr);
+    REQUIRE(adapter->get_suggested_filename() == "static_test.json");
+}
+
+TEST_CASE("BaseAdapter exposes identity without copying", "[adapter]") {
+    ExampleAdapter adapter;
+    REQUIRE(adapter.id() == "example");
+    REQUIRE(adapter.version() == "1.0");
+    REQUIRE(adapter.car_key() == "generic");
+    REQUIRE(adapter.metadata().description == adapter.get_metadata().description);
+    REQUIRE(adapter.id().data() == adapter.metadata().id.data());
+}
+
+TEST_CASE("AdapterRegistry indexes adapters not derived from BaseAdapter", "[adapter]") {
+    struct RawAdapter : Adapter {
+        std::string get_id() const override { return "raw"; }
+        std::string get_version() const override { return "2.0"; }
+        std::string get_car_key() const override { return "kart"; }
+        std::string get_suggested_filename() const override { return "raw.bin"; }
+        std::vector<uint8_t> orsf_to_native(const ORSF&) const override { return {}; }
+        ORSF native_to_orsf(const std::vector<uint8_t>&) const override { return ORSF{}; }
+        std::vector<ValidationError> validate_orsf(const ORSF&) const override { return {}; }
+        std::string get_file_extension() const override { return "bin"; }
+        std::optional<std::string> get_install_path() const override { return std::nullopt; }
+        std::vector<FieldMapping> get_field_mappings() const override { return {}; }
+        Metadata get_metadata() const override { return Metadata{"raw", "2.0", "kart", "", ""}; }
+    };
+
+    AdapterRegistry registry;
+    auto adapter = std::make_shared<RawAdapter>();
+    registry.register_adapter(adapter);
+
+    REQUIRE(registry.resolve("raw", "2.0", "kart") == adapter);
+    registry.unregister_adapter("raw", "2.0", "kart");
+    REQUIRE(registry.resolve("raw") == nullptr);
+}
+
+TEST_CASE("AdapterRegistry indexes BaseAdapter overrides of the identity getters", "[adapter]") {
+    struct RenamedAdapter : ExampleAdapter {
+        std::string get_id() const override { return "renamed"; }
+        std::string get_car_key() const override { return "gt3"; }
+    };
+
+    AdapterRegistry registry;
+    auto adapter = std::make_shared<RenamedAdapter>();
+    registry.register_adapter(adapter);
+
+    REQUIRE(registry.resolve("renamed", "1.0", "gt3") == adapter);
+    REQUIRE(registry.resolve("example") == nullptr);
+    REQUIRE(registry.get_adapters_for_game("renamed").size() == 1);
+
+    registry.unregister_adapter("renamed", "1.0", "gt3");
+    REQUIRE(registry.resolve("renamed") == nullptr);
+}
+
 TEST_CASE("ExampleAdapter converts ORSF to native", "[adapter]") {
     ORSF setup;
     setup.metadata.id = "test";
@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include "alloc_hooks.hpp"
+
+using namespace orsf;
+
+// Allocation budgets for the hot paths. Counts come from the global
+// operator new hooks in orsf_alloc_hooks. Budgets leave headroom over the
+// measured counts (noted per case, libstdc++) so a standard library
+// change does not trip them, while a new per-field or per-call
+// allocation does.
+
+namespace {
+
+ORSF create_budget_setup() {
+    ORSF setup;
+    setup.metadata.id = "budget-setup";
+    setup.metadata.name = "Monza Qualifying";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.car.car_class = "GT3";
+
+    Aerodynamics aero;
+    aero.front_wing = 3.0;
+    aero.rear_wing = 7.0;
+    setup.setup.aero = aero;
+
+    Tires tires;
+    tires.compound = "Medium";
+    tires.pressure_fl_kpa = 175.0;
+    setup.setup.tires = tires;
+
+    Brakes brakes;
+    brakes.brake_bias_pct = 56.5;
+    setup.setup.brakes = brakes;
+    return setup;
+}
+
+std::vector<FieldMapping> create_budget_mappings() {
+    return {
+        FieldMapping("setup.aero.front_wing", "FrontWing"),
+        FieldMapping("setup.tires.pressure_fl_kpa", "PressureLF",
+            Transform::unit_convert(Unit::KPA, Unit::PSI), Transform::unit_convert(Unit::PSI, Unit::KPA)),
+        FieldMapping("setup.brakes.brake_bias_pct", "BrakeBias"),
+    };
+}
+
+/// Allocations made by one call, after a warm-up call
+template <typename Op>
+uint64_t allocations_of(Op&& op) {
+    op();
+    AllocationCounter counter;
+    op();
+    return counter.count().allocations;
+}
+
+} // namespace
+
+TEST_CASE("Allocation hooks count the current thread", "[allocations]") {
+    AllocationCounter counter;
+    std::vector<std::string> strings;
+    strings.reserve(4);
+    strings.emplace_back(100, 'x');
+
+    AllocationCount count = counter.count();
+    REQUIRE(strings.front().size() == 100);
+    REQUIRE(count.allocations == 2);
+    REQUIRE(count.bytes >= 4 * sizeof(std::string) + 101);
+    REQUIRE(AllocationCounter::process_total().allocations >= AllocationCounter::thread_total().allocations);
+}
+
+TEST_CASE("Parse stays within its allocation budget", "[allocations]") {
+    std::string text = create_budget_setup().to_json_string();
+    // Measured: 89
+    REQUIRE(allocations_of([&] { return ORSF::from_json(text); }) <= 120);
+}
+
+TEST_CASE("Serialize stays within its allocation budget", "[allocations]") {
+    ORSF setup = create_budget_setup();
+    // Measured: 84
+    REQUIRE(allocations_of([&] { return setup.to_json_string(); }) <= 120);
+}
+
+TEST_CASE("Validate stays within its allocation budget", "[allocations]") {
+    ORSF setup = create_budget_setup();
+    REQUIRE(Validator::validate(setup).empty());
+    // Measured: 5 (thousands when timestamps were matched with std::regex)
+    REQUIRE(allocations_of([&] { return Validator::validate(setup); }) <= 10);
+}
+
+TEST_CASE("Mapping stays within its allocation budget", "[allocations]") {
+    ORSF setup = create_budget_setup();
+    auto mappings = create_budget_mappings();
+    FlatSetup native = MappingEngine::map_to_native(setup, mappings);
+
+    // Measured: 15 and 14
+    REQUIRE(allocations_of([&] { return MappingEngine::map_to_native(setup, mappings); }) <= 24);
+    REQUIRE(allocations_of([&] { return MappingEngine::map_to_orsf(native, mappings, setup); }) <= 24);
+}
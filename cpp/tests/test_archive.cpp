@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <stdexcept>
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_archive_setup(const std::string& id) {
+    ORSF setup;
+    setup.metadata.id = id;
+    setup.metadata.name = "Archived " + id;
+    setup.metadata.created_at = "2024-01-01T00:00:00Z";
+    setup.car.make = "Ferrari";
+    setup.car.model = "296 GT3";
+    return setup;
+}
+
+std::string write_archive(size_t count) {
+    std::string out;
+    StringSink sink(out);
+    ArchiveWriter writer(sink);
+    for (size_t i = 0; i < count; ++i) {
+        writer.add("runs/setup-" + std::to_string(i) + ".json", create_archive_setup("s" + std::to_string(i)));
+    }
+    writer.finish();
+    REQUIRE(writer.count() == count);
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("Archives round-trip entries in order", "[archive]") {
+    std::string data;
+    {
+        StringSink sink(data);
+        ArchiveWriter writer(sink);
+        writer.add("a.json", std::string_view("{\"raw\":true}"));
+        writer.add("runs/b.json", create_archive_setup("b"));
+        writer.add("", std::string_view(""));
+        writer.finish();
+        REQUIRE_THROWS_AS(writer.add("late.json", std::string_view("{}")), std::runtime_error);
+    }
+
+    REQUIRE(ArchiveReader::is_archive(ByteSpan(std::string_view(data))));
+    ArchiveReader reader{ByteSpan(std::string_view(data))};
+    ArchiveEntry entry;
+
+    REQUIRE(reader.next(entry));
+    REQUIRE(entry.name == "a.json");
+    REQUIRE(entry.json == "{\"raw\":true}");
+
+    REQUIRE(reader.next(entry));
+    REQUIRE(entry.name == "runs/b.json");
+    REQUIRE(ORSF::from_json(std::string(entry.json)).metadata.id == "b");
+
+    REQUIRE(reader.next(entry));
+    REQUIRE(entry.name.empty());
+    REQUIRE(entry.json.empty());
+
+    REQUIRE_FALSE(reader.next(entry));
+    REQUIRE_FALSE(reader.next(entry));
+    REQUIRE(reader.count() == 3);
+}
+
+TEST_CASE("Archive reader rejects foreign and damaged data", "[archive]") {
+    REQUIRE_FALSE(ArchiveReader::is_archive(ByteSpan(std::string_view("{\"metadata\":{}}"))));
+    REQUIRE_THROWS_AS(ArchiveReader(ByteSpan(std::string_view("ORSF"))), std::runtime_error);
+
+    std::string data = write_archive(3);
+
+    // Cut anywhere before the end of the trailer
+    for (size_t size : {data.size() - 1, data.size() - 12, data.size() / 2, size_t(12)}) {
+        ArchiveReader reader{ByteSpan(std::string_view(data).substr(0, size))};
+        ArchiveEntry entry;
+        REQUIRE_THROWS_AS([&] { while (reader.next(entry)) {} }(), std::runtime_error);
+    }
+
+    // Trailer count must match the entries read
+    std::string wrong = data;
+    wrong[wrong.size() - 8] = 7;
+    ArchiveReader reader{ByteSpan(std::string_view(wrong))};
+    ArchiveEntry entry;
+    REQUIRE(reader.next(entry));
+    REQUIRE(reader.next(entry));
+    REQUIRE(reader.next(entry));
+    REQUIRE_THROWS_AS(reader.next(entry), std::runtime_error);
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <atomic>
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_batch_setup(double front_wing) {
+    ORSF setup;
+    setup.metadata.id = "batch-" + std::to_string(front_wing);
+    setup.metadata.name = "Batch Setup";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.setup.aero = Aerodynamics{};
+    setup.setup.aero->front_wing = front_wing;
+    setup.setup.brakes = Brakes{};
+    setup.setup.brakes->brake_bias_pct = 57.0;
+    return setup;
+}
+
+// key=value adapter built on orsf_to_flat; counts mapping compilations
+class FlatAdapter : public BaseAdapter {
+public:
+    explicit FlatAdapter(bool fail_on_wide_wing = false)
+        : BaseAdapter("flat", "1.0", "generic"), fail_on_wide_wing_(fail_on_wide_wing) {}
+
+    mutable std::atomic<int> mapping_calls{0};
+
+    mutable std::atomic<int> extracted_calls{0};
+
+    std::vector<uint8_t> orsf_to_native(const ORSF& orsf) const override {
+        ByteBuffer out;
+        append_flat(orsf_to_flat(orsf), out);
+        return out.release();
+    }
+
+    void encode_extracted(const ORSF& orsf, const FieldValues& values, ByteBuffer& out) const override {
+        ++extracted_calls;
+        append_flat(orsf_to_flat(orsf, values), out);
+    }
+
+    ORSF native_to_orsf(const std::vector<uint8_t>&) const override { return ORSF{}; }
+    std::string get_suggested_filename() const override { return "setup.ini"; }
+    std::string get_file_extension() const override { return "ini"; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+
+    std::vector<FieldMapping> get_field_mappings() const override {
+        ++mapping_calls;
+        return {
+            FieldMapping("setup.aero.front_wing", "wing"),
+            FieldMapping("setup.brakes.brake_bias_pct", "bias",
+                Transform::percent_to_ratio(), Transform::ratio_to_percent(), false),
+        };
+    }
+
+private:
+    bool fail_on_wide_wing_;
+
+    void append_flat(FlatSetup flat, ByteBuffer& out) const {
+        if (fail_on_wide_wing_ && flat["wing"] > 5.0) {
+            throw std::runtime_error("wing out of range");
+        }
+
+        ByteBufferSink sink(out);
+        TextWriter writer(sink);
+        write_key_values(flat, writer);
+        writer.flush();
+    }
+};
+
+} // namespace
+
+TEST_CASE("convert_batch converts the N x M grid into one arena", "[batch]") {
+    std::vector<ORSF> setups;
+    for (int i = 0; i < 20; ++i) {
+        setups.push_back(create_batch_setup(static_cast<double>(i % 5)));
+    }
+
+    auto flat = std::make_shared<FlatAdapter>();
+    auto example = std::make_shared<ExampleAdapter>();
+    std::vector<std::shared_ptr<Adapter>> adapters = {flat, example};
+
+    ThreadPoolExecutor executor(4);
+    BatchResult result = convert_batch(setups, adapters, executor);
+
+    REQUIRE(result.items.size() == 40);
+    REQUIRE(result.error_count() == 0);
+
+    size_t total = 0;
+    for (size_t s = 0; s < setups.size(); ++s) {
+        for (size_t a = 0; a < adapters.size(); ++a) {
+            const BatchItem& item = result.at(s, a);
+            REQUIRE(item.setup == s);
+            REQUIRE(item.adapter == a);
+
+            auto expected = adapters[a]->orsf_to_native(setups[s]);
+            REQUIRE(result.bytes(item).as_chars() == std::string(expected.begin(), expected.end()));
+            total += item.size;
+        }
+    }
+    REQUIRE(result.arena_size() == total);
+
+    // Mappings were compiled once for the whole batch (and the checks above),
+    // and every mapped item was encoded from the pre-extracted values
+    REQUIRE(flat->mapping_calls == 1);
+    REQUIRE(flat->extracted_calls == 20);
+}
+
+TEST_CASE("convert_batch records per-item errors", "[batch]") {
+    std::vector<ORSF> setups = {create_batch_setup(3.0), create_batch_setup(9.0), create_batch_setup(4.0)};
+    std::vector<std::shared_ptr<Adapter>> adapters = {std::make_shared<FlatAdapter>(true)};
+
+    InlineExecutor executor;
+    BatchResult result = convert_batch(setups, adapters, executor);
+
+    REQUIRE(result.error_count() == 1);
+    REQUIRE(result.at(0, 0).ok());
+    REQUIRE_FALSE(result.at(1, 0).ok());
+    REQUIRE(result.at(1, 0).error == "wing out of range");
+    REQUIRE(result.bytes(1, 0).empty());
+    REQUIRE(result.bytes(2, 0).as_chars() == "bias=0.57\nwing=4\n");
+}
+
+TEST_CASE("convert_batch handles empty input", "[batch]") {
+    InlineExecutor executor;
+    BatchResult result = convert_batch(std::vector<ORSF>{}, {std::make_shared<ExampleAdapter>()}, executor);
+    REQUIRE(result.items.empty());
+    REQUIRE(result.arena_size() == 0);
+}
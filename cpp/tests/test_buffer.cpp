@@ -0,0 +1,130 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <type_traits>
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_buffer_setup() {
+    ORSF setup;
+    setup.metadata.id = "buffer-1";
+    setup.metadata.name = "Buffer Setup";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.setup.brakes = Brakes{};
+    setup.setup.brakes->brake_bias_pct = 56.5;
+    return setup;
+}
+
+// Adapter implementing only the vector-based API
+class LegacyAdapter : public BaseAdapter {
+public:
+    LegacyAdapter() : BaseAdapter("legacy", "1.0", "generic") {}
+
+    std::vector<uint8_t> orsf_to_native(const ORSF& orsf) const override {
+        std::string text = orsf.to_json_string();
+        return std::vector<uint8_t>(text.begin(), text.end());
+    }
+
+    ORSF native_to_orsf(const std::vector<uint8_t>& data) const override {
+        return ORSF::from_json(std::string(data.begin(), data.end()));
+    }
+
+    std::string get_suggested_filename() const override { return "legacy.json"; }
+    std::string get_file_extension() const override { return "json"; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+    std::vector<FieldMapping> get_field_mappings() const override { return {}; }
+};
+
+} // namespace
+
+TEST_CASE("ByteSpan views memory without copying", "[buffer]") {
+    std::string text = "brake_balance=56.5";
+    ByteSpan span(text);
+
+    REQUIRE(span.size() == text.size());
+    REQUIRE(reinterpret_cast<const char*>(span.data()) == text.data());
+    REQUIRE(span.as_chars() == text);
+    REQUIRE(span.subspan(6, 7).as_chars() == "balance");
+    REQUIRE(span.subspan(100).empty());
+
+    // Views are explicit, and never of temporaries
+    static_assert(!std::is_convertible_v<const std::vector<uint8_t>&, ByteSpan>);
+    static_assert(!std::is_convertible_v<std::string_view, ByteSpan>);
+    static_assert(!std::is_constructible_v<ByteSpan, std::vector<uint8_t>&&>);
+    static_assert(!std::is_constructible_v<ByteSpan, std::string&&>);
+}
+
+TEST_CASE("ByteBuffer appends and releases without copying", "[buffer]") {
+    ByteBuffer buffer;
+    buffer.append(std::string_view("key="));
+    buffer.push_back('1');
+    REQUIRE(buffer.span().as_chars() == "key=1");
+
+    uint8_t* region = buffer.grow(4);
+    region[0] = '\n';
+    buffer.truncate(6);
+    REQUIRE(buffer.span().as_chars() == "key=1\n");
+
+    std::vector<uint8_t> released = buffer.release();
+    REQUIRE(released.size() == 6);
+    REQUIRE(buffer.empty());
+
+    SECTION("Appending a vector to an empty buffer adopts its storage") {
+        const uint8_t* storage = released.data();
+        buffer.append(std::move(released));
+        REQUIRE(buffer.data() == storage);
+    }
+}
+
+TEST_CASE("ExampleAdapter decodes and encodes through byte views", "[buffer]") {
+    ExampleAdapter adapter;
+    ORSF setup = create_buffer_setup();
+
+    ByteBuffer out;
+    adapter.encode_native(setup, out);
+    REQUIRE(out.span().as_chars() == setup.to_json_string(2));
+
+    // Matches the vector API byte for byte
+    std::vector<uint8_t> legacy = adapter.orsf_to_native(setup);
+    REQUIRE(std::vector<uint8_t>(out.data(), out.data() + out.size()) == legacy);
+
+    ORSF decoded = adapter.decode_native(out.span());
+    REQUIRE(decoded.setup.brakes->brake_bias_pct == 56.5);
+
+    SECTION("Compact output") {
+        ByteBuffer compact;
+        write_orsf_json(setup, compact);
+        REQUIRE(compact.span().as_chars() == setup.to_json_string());
+    }
+
+    SECTION("Indented output matches to_json_string") {
+        for (int indent : {0, 2, 4}) {
+            ByteBuffer pretty;
+            write_orsf_json(setup, pretty, indent);
+            REQUIRE(pretty.span().as_chars() == setup.to_json_string(indent));
+        }
+    }
+
+    SECTION("Malformed input throws") {
+        REQUIRE_THROWS_AS(adapter.decode_native(ByteSpan(std::string_view("{\"schema\":"))), std::runtime_error);
+    }
+}
+
+TEST_CASE("Default span API bridges to the vector API", "[buffer]") {
+    LegacyAdapter adapter;
+    ORSF setup = create_buffer_setup();
+
+    ByteBuffer out;
+    adapter.encode_native(setup, out);
+    REQUIRE(out.span().as_chars() == setup.to_json_string());
+
+    // Appends after existing content
+    adapter.encode_native(setup, out);
+    REQUIRE(out.size() == 2 * setup.to_json_string().size());
+
+    ORSF decoded = adapter.decode_native(ByteSpan(out.data(), out.size() / 2));
+    REQUIRE(decoded.metadata.id == "buffer-1");
+}
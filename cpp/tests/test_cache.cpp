@@ -0,0 +1,153 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <thread>
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_cached_setup() {
+    ORSF setup;
+    setup.metadata.id = "cache-1";
+    setup.metadata.name = "Cached Setup";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.setup.aero = Aerodynamics{};
+    setup.setup.aero->front_wing = 5.0;
+    return setup;
+}
+
+} // namespace
+
+TEST_CASE("content_hash is canonical", "[cache]") {
+    ORSF a = create_cached_setup();
+    ORSF b = create_cached_setup();
+    REQUIRE(content_hash(a) == content_hash(b));
+
+    SECTION("updated_at is part of the content") {
+        b.metadata.updated_at = "2024-06-01T00:00:00Z";
+        REQUIRE(content_hash(a) != content_hash(b));
+    }
+
+    SECTION("Negative zero equals zero") {
+        a.setup.aero->rear_wing = 0.0;
+        b.setup.aero->rear_wing = -0.0;
+        REQUIRE(content_hash(a) == content_hash(b));
+    }
+
+    SECTION("Field order in the source JSON does not matter") {
+        std::string json_str = R"({
+            "setup": {"aero": {"front_wing": 5.0}},
+            "car": {"model": "911 GT3 R", "make": "Porsche"},
+            "metadata": {"created_at": "2024-01-01T12:00:00Z", "name": "Cached Setup", "id": "cache-1"},
+            "schema": "orsf://v1"
+        })";
+        ORSF parsed = ORSF::from_json(json_str);
+        REQUIRE(content_hash(parsed) == content_hash(a));
+    }
+
+    SECTION("Content changes change the hash") {
+        b.setup.aero->front_wing = 5.5;
+        REQUIRE(content_hash(a) != content_hash(b));
+    }
+}
+
+TEST_CASE("LruCache evicts least recently used entries", "[cache]") {
+    LruCache<int, std::string> cache(2);
+    cache.put(1, "one");
+    cache.put(2, "two");
+
+    REQUIRE(cache.get(1) == std::optional<std::string>("one"));  // 2 is now LRU
+    cache.put(3, "three");
+
+    REQUIRE_FALSE(cache.get(2).has_value());
+    REQUIRE(cache.get(3).has_value());
+
+    auto stats = cache.stats();
+    REQUIRE(stats.hits == 2);
+    REQUIRE(stats.misses == 1);
+    REQUIRE(stats.evictions == 1);
+    REQUIRE(stats.size == 2);
+    REQUIRE(stats.capacity == 2);
+}
+
+TEST_CASE("ResultCache reuses validation results", "[cache]") {
+    ResultCache cache;
+    ORSF setup = create_cached_setup();
+    setup.setup.aero->brake_duct_front_pct = 150.0;
+
+    auto first = cache.validate(setup);
+    ORSF copy = setup;
+    auto second = cache.validate(copy);
+
+    REQUIRE(first == second);
+    REQUIRE(first->size() == 1);
+    REQUIRE(cache.validation_stats().hits == 1);
+    REQUIRE(cache.validation_stats().misses == 1);
+
+    // A different rule-set version is a different key
+    cache.validate(setup, Validator::RULE_SET_VERSION + 1);
+    REQUIRE(cache.validation_stats().misses == 2);
+
+    // A setup whose timestamp changed is validated again
+    copy.metadata.updated_at = "2023-01-01T00:00:00Z";
+    auto stale = cache.validate(copy);
+    REQUIRE(cache.validation_stats().misses == 3);
+    REQUIRE(stale->size() == 2);
+}
+
+TEST_CASE("ResultCache keys adapter validation by adapter", "[cache]") {
+    ResultCache cache;
+    ExampleAdapter adapter;
+    ORSF setup = create_cached_setup();
+
+    auto plain = cache.validate(setup, 1);
+    auto adapted = cache.validate(adapter, setup, 1);
+    REQUIRE(plain != adapted);
+    REQUIRE(cache.validation_stats().misses == 2);
+
+    cache.validate(adapter, setup, 1);
+    REQUIRE(cache.validation_stats().hits == 1);
+}
+
+TEST_CASE("ResultCache reuses native bytes per adapter", "[cache]") {
+    ResultCache cache;
+    ExampleAdapter adapter;
+    ORSF setup = create_cached_setup();
+
+    auto first = cache.orsf_to_native(adapter, setup);
+    auto second = cache.orsf_to_native(adapter, setup);
+    REQUIRE(first == second);
+    REQUIRE(*first == adapter.orsf_to_native(setup));
+
+    auto stats = cache.conversion_stats();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 1);
+}
+
+TEST_CASE("ResultCache is safe to share between threads", "[cache]") {
+    ResultCache cache(16, 16);
+    std::vector<ORSF> setups;
+    for (int i = 0; i < 8; ++i) {
+        ORSF setup = create_cached_setup();
+        setup.setup.aero->front_wing = static_cast<double>(i);
+        setups.push_back(setup);
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int round = 0; round < 50; ++round) {
+                for (const auto& setup : setups) {
+                    cache.validate(setup);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    auto stats = cache.validation_stats();
+    REQUIRE(stats.hits + stats.misses == 4 * 50 * 8);
+    REQUIRE(stats.size == 8);
+}
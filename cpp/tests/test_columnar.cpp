@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <cmath>
+#include <limits>
+
+using namespace orsf;
+
+namespace {
+
+ORSF make_setup_with_camber(std::optional<double> camber) {
+    ORSF setup;
+    setup.metadata.id = "columnar";
+    setup.metadata.name = "Columnar Setup";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+
+    if (camber.has_value()) {
+        setup.setup.suspension = Suspension{};
+        setup.setup.suspension->front_left = CornerSuspension{};
+        setup.setup.suspension->front_left->camber_deg = camber;
+    }
+    return setup;
+}
+
+} // namespace
+
+TEST_CASE("Bitmap tracks set bits", "[columnar]") {
+    Bitmap bitmap(130);
+    REQUIRE(bitmap.none());
+
+    bitmap.set(0);
+    bitmap.set(64);
+    bitmap.set(129);
+    REQUIRE(bitmap.count() == 3);
+    REQUIRE(bitmap.test(64));
+    REQUIRE_FALSE(bitmap.test(63));
+    REQUIRE(bitmap.indices() == std::vector<size_t>{0, 64, 129});
+
+    Bitmap all(130, true);
+    REQUIRE(all.count() == 130);
+}
+
+TEST_CASE("SetupColumns builds columns with validity", "[columnar]") {
+    std::vector<ORSF> setups = {
+        make_setup_with_camber(-2.5),
+        make_setup_with_camber(std::nullopt),
+        make_setup_with_camber(-8.0),
+    };
+
+    auto columns = SetupColumns::from_setups(setups, {"setup.suspension.front_left.camber_deg"});
+    REQUIRE(columns.rows() == 3);
+
+    const DoubleColumn* camber = columns.find("setup.suspension.front_left.camber_deg");
+    REQUIRE(camber != nullptr);
+    REQUIRE(camber->validity.test(0));
+    REQUIRE_FALSE(camber->validity.test(1));
+    REQUIRE(camber->values[2] == -8.0);
+
+    REQUIRE_THROWS_AS(SetupColumns::from_setups(setups, {"setup.unknown"}), std::runtime_error);
+}
+
+TEST_CASE("ColumnarValidator finds any-corner camber outliers", "[columnar]") {
+    std::vector<ORSF> setups;
+    for (int i = 0; i < 200; ++i) {
+        setups.push_back(make_setup_with_camber(i % 50 == 0 ? -7.5 : -2.0));
+    }
+    setups[77].setup.suspension->rear_right = CornerSuspension{};
+    setups[77].setup.suspension->rear_right->camber_deg = 3.0;
+
+    std::vector<ColumnRule> rules;
+    for (const char* corner : {"front_left", "front_right", "rear_left", "rear_right"}) {
+        rules.push_back(ColumnRule::range(
+            std::string("setup.suspension.") + corner + ".camber_deg", -6.0, 2.0,
+            ValidationSeverity::Warning));
+    }
+
+    std::vector<std::string> fields;
+    for (const auto& rule : rules) fields.push_back(rule.field);
+
+    auto columns = SetupColumns::from_setups(setups, fields);
+    ColumnarValidator validator(rules);
+    auto violations = validator.evaluate(columns);
+    REQUIRE(violations.size() == 4);
+
+    auto rows = ColumnarValidator::any_violation(violations, columns.rows()).indices();
+    REQUIRE(rows == std::vector<size_t>{0, 50, 77, 100, 150});
+
+    // Column building and rule evaluation on a pool give the same answer
+    ThreadPoolExecutor pool(3);
+    auto pooled_columns = SetupColumns::from_setups(setups, fields, pool);
+    REQUIRE(pooled_columns.columns().size() == 4);
+    REQUIRE(pooled_columns.columns()[3].field == fields[3]);
+    auto pooled = validator.evaluate(pooled_columns, pool);
+    REQUIRE(ColumnarValidator::any_violation(pooled, pooled_columns.rows()).indices() == rows);
+}
+
+TEST_CASE("ColumnarValidator kernels match scalar rules", "[columnar]") {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> values = {-1.0, 0.0, 0.5, 100.0, 100.5, nan, -0.0, 1e9};
+
+    DoubleColumn column;
+    column.field = "setup.brakes.brake_bias_pct";
+    column.values = values;
+    column.validity = Bitmap(values.size(), true);
+    column.validity.set(7, false);
+
+    for (const auto& rule : {ColumnRule::percentage(column.field),
+                             ColumnRule::positive(column.field),
+                             ColumnRule::non_negative(column.field),
+                             ColumnRule::range(column.field, 0.25, 100.0)}) {
+        Bitmap result = ColumnarValidator::evaluate_rule(rule, column);
+        for (size_t row = 0; row < values.size(); ++row) {
+            bool expected = column.validity.test(row) && rule.violates(values[row]);
+            REQUIRE(result.test(row) == expected);
+        }
+    }
+}
+
+TEST_CASE("ColumnarValidator materializes errors identical to Validator", "[columnar]") {
+    ORSF setup = make_setup_with_camber(-15.0);
+    setup.setup.tires = Tires{};
+    setup.setup.tires->pressure_fl_kpa = 500.0;
+    setup.setup.brakes = Brakes{};
+    setup.setup.brakes->brake_bias_pct = 120.0;
+    setup.setup.suspension->front_left->spring_rate_n_mm = -10.0;
+
+    std::vector<ORSF> setups = {make_setup_with_camber(-2.0), setup};
+    auto columns = SetupColumns::from_setups(setups);
+
+    ColumnarValidator validator;
+    auto violations = validator.evaluate(columns);
+    REQUIRE(ColumnarValidator::any_violation(violations, columns.rows()).indices() ==
+            std::vector<size_t>{1});
+
+    auto columnar_errors = validator.errors_for_row(columns, violations, 1);
+    auto scalar_errors = Validator::validate(setup);
+    REQUIRE(columnar_errors.size() == scalar_errors.size());
+
+    for (size_t i = 0; i < scalar_errors.size(); ++i) {
+        REQUIRE(columnar_errors[i].field == scalar_errors[i].field);
+        REQUIRE(columnar_errors[i].code == scalar_errors[i].code);
+        REQUIRE(columnar_errors[i].severity == scalar_errors[i].severity);
+        REQUIRE(columnar_errors[i].to_string() == scalar_errors[i].to_string());
+    }
+}
@@ -0,0 +1,201 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <algorithm>
+
+using namespace orsf;
+
+namespace {
+
+// Adapter declaring an extension, signatures and an optional sniff check
+class FormatAdapter : public BaseAdapter {
+public:
+    FormatAdapter(
+        const std::string& id,
+        std::string extension,
+        std::vector<FormatSignature> signatures,
+        std::string required_text = ""
+    ) : BaseAdapter(id, "1.0", "generic"),
+        extension_(std::move(extension)),
+        signatures_(std::move(signatures)),
+        required_text_(std::move(required_text)) {}
+
+    mutable int sniff_calls = 0;
+
+    std::vector<uint8_t> orsf_to_native(const ORSF&) const override { return {}; }
+    ORSF native_to_orsf(const std::vector<uint8_t>&) const override { return ORSF{}; }
+    std::string get_suggested_filename() const override { return "setup." + extension_; }
+    std::string get_file_extension() const override { return extension_; }
+    std::vector<FormatSignature> get_signatures() const override { return signatures_; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+    std::vector<FieldMapping> get_field_mappings() const override { return {}; }
+
+    bool sniff(ByteSpan head) const override {
+        ++sniff_calls;
+        return required_text_.empty() || head.as_chars().find(required_text_) != std::string_view::npos;
+    }
+
+private:
+    std::string extension_;
+    std::vector<FormatSignature> signatures_;
+    std::string required_text_;
+};
+
+std::vector<std::pair<size_t, size_t>> scan_all(const SignatureMatcher& matcher, std::string_view text) {
+    std::vector<SignatureMatch> matches;
+    matcher.scan(ByteSpan(text), matches);
+
+    std::vector<std::pair<size_t, size_t>> result;
+    for (const auto& match : matches) {
+        result.emplace_back(match.pattern, match.position);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("SignatureMatcher finds overlapping patterns in one pass", "[detect]") {
+    SignatureMatcher matcher({"he", "she", "his", "hers"});
+
+    auto matches = scan_all(matcher, "ushers");
+    REQUIRE(matches == std::vector<std::pair<size_t, size_t>>{{0, 2}, {1, 1}, {3, 2}});
+
+    REQUIRE(scan_all(matcher, "xyz").empty());
+    REQUIRE(scan_all(matcher, "").empty());
+}
+
+TEST_CASE("SignatureMatcher handles binary patterns", "[detect]") {
+    std::string magic("\x00\xffSTO", 5);
+    SignatureMatcher matcher({magic, std::string("\x01\x02", 2), ""});
+
+    std::string data = std::string("\x01\x02", 2) + magic + magic;
+    auto matches = scan_all(matcher, data);
+    REQUIRE(matches == std::vector<std::pair<size_t, size_t>>{{0, 2}, {0, 7}, {1, 0}});
+}
+
+TEST_CASE("SignatureMatcher without patterns matches nothing", "[detect]") {
+    SignatureMatcher empty;
+    REQUIRE(scan_all(empty, "anything").empty());
+
+    SignatureMatcher only_empty({""});
+    REQUIRE(scan_all(only_empty, "anything").empty());
+}
+
+TEST_CASE("File extensions are normalized", "[detect]") {
+    REQUIRE(file_extension("Setup.STO") == "sto");
+    REQUIRE(file_extension("/path/to/setups/monza.v2.Json") == "json");
+    REQUIRE(file_extension("C:\\setups\\spa.ini") == "ini");
+    REQUIRE(file_extension("/path.d/README").empty());
+    REQUIRE(file_extension(".hidden").empty());
+    REQUIRE(normalize_extension(".SET") == "set");
+}
+
+TEST_CASE("AdapterRegistry detects formats by signature and extension", "[detect]") {
+    AdapterRegistry registry;
+    auto binary = std::make_shared<FormatAdapter>("binary", "sto",
+        std::vector<FormatSignature>{FormatSignature(std::string("\x00STO", 4), 0)});
+    auto json = std::make_shared<FormatAdapter>("jsonsim", "json",
+        std::vector<FormatSignature>{FormatSignature("\"sim\": \"jsonsim\"")});
+    auto ini = std::make_shared<FormatAdapter>("inisim", ".INI", std::vector<FormatSignature>{});
+    registry.register_adapters({binary, json, ini});
+
+    std::string sto = std::string("\x00STO", 4) + "payload";
+    REQUIRE(registry.detect(ByteSpan(sto)) == binary);
+    REQUIRE(registry.detect(ByteSpan(sto), "whatever.bin") == binary);
+
+    // Anchored signatures must match at their offset
+    std::string shifted = "x" + sto;
+    REQUIRE(registry.detect(ByteSpan(shifted)) == nullptr);
+
+    std::string json_text = "{\n  \"sim\": \"jsonsim\",\n  \"wing\": 4\n}";
+    REQUIRE(registry.detect(ByteSpan(json_text), "setup.txt") == json);
+
+    std::string ini_text = "[aero]\nwing=4\n";
+    REQUIRE(registry.detect(ByteSpan(ini_text), "monza.ini") == ini);
+    REQUIRE(registry.detect(ByteSpan(ini_text)) == nullptr);
+}
+
+TEST_CASE("AdapterRegistry ranks detection candidates", "[detect]") {
+    AdapterRegistry registry;
+    auto generic = std::make_shared<FormatAdapter>("generic", "json",
+        std::vector<FormatSignature>{FormatSignature("{")});
+    auto specific = std::make_shared<FormatAdapter>("specific", "json",
+        std::vector<FormatSignature>{FormatSignature("{"), FormatSignature("\"car\": \"gt3\"")});
+    auto by_extension = std::make_shared<FormatAdapter>("extension", "json", std::vector<FormatSignature>{});
+    registry.register_adapters({by_extension, generic, specific});
+
+    std::string text = "{\"car\": \"gt3\"}";
+    auto candidates = registry.detect_all(ByteSpan(text), "a.json");
+    REQUIRE(candidates.size() == 3);
+    REQUIRE(candidates[0] == specific);
+    REQUIRE(candidates[1] == generic);
+    REQUIRE(candidates[2] == by_extension);
+
+    REQUIRE(registry.detect(ByteSpan(text), "a.json") == specific);
+}
+
+TEST_CASE("AdapterRegistry detection confirms candidates with sniff", "[detect]") {
+    AdapterRegistry registry;
+    auto strict = std::make_shared<FormatAdapter>("strict", "set",
+        std::vector<FormatSignature>{FormatSignature("SETUP")}, "version=2");
+    auto loose = std::make_shared<FormatAdapter>("loose", "set",
+        std::vector<FormatSignature>{});
+    auto unrelated = std::make_shared<FormatAdapter>("unrelated", "sto",
+        std::vector<FormatSignature>{FormatSignature("MAGIC")});
+    registry.register_adapters({strict, loose, unrelated});
+
+    std::string v1 = "SETUP\nversion=1\n";
+    REQUIRE(registry.detect(ByteSpan(v1), "a.set") == loose);
+
+    std::string v2 = "SETUP\nversion=2\n";
+    REQUIRE(registry.detect(ByteSpan(v2), "a.set") == strict);
+
+    // Only candidates are sniffed
+    REQUIRE(unrelated->sniff_calls == 0);
+}
+
+TEST_CASE("AdapterRegistry detection scans only the head", "[detect]") {
+    AdapterRegistry registry;
+    auto adapter = std::make_shared<FormatAdapter>("late", "bin",
+        std::vector<FormatSignature>{FormatSignature("LATE")});
+    registry.register_adapter(adapter);
+
+    std::string early = std::string(16, ' ') + "LATE";
+    REQUIRE(registry.detect(ByteSpan(early)) == adapter);
+
+    std::string late = std::string(AdapterRegistry::DETECT_HEAD_SIZE, ' ') + "LATE";
+    REQUIRE(registry.detect(ByteSpan(late)) == nullptr);
+}
+
+TEST_CASE("AdapterRegistry detection follows registry changes", "[detect]") {
+    AdapterRegistry registry;
+    std::string text = "MAGIC data";
+    REQUIRE(registry.detect(ByteSpan(text)) == nullptr);
+
+    auto adapter = std::make_shared<FormatAdapter>("magic", "bin",
+        std::vector<FormatSignature>{FormatSignature("MAGIC", 0)});
+    registry.register_adapter(adapter);
+    REQUIRE(registry.detect(ByteSpan(text)) == adapter);
+
+    registry.freeze();
+    REQUIRE(registry.detect(ByteSpan(text)) == adapter);
+    REQUIRE(registry.detect_all(ByteSpan(text), "x.bin").size() == 1);
+}
+
+TEST_CASE("ExampleAdapter detects ORSF JSON", "[detect]") {
+    AdapterRegistry registry;
+    auto adapter = std::make_shared<ExampleAdapter>();
+    registry.register_adapter(adapter);
+
+    ORSF setup;
+    setup.metadata.id = "detect";
+    setup.metadata.name = "Detect";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Ferrari";
+    setup.car.model = "296 GT3";
+    auto bytes = adapter->orsf_to_native(setup);
+
+    REQUIRE(registry.detect(ByteSpan(bytes)) == adapter);
+    REQUIRE(adapter->sniff(ByteSpan(std::string_view("  {\"schema\": 1}"))));
+    REQUIRE_FALSE(adapter->sniff(ByteSpan(std::string_view("[1, 2]"))));
+}
@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace orsf;
+
+namespace {
+
+/// Value whose fields always agree unless it was freed or torn
+struct Pair {
+    explicit Pair(int value) : first(value), second(value) {}
+    ~Pair() { first = -1; second = -2; }
+
+    int first;
+    int second;
+};
+
+} // namespace
+
+TEST_CASE("Published hands out the current value", "[epoch]") {
+    Published<Pair> published;
+    REQUIRE(published.load() == nullptr);
+    REQUIRE_FALSE(Published<Pair>::Reader(published));
+
+    auto first = std::make_shared<const Pair>(1);
+    std::weak_ptr<const Pair> watch = first;
+    published.store(std::move(first));
+    {
+        Published<Pair>::Reader reader(published);
+        REQUIRE(reader);
+        REQUIRE(reader->first == 1);
+        REQUIRE(reader.share() == published.load());
+    }
+
+    // The previous value is released by the store that replaces it
+    published.store(std::make_shared<const Pair>(2));
+    REQUIRE(watch.expired());
+    REQUIRE(published.load()->first == 2);
+
+    published.store(nullptr);
+    REQUIRE(published.load() == nullptr);
+}
+
+TEST_CASE("Published readers never see a freed value", "[epoch]") {
+    ReaderEpochs epochs;
+    Published<Pair> published(epochs);
+    published.store(std::make_shared<const Pair>(0));
+
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                Published<Pair>::Reader reader(published);
+                if (reader->first < 0 || reader->first != reader->second) ++torn;
+            }
+        });
+    }
+
+    for (int value = 1; value <= 200; ++value) {
+        published.store(std::make_shared<const Pair>(value));
+    }
+    done = true;
+    for (auto& reader : readers) reader.join();
+
+    REQUIRE(torn == 0);
+    REQUIRE(published.load()->first == 200);
+}
@@ -0,0 +1,223 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+using namespace orsf;
+
+TEST_CASE("ThreadPoolExecutor runs every index once", "[executor]") {
+    ThreadPoolExecutor executor(4);
+    REQUIRE(executor.concurrency() == 4);
+
+    for (size_t count : {size_t(0), size_t(1), size_t(3), size_t(1000)}) {
+        std::vector<std::atomic<int>> hits(count);
+        std::atomic<bool> bad_worker{false};
+
+        executor.parallel_for(count, [&](size_t index, size_t worker) {
+            if (worker >= executor.concurrency()) bad_worker = true;
+            ++hits[index];
+        });
+
+        REQUIRE_FALSE(bad_worker);
+        for (const auto& hit : hits) {
+            REQUIRE(hit == 1);
+        }
+    }
+}
+
+TEST_CASE("ThreadPoolExecutor balances uneven work", "[executor]") {
+    ThreadPoolExecutor executor(3);
+    std::atomic<size_t> total{0};
+
+    // All the expensive items sit in the first worker's slice
+    executor.parallel_for(300, [&](size_t index, size_t) {
+        size_t spins = index < 100 ? 20000 : 1;
+        volatile size_t sink = 0;
+        for (size_t i = 0; i < spins; ++i) sink = sink + i;
+        total += index;
+    });
+
+    REQUIRE(total == 300 * 299 / 2);
+}
+
+TEST_CASE("ThreadPoolExecutor propagates exceptions", "[executor]") {
+    ThreadPoolExecutor executor(2);
+
+    REQUIRE_THROWS_AS(
+        executor.parallel_for(100, [](size_t index, size_t) {
+            if (index == 42) throw std::runtime_error("boom");
+        }),
+        std::runtime_error);
+
+    // The pool stays usable
+    std::atomic<int> count{0};
+    executor.parallel_for(10, [&](size_t, size_t) { ++count; });
+    REQUIRE(count == 10);
+}
+
+TEST_CASE("ThreadPoolExecutor runs loops from different threads side by side", "[executor]") {
+    ThreadPoolExecutor executor(4);
+
+    // Each loop blocks until the other one has started, so they must overlap
+    std::atomic<int> started{0};
+    std::atomic<bool> overlapped[2] = {{false}, {false}};
+    auto loop = [&](int id) {
+        std::vector<std::atomic<int>> hits(64);
+        std::atomic<bool> bad_worker{false};
+        executor.parallel_for(hits.size(), [&](size_t index, size_t worker) {
+            if (worker >= executor.concurrency()) bad_worker = true;
+            if (index == 0) {
+                ++started;
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                while (started.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+                    std::this_thread::yield();
+                }
+                overlapped[id] = started.load() == 2;
+            }
+            ++hits[index];
+        });
+        REQUIRE_FALSE(bad_worker);
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& h) { return h == 1; }));
+    };
+
+    std::thread other(loop, 1);
+    loop(0);
+    other.join();
+
+    REQUIRE(overlapped[0]);
+    REQUIRE(overlapped[1]);
+}
+
+TEST_CASE("Nested parallel_for runs inline", "[executor]") {
+    ThreadPoolExecutor executor(2);
+    std::atomic<int> count{0};
+
+    executor.parallel_for(4, [&](size_t, size_t) {
+        executor.parallel_for(5, [&](size_t, size_t) { ++count; });
+    });
+
+    REQUIRE(count == 20);
+}
+
+TEST_CASE("InlineExecutor runs in order on the caller", "[executor]") {
+    InlineExecutor executor;
+    std::vector<size_t> order;
+    executor.parallel_for(5, [&](size_t index, size_t worker) {
+        REQUIRE(worker == 0);
+        order.push_back(index);
+    });
+    REQUIRE(order == std::vector<size_t>{0, 1, 2, 3, 4});
+}
+
+TEST_CASE("parallel_reduce folds per-worker partials", "[executor]") {
+    ThreadPoolExecutor pool(3);
+    InlineExecutor inline_executor;
+
+    for (Executor* executor : {static_cast<Executor*>(&pool), static_cast<Executor*>(&inline_executor)}) {
+        uint64_t sum = parallel_reduce(*executor, 1000, uint64_t(0),
+            [](size_t index) { return static_cast<uint64_t>(index); }, std::plus<uint64_t>());
+        REQUIRE(sum == 1000 * 999 / 2);
+
+        std::vector<size_t> merged = parallel_reduce(*executor, 50, std::vector<size_t>{},
+            [](size_t index) { return std::vector<size_t>{index}; },
+            [](std::vector<size_t> a, std::vector<size_t> b) {
+                a.insert(a.end(), b.begin(), b.end());
+                return a;
+            });
+        std::sort(merged.begin(), merged.end());
+        REQUIRE(merged.size() == 50);
+        REQUIRE(merged.back() == 49);
+
+        REQUIRE(parallel_reduce(*executor, 0, 0, [](size_t) { return 1; }, std::plus<int>()) == 0);
+    }
+}
+
+TEST_CASE("TaskGroup runs queued and spawned tasks", "[executor]") {
+    ThreadPoolExecutor pool(3);
+    TaskGroup group(pool);
+    std::atomic<int> count{0};
+
+    for (int i = 0; i < 10; ++i) {
+        group.run([&] {
+            ++count;
+            group.run([&] { count += 100; });
+        });
+    }
+    group.wait();
+    REQUIRE(count == 1010);
+
+    // A group is reusable once drained
+    group.run([&] { ++count; });
+    group.wait();
+    REQUIRE(count == 1011);
+}
+
+TEST_CASE("TaskGroup cancels on request and on exceptions", "[executor]") {
+    ThreadPoolExecutor pool(2);
+
+    TaskGroup cancelled(pool);
+    std::atomic<int> ran{0};
+    cancelled.run([&] {
+        ++ran;
+        cancelled.cancel();
+        cancelled.run([&] { ++ran; });
+    });
+    cancelled.wait();
+    REQUIRE(ran == 1);
+    REQUIRE(cancelled.is_cancelled());
+
+    TaskGroup failing(pool);
+    std::atomic<int> spawned{0};
+    failing.run([&] {
+        failing.run([&] { ++spawned; });
+        throw std::runtime_error("task failed");
+    });
+    REQUIRE_THROWS_AS(failing.wait(), std::runtime_error);
+    REQUIRE(spawned == 0);
+    REQUIRE(failing.is_cancelled());
+}
+
+TEST_CASE("Batch APIs use the injected default executor", "[executor]") {
+    auto shared = default_executor();
+    REQUIRE(shared != nullptr);
+    REQUIRE(default_executor() == shared);
+
+    // Counts the loops batch APIs run on it
+    struct CountingExecutor : InlineExecutor {
+        std::atomic<int> loops{0};
+        void parallel_for(size_t count, const Body& body) override {
+            ++loops;
+            InlineExecutor::parallel_for(count, body);
+        }
+    };
+    auto counting = std::make_shared<CountingExecutor>();
+    set_default_executor(counting);
+
+    ORSF setup;
+    setup.metadata.id = "executor";
+    setup.metadata.name = "Executor";
+    setup.metadata.created_at = "2024-01-01T00:00:00Z";
+    setup.car.make = "Audi";
+    setup.car.model = "R8 LMS";
+    std::vector<ORSF> setups(3, setup);
+
+    auto parsed = parse_batch({setup.to_json_string(), "{"});
+    auto findings = validate_batch(setups);
+    auto converted = convert_batch(setups, {std::make_shared<ExampleAdapter>()});
+    REQUIRE(counting->loops >= 3);
+
+    set_default_executor(nullptr);
+    REQUIRE(default_executor() != counting);
+
+    REQUIRE(parsed.size() == 2);
+    REQUIRE(parsed[0].ok());
+    REQUIRE(parsed[0].setup.metadata.id == "executor");
+    REQUIRE_FALSE(parsed[1].ok());
+    REQUIRE(findings.size() == 3);
+    REQUIRE(findings[0].empty() == Validator::validate(setup).empty());
+    REQUIRE(converted.error_count() == 0);
+}
@@ -0,0 +1,170 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <filesystem>
+#include <fstream>
+#include <set>
+
+using namespace orsf;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Scratch directory removed at the end of the test
+struct IoDirectory {
+    fs::path path;
+
+    explicit IoDirectory(const std::string& name)
+        : path(fs::temp_directory_path() / ("orsf_test_file_io_" + name)) {
+        fs::remove_all(path);
+        fs::create_directories(path);
+    }
+
+    ~IoDirectory() {
+        std::error_code ignored;
+        fs::remove_all(path, ignored);
+    }
+
+    std::string file(const std::string& name) const { return (path / name).string(); }
+};
+
+std::vector<IoBackend> available_backends() {
+    std::vector<IoBackend> backends{IoBackend::ThreadPool};
+    if (io_uring_available()) backends.push_back(IoBackend::IoUring);
+    return backends;
+}
+
+std::string contents_of(size_t index) {
+    // Sizes from empty to several reads' worth at the kernel's usual limits
+    return std::string(index * 997 % 70000, static_cast<char>('a' + index % 26));
+}
+
+} // namespace
+
+TEST_CASE("AsyncFileWriter and AsyncFileReader round-trip many files", "[file_io]") {
+    for (IoBackend backend : available_backends()) {
+        IoDirectory directory(io_backend_name(backend));
+        AsyncIoOptions options;
+        options.backend = backend;
+        options.queue_depth = 8;
+        options.threads = 3;
+
+        std::vector<std::string> texts;
+        std::vector<FileWrite> writes;
+        std::vector<std::string> paths;
+        for (size_t i = 0; i < 50; ++i) {
+            texts.push_back(contents_of(i));
+            paths.push_back(directory.file("file_" + std::to_string(i) + ".json"));
+        }
+        for (size_t i = 0; i < texts.size(); ++i) {
+            writes.push_back({paths[i], ByteSpan(std::string_view(texts[i]))});
+        }
+
+        AsyncFileWriter writer(options);
+        REQUIRE(writer.backend() == backend);
+        std::set<size_t> written;
+        size_t write_errors = 0;
+        REQUIRE(writer.write_files(writes, [&](size_t index, const std::string& error) {
+            written.insert(index);
+            if (!error.empty()) ++write_errors;
+        }) == 0);
+        REQUIRE(written.size() == writes.size());
+        REQUIRE(write_errors == 0);
+        REQUIRE(fs::file_size(paths[7]) == texts[7].size());
+
+        AsyncFileReader reader(options);
+        REQUIRE(reader.backend() == backend);
+        std::vector<std::string> read(paths.size());
+        std::set<size_t> seen;
+        size_t read_errors = 0;
+        reader.read_files(paths, [&](FileReadResult& file) {
+            seen.insert(file.index);
+            if (!file.ok() || file.path != paths[file.index]) ++read_errors;
+            read[file.index] = std::string(file.data.span().as_chars());
+        });
+        REQUIRE(seen.size() == paths.size());
+        REQUIRE(read_errors == 0);
+        REQUIRE(read == texts);
+    }
+}
+
+TEST_CASE("AsyncFileReader reports per-file errors and callback exceptions", "[file_io]") {
+    IoDirectory directory("errors");
+    std::ofstream(directory.file("present.json")) << "{}";
+
+    for (IoBackend backend : available_backends()) {
+        AsyncIoOptions options;
+        options.backend = backend;
+        AsyncFileReader reader(options);
+
+        std::vector<std::string> paths = {directory.file("present.json"), directory.file("missing.json"),
+                                          directory.path.string()};
+        std::vector<std::string> errors(paths.size());
+        reader.read_files(paths, [&](FileReadResult& file) { errors[file.index] = file.error; });
+        REQUIRE(errors[0].empty());
+        REQUIRE(errors[1].find("missing.json") != std::string::npos);
+        REQUIRE_FALSE(errors[2].empty());
+
+        std::string message;
+        try {
+            reader.read_files(paths, [](FileReadResult& file) {
+                if (file.index == 0) throw std::runtime_error("callback failed");
+            });
+        } catch (const std::runtime_error& e) {
+            message = e.what();
+        }
+        REQUIRE(message == "callback failed");
+
+        std::vector<std::string> many(200, directory.file("present.json"));
+        size_t calls = 0;
+        reader.read_files(many, [&](FileReadResult&) {
+            if (++calls == 3) reader.cancel();
+        });
+        REQUIRE(calls >= 3);
+        REQUIRE(calls < many.size());
+
+        AsyncFileWriter writer(options);
+        std::string failure;
+        std::vector<FileWrite> writes = {{directory.file("no_such_dir/out.json"), ByteSpan(std::string_view("{}"))}};
+        REQUIRE(writer.write_files(writes, [&](size_t, const std::string& error) { failure = error; }) == 1);
+        REQUIRE(failure.find("out.json") != std::string::npos);
+    }
+
+    REQUIRE(std::string(io_backend_name(IoBackend::IoUring)) == "io_uring");
+    if (!io_uring_available()) {
+        AsyncIoOptions uring;
+        uring.backend = IoBackend::IoUring;
+        REQUIRE_THROWS_AS(AsyncFileReader(uring), std::runtime_error);
+    }
+}
+
+TEST_CASE("ImportPipeline reads through AsyncFileReader", "[file_io][pipeline]") {
+    IoDirectory directory("pipeline");
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < 30; ++i) {
+        ORSF setup;
+        setup.metadata.id = "async-" + std::to_string(i);
+        setup.metadata.name = "Async " + std::to_string(i);
+        setup.metadata.created_at = "2024-01-01T00:00:00Z";
+        setup.car.make = "BMW";
+        setup.car.model = "M4 GT3";
+        paths.push_back(directory.file("setup_" + std::to_string(i) + ".json"));
+        std::ofstream(paths.back(), std::ios::binary) << setup.to_json_string();
+    }
+    paths.push_back(directory.file("missing.json"));
+
+    ImportOptions options;
+    options.async_io = true;
+    options.io.queue_depth = 4;
+    options.queue_capacity = 4;
+    std::atomic<size_t> matched{0};
+    options.sink = [&](ImportItem& item) {
+        if (item.ok() && item.setup.metadata.id == "async-" + std::to_string(item.index)) matched.fetch_add(1);
+    };
+
+    ImportStats stats = ImportPipeline(options).run(paths);
+    REQUIRE(stats.items == paths.size());
+    REQUIRE(stats.failed == 1);
+    REQUIRE(matched.load() == 30);
+    REQUIRE(stats.stages[0].workers == 1);
+    REQUIRE(stats.stages[0].items == paths.size());
+}
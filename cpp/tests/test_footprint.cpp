@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include "alloc_hooks.hpp"
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_rich_setup() {
+    ORSF setup;
+    setup.metadata.id = "footprint-setup";
+    setup.metadata.name = "Spa-Francorchamps endurance race baseline";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.metadata.notes = std::string(200, 'n');
+    setup.metadata.tags = std::vector<std::string>{"race", "a tag long enough to leave the string object"};
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R (992) Endurance Spec";
+
+    Gearing gearing;
+    gearing.gear_ratios = std::vector<double>{3.1, 2.3, 1.8, 1.5, 1.25, 1.08};
+    setup.setup.gearing = gearing;
+
+    Strategy strategy;
+    strategy.notes = std::string(64, 's');
+    strategy.custom["stint_plan"] = {{"laps", json::array({22, 22, 21})}, {"driver", "second driver name"}};
+    strategy.custom["fuel"] = 95.5;
+    setup.setup.strategy = strategy;
+
+    std::map<std::string, json> compat;
+    compat["iracing"] = {{"Param0001", 1.5}, {"Param0002", "Soft_compound_very_long_value"}};
+    setup.compat = compat;
+    return setup;
+}
+
+} // namespace
+
+TEST_CASE("memory_footprint reports heap bytes per section", "[footprint]") {
+    ORSF empty;
+    MemoryFootprint base = memory_footprint(empty);
+    REQUIRE(base.inline_bytes == sizeof(ORSF));
+    REQUIRE(base.setup.allocations == 0);
+    REQUIRE(base.strategy.allocations == 0);
+    REQUIRE(base.compat.allocations == 0);
+
+    ORSF setup = create_rich_setup();
+    MemoryFootprint footprint = memory_footprint(setup);
+    REQUIRE(footprint.metadata.heap_bytes >= 200 + 40);
+    REQUIRE(footprint.setup.heap_bytes >= 6 * sizeof(double));
+    REQUIRE(footprint.strategy.allocations > 0);
+    REQUIRE(footprint.compat.allocations > 0);
+    REQUIRE(footprint.context.allocations == 0);
+    REQUIRE(footprint.total_bytes() == footprint.inline_bytes + footprint.heap().heap_bytes);
+
+    json j = footprint.to_json();
+    REQUIRE(j["sections"]["compat"]["allocations"] == footprint.compat.allocations);
+    REQUIRE(j["total_bytes"] == footprint.total_bytes());
+
+    // Growing a section shows up in that section only
+    setup.compat->at("iracing")["Param0003"] = json::array({1, 2, 3});
+    MemoryFootprint grown = memory_footprint(setup);
+    REQUIRE(grown.compat.heap_bytes > footprint.compat.heap_bytes);
+    REQUIRE(grown.metadata.heap_bytes == footprint.metadata.heap_bytes);
+}
+
+TEST_CASE("memory_footprint matches the allocations of a copy", "[footprint]") {
+    ORSF setup = create_rich_setup();
+
+    // A copy allocates exactly the blocks it holds, sized to fit
+    AllocationCounter counter;
+    ORSF copy = setup;
+    AllocationCount copied = counter.count();
+
+    MemoryFootprint footprint = memory_footprint(copy);
+    REQUIRE(footprint.heap().allocations == copied.allocations);
+    REQUIRE(footprint.heap().heap_bytes == copied.bytes);
+}
+
+TEST_CASE("memory_footprint walks JSON values", "[footprint]") {
+    REQUIRE(memory_footprint(json(42)).allocations == 0);
+    REQUIRE(memory_footprint(json(nullptr)).allocations == 0);
+
+    json value = {{"a", json::array({1, 2})}, {"b", "text"}};
+    AllocationCounter counter;
+    json copy = value;
+    REQUIRE(memory_footprint(copy).allocations == counter.count().allocations);
+}
@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <filesystem>
+#include <sstream>
+
+using namespace orsf;
+
+namespace {
+
+bool has_errors(const ORSF& orsf) {
+    for (const auto& error : Validator::validate(orsf)) {
+        if (error.severity == ValidationSeverity::Error) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_CASE("SetupGenerator is deterministic", "[generator]") {
+    GeneratorOptions options;
+    options.seed = 42;
+    SetupGenerator first(options);
+    SetupGenerator second(options);
+
+    for (uint64_t i = 0; i < 50; ++i) {
+        REQUIRE(first.generate(i).to_json_string() == second.generate(i).to_json_string());
+    }
+
+    // Setups do not depend on generation order
+    auto range = first.generate_range(10, 5);
+    REQUIRE(range[3].to_json_string() == first.generate(13).to_json_string());
+
+    options.seed = 43;
+    REQUIRE(SetupGenerator(options).generate(0).to_json_string() != first.generate(0).to_json_string());
+}
+
+TEST_CASE("SetupGenerator injects errors at the configured rate", "[generator]") {
+    GeneratorOptions options;
+    options.seed = 7;
+    options.error_rate = 0.2;
+    SetupGenerator generator(options);
+
+    size_t invalid = 0;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        ORSF setup = generator.generate(i);
+        REQUIRE(has_errors(setup) == generator.is_invalid(i));
+        if (generator.is_invalid(i)) ++invalid;
+    }
+    REQUIRE(invalid > 150);
+    REQUIRE(invalid < 250);
+
+    options.error_rate = 0.0;
+    SetupGenerator clean(options);
+    for (uint64_t i = 0; i < 200; ++i) {
+        REQUIRE_FALSE(has_errors(clean.generate(i)));
+    }
+}
+
+TEST_CASE("SetupGenerator controls corpus shape", "[generator]") {
+    GeneratorOptions dense;
+    dense.dense_share = 1.0;
+    dense.dense_fill_rate = 1.0;
+    dense.strategy_rate = 1.0;
+    dense.compat_rate = 1.0;
+    dense.min_gears = 6;
+    dense.max_gears = 6;
+    dense.error_rate = 0.0;
+
+    ORSF full = SetupGenerator(dense).generate(0);
+    REQUIRE(full.context.has_value());
+    REQUIRE(full.setup.suspension->front_left.has_value());
+    REQUIRE(full.setup.suspension->rear_right->damper_rebound_fast_n_s_m.has_value());
+    REQUIRE(full.setup.gearing->gear_ratios->size() == 6);
+    REQUIRE_FALSE(full.setup.strategy->custom.empty());
+    REQUIRE(full.compat.has_value());
+    REQUIRE(MappingEngine::flatten_orsf(full).size() > 80);
+
+    GeneratorOptions sparse = dense;
+    sparse.dense_share = 0.0;
+    sparse.sparse_fill_rate = 0.0;
+    sparse.context_rate = 0.0;
+    sparse.strategy_rate = 0.0;
+    sparse.compat_rate = 0.0;
+
+    ORSF empty = SetupGenerator(sparse).generate(0);
+    REQUIRE_FALSE(empty.context.has_value());
+    REQUIRE_FALSE(empty.setup.aero.has_value());
+    REQUIRE_FALSE(empty.compat.has_value());
+    REQUIRE(MappingEngine::flatten_orsf(empty).empty());
+    REQUIRE_FALSE(has_errors(empty));
+}
+
+TEST_CASE("SetupGenerator output round trips through JSON", "[generator]") {
+    GeneratorOptions options;
+    options.compat_rate = 0.5;
+    options.strategy_rate = 0.5;
+    SetupGenerator generator(options);
+
+    std::string ndjson;
+    StringSink sink(ndjson);
+    generator.write_ndjson(100, 20, sink);
+
+    std::istringstream lines(ndjson);
+    std::string line;
+    uint64_t index = 100;
+    while (std::getline(lines, line)) {
+        ORSF parsed = ORSF::from_json(line);
+        REQUIRE(parsed.to_json_string() == generator.generate(index).to_json_string());
+        REQUIRE(StreamingValidator::validate(line).is_valid() == !generator.is_invalid(index));
+        ++index;
+    }
+    REQUIRE(index == 120);
+}
+
+TEST_CASE("SetupGenerator writes setup files", "[generator]") {
+    auto directory = std::filesystem::temp_directory_path() / "orsf_test_generator";
+    std::filesystem::remove_all(directory);
+
+    SetupGenerator generator;
+    generator.write_files(directory.string(), 5, 3);
+
+    REQUIRE(std::filesystem::exists(directory / "setup_00000005.json"));
+    REQUIRE(std::filesystem::exists(directory / "setup_00000007.json"));
+    REQUIRE_FALSE(std::filesystem::exists(directory / "setup_00000008.json"));
+
+    std::filesystem::remove_all(directory);
+}
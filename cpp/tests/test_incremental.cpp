@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_editor_setup() {
+    ORSF setup;
+    setup.metadata.id = "editor-1";
+    setup.metadata.name = "Editor Setup";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.context = Context{};
+    setup.context->ambient_temp_c = 20.0;
+    setup.context->track_temp_c = 30.0;
+    setup.setup.tires = Tires{};
+    setup.setup.tires->pressure_fl_kpa = 170.0;
+    setup.setup.suspension = Suspension{};
+    setup.setup.suspension->front_left = CornerSuspension{};
+    setup.setup.suspension->front_left->camber_deg = -3.0;
+    return setup;
+}
+
+void require_same_errors(const std::vector<ValidationError>& actual, const ORSF& orsf) {
+    auto expected = Validator::validate(orsf);
+    REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE(actual[i].to_string() == expected[i].to_string());
+    }
+}
+
+} // namespace
+
+TEST_CASE("IncrementalValidator matches full validation", "[incremental]") {
+    ORSF setup = create_editor_setup();
+    IncrementalValidator validator;
+
+    require_same_errors(validator.validate(setup), setup);
+    REQUIRE(validator.last_run_count() == static_cast<size_t>(RuleGroup::Count));
+}
+
+TEST_CASE("IncrementalValidator re-runs only affected groups", "[incremental]") {
+    ORSF setup = create_editor_setup();
+    IncrementalValidator validator;
+    validator.validate(setup);
+
+    SECTION("Tire pressure edit") {
+        setup.setup.tires->pressure_fl_kpa = 500.0;
+        const auto& errors = validator.revalidate(setup, std::vector<std::string>{"setup.tires.pressure_fl_kpa"});
+        REQUIRE(validator.last_run_count() == 1);
+        require_same_errors(errors, setup);
+
+        setup.setup.tires->pressure_fl_kpa = 170.0;
+        require_same_errors(
+            validator.revalidate(setup, std::vector<std::string>{"setup.tires.pressure_fl_kpa"}), setup);
+        REQUIRE(validator.errors().empty());
+    }
+
+    SECTION("Corner edit only touches that corner") {
+        setup.setup.suspension->front_left->camber_deg = -15.0;
+        const auto& errors = validator.revalidate(
+            setup, std::vector<std::string>{"setup.suspension.front_left.camber_deg"});
+        REQUIRE(validator.last_run_count() == 1);
+        require_same_errors(errors, setup);
+    }
+
+    SECTION("Fields without rules re-run nothing") {
+        setup.setup.aero = Aerodynamics{};
+        setup.setup.aero->front_wing = 4.0;
+        validator.revalidate(setup, std::vector<std::string>{"compat.iracing"});
+        REQUIRE(validator.last_run_count() == 0);
+    }
+}
+
+TEST_CASE("IncrementalValidator tracks cross-field dependencies", "[incremental]") {
+    ORSF setup = create_editor_setup();
+    IncrementalValidator validator;
+    validator.validate(setup);
+
+    setup.context->track_temp_c = 5.0;
+    const auto& errors = validator.revalidate(setup, std::vector<std::string>{"context.track_temp_c"});
+    REQUIRE(validator.last_run_count() == 2);
+    require_same_errors(errors, setup);
+
+    auto groups = IncrementalValidator::groups_for_field("context.ambient_temp_c");
+    REQUIRE(groups == std::vector<RuleGroup>{RuleGroup::Context, RuleGroup::CrossField});
+}
+
+TEST_CASE("IncrementalValidator handles section-level edits", "[incremental]") {
+    auto groups = IncrementalValidator::groups_for_field("setup.suspension");
+    REQUIRE(groups.size() == 5);
+
+    ORSF setup = create_editor_setup();
+    IncrementalValidator validator;
+    validator.validate(setup);
+
+    setup.setup.suspension.reset();
+    setup.setup.gearing = Gearing{};
+    setup.setup.gearing->gear_ratios = std::vector<double>{3.0, -1.0};
+
+    const auto& errors = validator.revalidate(
+        setup, std::vector<std::string>{"setup.suspension", "setup.gearing.gear_ratios[1]"});
+    REQUIRE(validator.last_run_count() == 6);
+    require_same_errors(errors, setup);
+}
+
+TEST_CASE("IncrementalValidator rejects RuleGroup::Count", "[incremental]") {
+    ORSF setup = create_editor_setup();
+    IncrementalValidator validator;
+    validator.validate(setup);
+
+    std::vector<RuleGroup> groups = {RuleGroup::Tires, RuleGroup::Count};
+    REQUIRE_THROWS_AS(validator.revalidate(setup, groups), std::runtime_error);
+    require_same_errors(validator.errors(), setup);
+}
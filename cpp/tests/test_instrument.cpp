@@ -0,0 +1,221 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace orsf;
+
+namespace {
+
+class RecordingSink : public StageSink {
+public:
+    void on_stage(const StageEvent& event) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.push_back(event);
+    }
+
+    std::vector<StageEvent> events() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return events_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<StageEvent> events_;
+};
+
+/// Counts calls that arrive after remove_sink() returned
+class RetiringSink : public StageSink {
+public:
+    void on_stage(const StageEvent&) override {
+        if (removed.load(std::memory_order_acquire)) ++late;
+    }
+
+    std::atomic<bool> removed{false};
+    std::atomic<int> late{0};
+};
+
+ORSF create_instrumented_setup() {
+    ORSF setup;
+    setup.metadata.id = "instrumented";
+    setup.metadata.name = "Instrumented";
+    setup.metadata.created_at = "2024-01-01T00:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.setup.aero = Aerodynamics{};
+    setup.setup.aero->front_wing = 5.0;
+    return setup;
+}
+
+} // namespace
+
+TEST_CASE("ScopedStage records calls, bytes and errors", "[instrument]") {
+    Instrumentation::reset();
+
+    {
+        ScopedStage stage(Stage::Parse);
+        stage.add_bytes(100);
+        stage.add_errors(2);
+    }
+    {
+        ScopedStage stage(Stage::Parse);
+        stage.add_bytes(20);
+    }
+
+    StageSnapshot totals = Instrumentation::snapshot();
+    REQUIRE(totals[Stage::Parse].calls == 2);
+    REQUIRE(totals[Stage::Parse].bytes == 120);
+    REQUIRE(totals[Stage::Parse].errors == 2);
+    REQUIRE(totals[Stage::Serialize].calls == 0);
+
+    json j = totals.to_json();
+    REQUIRE(j["parse"]["calls"] == 2);
+    REQUIRE(j.contains("adapter_encode"));
+    REQUIRE(std::string(stage_name(Stage::MapToNative)) == "map_to_native");
+
+    Instrumentation::reset();
+    REQUIRE(Instrumentation::snapshot()[Stage::Parse].calls == 0);
+}
+
+TEST_CASE("ScopedStage counts exceptions and re-entry once", "[instrument]") {
+    Instrumentation::reset();
+
+    REQUIRE_THROWS_AS([] {
+        ScopedStage stage(Stage::Validate);
+        throw std::runtime_error("failed");
+    }(), std::runtime_error);
+
+    {
+        ScopedStage outer(Stage::AdapterEncode);
+        ScopedStage inner(Stage::AdapterEncode);
+        inner.add_bytes(10);  // inert: the stage is already running on this thread
+        ScopedStage nested(Stage::LookupTable);
+    }
+
+    StageSnapshot totals = Instrumentation::snapshot();
+    REQUIRE(totals[Stage::Validate].calls == 1);
+    REQUIRE(totals[Stage::Validate].errors == 1);
+    REQUIRE(totals[Stage::AdapterEncode].calls == 1);
+    REQUIRE(totals[Stage::AdapterEncode].bytes == 0);
+    REQUIRE(totals[Stage::LookupTable].calls == 1);
+}
+
+TEST_CASE("Instrumentation aggregates threads, including exited ones", "[instrument]") {
+    Instrumentation::reset();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 250; ++i) {
+                ScopedStage stage(Stage::Flatten);
+                stage.add_bytes(1);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    { ScopedStage stage(Stage::Flatten); }
+
+    StageSnapshot totals = Instrumentation::snapshot();
+    REQUIRE(totals[Stage::Flatten].calls == 1001);
+    REQUIRE(totals[Stage::Flatten].bytes == 1000);
+}
+
+TEST_CASE("Instrumentation counts noted allocations per stage", "[instrument]") {
+    Instrumentation::reset();
+    uint64_t before = Instrumentation::thread_allocations();
+
+    Instrumentation::note_allocation();  // outside any stage
+    {
+        ScopedStage stage(Stage::Serialize);
+        Instrumentation::note_allocation(3);
+    }
+
+    REQUIRE(Instrumentation::thread_allocations() == before + 4);
+    REQUIRE(Instrumentation::snapshot()[Stage::Serialize].allocations == 3);
+}
+
+TEST_CASE("Instrumentation sinks receive stage events", "[instrument]") {
+    auto sink = std::make_shared<RecordingSink>();
+    Instrumentation::add_sink(sink);
+    Instrumentation::add_sink(sink);  // registered once
+
+    {
+        ScopedStage stage(Stage::MapToOrsf);
+        stage.add_bytes(7);
+    }
+    Instrumentation::remove_sink(sink);
+    { ScopedStage stage(Stage::MapToOrsf); }
+
+    auto events = sink->events();
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].stage == Stage::MapToOrsf);
+    REQUIRE(events[0].bytes == 7);
+    REQUIRE(events[0].duration.count() >= 0);
+}
+
+TEST_CASE("Instrumentation sinks receive nothing after remove_sink returns", "[instrument]") {
+    std::atomic<bool> done{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                ScopedStage stage(Stage::LookupTable);
+            }
+        });
+    }
+
+    int late = 0;
+    for (int round = 0; round < 100; ++round) {
+        auto sink = std::make_shared<RetiringSink>();
+        Instrumentation::add_sink(sink);
+        std::this_thread::yield();
+        Instrumentation::remove_sink(sink);
+        sink->removed.store(true, std::memory_order_release);
+        std::this_thread::yield();
+        late += sink->late.load();
+    }
+    done = true;
+    for (auto& worker : workers) worker.join();
+
+    REQUIRE(late == 0);
+}
+
+TEST_CASE("Library stages follow ORSF_ENABLE_INSTRUMENTATION", "[instrument]") {
+    ORSF setup = create_instrumented_setup();
+    ExampleAdapter adapter;
+    std::vector<FieldMapping> mappings = {FieldMapping("setup.aero.front_wing", "FrontWing")};
+
+    Instrumentation::reset();
+    std::string text = setup.to_json_string();
+    ORSF parsed = ORSF::from_json(text);
+    Validator::validate(parsed);
+    FlatSetup native = MappingEngine::map_to_native(parsed, mappings);
+    MappingEngine::map_to_orsf(native, mappings, parsed);
+    auto bytes = adapter.orsf_to_native(parsed);
+    adapter.native_to_orsf(bytes);
+    REQUIRE_THROWS(ORSF::from_json(std::string("{not json")));
+
+    StageSnapshot totals = Instrumentation::snapshot();
+#ifdef ORSF_ENABLE_INSTRUMENTATION
+    REQUIRE(Instrumentation::compiled_in());
+    REQUIRE(totals[Stage::Serialize].calls >= 1);
+    REQUIRE(totals[Stage::Parse].calls >= 2);
+    REQUIRE(totals[Stage::Parse].errors >= 1);
+    REQUIRE(totals[Stage::Parse].bytes >= text.size());
+    REQUIRE(totals[Stage::Validate].calls == 1);
+    REQUIRE(totals[Stage::MapToNative].calls == 1);
+    REQUIRE(totals[Stage::MapToOrsf].calls == 1);
+    REQUIRE(totals[Stage::AdapterEncode].calls == 1);
+    REQUIRE(totals[Stage::AdapterEncode].bytes == bytes.size());
+    REQUIRE(totals[Stage::AdapterDecode].calls == 1);
+#else
+    REQUIRE_FALSE(Instrumentation::compiled_in());
+    for (const auto& counters : totals.stages) {
+        REQUIRE(counters.calls == 0);
+    }
+#endif
+}
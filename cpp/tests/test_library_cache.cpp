@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <filesystem>
+#include <fstream>
+
+using namespace orsf;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Setup library removed at the end of the test
+struct LibraryDirectory {
+    fs::path path;
+
+    explicit LibraryDirectory(const std::string& name)
+        : path(fs::temp_directory_path() / ("orsf_test_library_" + name)) {
+        fs::remove_all(path);
+        fs::create_directories(path / "setups");
+    }
+
+    ~LibraryDirectory() {
+        std::error_code ignored;
+        fs::remove_all(path, ignored);
+    }
+
+    std::string cache_file() const { return (path / "library.orsfcache").string(); }
+
+    /// Write a file dated an hour back, so refresh trusts its mtime
+    std::string write(const std::string& name, const std::string& contents, int minutes_ago = 60) {
+        fs::path file = path / "setups" / name;
+        std::ofstream(file, std::ios::binary) << contents;
+        fs::last_write_time(file, fs::file_time_type::clock::now() - std::chrono::minutes(minutes_ago));
+        return file.string();
+    }
+};
+
+ORSF create_library_setup(size_t index) {
+    ORSF setup;
+    setup.metadata.id = "library-" + std::to_string(index);
+    setup.metadata.name = "Library " + std::to_string(index);
+    setup.metadata.created_at = "2024-01-01T00:00:00Z";
+    setup.metadata.tags = std::vector<std::string>{"race", "dry"};
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.context = Context{};
+    setup.context->track = "Spa";
+    return setup;
+}
+
+} // namespace
+
+TEST_CASE("LibraryCache parses once and reuses unchanged files across restarts", "[library_cache]") {
+    LibraryDirectory directory("restart");
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < 12; ++i) {
+        paths.push_back(directory.write("setup_" + std::to_string(i) + ".json", create_library_setup(i).to_json_string()));
+    }
+    paths.push_back(directory.write("broken.json", "{\"metadata\": "));
+
+    {
+        LibraryCache cache(directory.cache_file());
+        REQUIRE_FALSE(cache.load());
+        LibraryRefreshStats stats = cache.refresh(paths);
+        REQUIRE(stats.files == 13);
+        REQUIRE(stats.parsed == 13);
+        REQUIRE(stats.reused == 0);
+        REQUIRE(stats.failed == 1);
+        REQUIRE(cache.entries().size() == 13);
+        cache.save();
+    }
+
+    LibraryCache cache(directory.cache_file());
+    REQUIRE(cache.load());
+    REQUIRE(cache.entries().size() == 13);
+
+    LibraryRefreshStats stats = cache.refresh(paths);
+    REQUIRE(stats.reused == 13);
+    REQUIRE(stats.parsed == 0);
+    REQUIRE(stats.to_json()["reused"] == 13);
+
+    const LibraryCacheEntry* entry = cache.find(paths[3]);
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->ok());
+    REQUIRE(entry->size == fs::file_size(paths[3]));
+    REQUIRE(entry->listing == SetupListing::from_setup(create_library_setup(3)));
+    REQUIRE(entry->listing.car == "Porsche 911 GT3 R");
+    REQUIRE(entry->listing.track == "Spa");
+    REQUIRE(entry->hash == content_hash(create_library_setup(3)));
+    REQUIRE(content_hash(entry->setup()) == entry->hash);
+
+    const LibraryCacheEntry* broken = cache.find(paths.back());
+    REQUIRE(broken != nullptr);
+    REQUIRE(broken->error.find("Failed to parse JSON") != std::string::npos);
+    REQUIRE_THROWS_AS(broken->setup(), std::runtime_error);
+    REQUIRE(cache.find("elsewhere.json") == nullptr);
+}
+
+TEST_CASE("LibraryCache re-parses changed, new and recently written files", "[library_cache]") {
+    LibraryDirectory directory("changes");
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < 4; ++i) {
+        paths.push_back(directory.write("setup_" + std::to_string(i) + ".json", create_library_setup(i).to_json_string()));
+    }
+
+    LibraryCache cache(directory.cache_file());
+    cache.refresh(paths);
+
+    ORSF renamed = create_library_setup(1);
+    renamed.metadata.name = "Renamed qualifying setup";
+    directory.write("setup_1.json", renamed.to_json_string(), 30);
+    fs::remove(paths[2]);
+    paths.push_back(directory.write("setup_new.json", create_library_setup(9).to_json_string()));
+    paths.push_back(directory.write("fresh.json", create_library_setup(10).to_json_string(), 0));
+    std::vector<std::string> listed = {paths[0], paths[1], paths[2], paths[4], paths[5]};
+
+    LibraryRefreshStats stats = cache.refresh(listed);
+    REQUIRE(stats.reused == 1);
+    REQUIRE(stats.parsed == 3);
+    REQUIRE(stats.missing == 1);
+    REQUIRE(stats.removed == 2);
+    REQUIRE(cache.entries().size() == 4);
+    REQUIRE(cache.entries()[1].listing.name == "Renamed qualifying setup");
+    REQUIRE(cache.entries()[2].listing.id == "library-9");
+    REQUIRE(cache.find(paths[3]) == nullptr);
+
+    // Written just now: its mtime could survive another write, so it is not trusted yet
+    stats = cache.refresh(listed);
+    REQUIRE(stats.reused == 3);
+    REQUIRE(stats.parsed == 1);
+    REQUIRE(cache.entries()[3].listing.id == "library-10");
+}
+
+TEST_CASE("LibraryCache ignores corrupt cache files", "[library_cache]") {
+    LibraryDirectory directory("corrupt");
+    std::vector<std::string> paths = {directory.write("setup.json", create_library_setup(0).to_json_string())};
+
+    LibraryCache cache(directory.cache_file());
+    cache.refresh(paths);
+    cache.save();
+
+    std::ifstream in(directory.cache_file(), std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    REQUIRE(bytes.compare(0, 8, LibraryCache::MAGIC) == 0);
+
+    std::ofstream(directory.cache_file(), std::ios::binary | std::ios::trunc) << bytes.substr(0, bytes.size() - 5);
+    REQUIRE_FALSE(cache.load());
+    REQUIRE(cache.entries().empty());
+
+    std::ofstream(directory.cache_file(), std::ios::binary | std::ios::trunc) << "ORSFPAK1" << bytes.substr(8);
+    REQUIRE_FALSE(cache.load());
+
+    std::ofstream(directory.cache_file(), std::ios::binary | std::ios::trunc) << bytes;
+    REQUIRE(cache.load());
+    REQUIRE(cache.entries().size() == 1);
+}
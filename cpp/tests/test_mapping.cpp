@@ -223,3 +223,110 @@ TEST_CASE("FieldMapping with composed transformation", "[mapping]") {
     ORSF result = MappingEngine::map_to_orsf(native, mappings, setup);
     REQUIRE(result.setup.aero->front_wing.value() == Approx(2.0).margin(0.001));
 }
+
+TEST_CASE("MappingPlan matches MappingEngine", "[mapping]") {
+    ORSF setup = create_test_setup();
+
+    std::vector<FieldMapping> mappings = {
+        FieldMapping("setup.tires.pressure_fl_kpa", "tire_fl_psi",
+            Transform::unit_convert(Unit::KPA, Unit::PSI),
+            Transform::unit_convert(Unit::PSI, Unit::KPA),
+            false),
+        FieldMapping("setup.brakes.brake_bias_pct", "brake_balance",
+            Transform::percent_to_ratio(), Transform::ratio_to_percent(), false),
+        FieldMapping("setup.aero.rear_wing", "wing_rear"),
+        FieldMapping("setup.fuel.start_fuel_l", "fuel"),     // Absent in setup
+    };
+
+    MappingPlan plan(mappings);
+    FlatSetup expected = MappingEngine::map_to_native(setup, mappings);
+
+    REQUIRE(plan.to_native(setup) == expected);
+    REQUIRE(plan.to_native(setup, MappingEngine::extract_fields(setup)) == expected);
+
+    ORSF restored = plan.to_orsf(expected, setup);
+    REQUIRE(restored.setup.brakes->brake_bias_pct.value() == Approx(58.0));
+
+    SECTION("Required fields still throw") {
+        MappingPlan strict({FieldMapping("setup.fuel.start_fuel_l", "fuel", std::nullopt, std::nullopt, true)});
+        REQUIRE_THROWS_AS(strict.to_native(setup), std::runtime_error);
+    }
+}
+
+TEST_CASE("MappingPlan agrees with get_value on every numeric field", "[mapping]") {
+    ORSF setup = create_test_setup();
+    setup.context = Context{};
+    setup.context->ambient_temp_c = 24.0;
+    setup.context->wetness = 0.3;
+    setup.setup.suspension = Suspension{};
+    setup.setup.suspension->front_left = CornerSuspension{};
+    setup.setup.suspension->front_left->packer_mm = 5.0;
+    setup.setup.suspension->heave_packer_mm = 8.0;
+    setup.setup.electronics = Electronics{};
+    setup.setup.electronics->tc2_level = 3;
+    setup.setup.electronics->engine_brake_level = 2;
+
+    std::vector<FieldMapping> mappings;
+    for (const auto& path : MappingEngine::numeric_field_paths()) {
+        mappings.emplace_back(path, path);
+    }
+    FlatSetup native = MappingPlan(mappings).to_native(setup);
+
+    for (const auto& path : MappingEngine::numeric_field_paths()) {
+        auto value = MappingEngine::get_value(setup, path);
+        auto it = native.find(path);
+        REQUIRE(value.has_value() == (it != native.end()));
+        if (value.has_value()) REQUIRE(it->second == value.value());
+    }
+
+    REQUIRE(MappingEngine::get_value(setup, "context.ambient_temp_c") == 24.0);
+    REQUIRE(MappingEngine::get_value(setup, "setup.suspension.front_left.packer_mm") == 5.0);
+    REQUIRE(MappingEngine::get_value(setup, "setup.suspension.heave_packer_mm") == 8.0);
+    REQUIRE(MappingEngine::get_value(setup, "setup.electronics.tc2_level") == 3.0);
+    REQUIRE(MappingEngine::get_value(setup, "setup.electronics.engine_brake_level") == 2.0);
+    REQUIRE_FALSE(MappingEngine::get_value(setup, "setup.tires.unknown").has_value());
+}
+
+TEST_CASE("MappingEngine set_value writes every path get_value reads", "[mapping]") {
+    ORSF setup;
+    const auto& paths = MappingEngine::numeric_field_paths();
+    for (size_t i = 0; i < paths.size(); ++i) {
+        MappingEngine::set_value(setup, paths[i], static_cast<double>(i + 1));
+    }
+    for (size_t i = 0; i < paths.size(); ++i) {
+        REQUIRE(MappingEngine::get_value(setup, paths[i]) == static_cast<double>(i + 1));
+    }
+
+    // map_to_orsf inverts map_to_native on fields outside the old setter list
+    std::vector<FieldMapping> mappings = {
+        FieldMapping("context.track_temp_c", "track"),
+        FieldMapping("setup.suspension.rear_right.packer_mm", "packer_rr"),
+        FieldMapping("setup.suspension.heave_packer_mm", "heave_packer"),
+        FieldMapping("setup.electronics.tc2_level", "tc2"),
+        FieldMapping("setup.electronics.engine_brake_level", "eb"),
+    };
+    FlatSetup native = {{"track", 31.5}, {"packer_rr", 4.0}, {"heave_packer", 7.5}, {"tc2", 2.0}, {"eb", 2.6}};
+    ORSF mapped = MappingEngine::map_to_orsf(native, mappings, ORSF{});
+
+    REQUIRE(mapped.context->track_temp_c == 31.5);
+    REQUIRE(mapped.setup.suspension->rear_right->packer_mm == 4.0);
+    REQUIRE(mapped.setup.suspension->heave_packer_mm == 7.5);
+    REQUIRE(mapped.setup.electronics->tc2_level == 2);
+    REQUIRE(mapped.setup.electronics->engine_brake_level == 3);  // Integer fields round
+
+    // Unknown paths are ignored
+    MappingEngine::set_value(mapped, "setup.tires.unknown", 1.0);
+    REQUIRE_FALSE(mapped.setup.tires.has_value());
+}
+
+TEST_CASE("MappingEngine extracts every numeric field", "[mapping]") {
+    ORSF setup = create_test_setup();
+    FieldValues values = MappingEngine::extract_fields(setup);
+
+    REQUIRE(values.size() == MappingEngine::numeric_field_paths().size());
+
+    auto index = MappingEngine::numeric_field_index("setup.tires.pressure_rl_kpa");
+    REQUIRE(index.has_value());
+    REQUIRE(values[*index] == 165.0);
+    REQUIRE_FALSE(MappingEngine::numeric_field_index("setup.tires.unknown").has_value());
+}
@@ -0,0 +1,305 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace orsf;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Setup files removed at the end of the test
+struct ImportDirectory {
+    fs::path path;
+    std::vector<std::string> files;
+
+    explicit ImportDirectory(const std::string& name)
+        : path(fs::temp_directory_path() / ("orsf_test_pipeline_" + name)) {
+        fs::remove_all(path);
+        fs::create_directories(path);
+    }
+
+    ~ImportDirectory() {
+        std::error_code ignored;
+        fs::remove_all(path, ignored);
+    }
+
+    void write(const std::string& name, const std::string& contents) {
+        files.push_back((path / name).string());
+        std::ofstream(files.back(), std::ios::binary) << contents;
+    }
+
+    void write_setups(size_t count);
+};
+
+ORSF create_import_setup(size_t index) {
+    ORSF setup;
+    setup.metadata.id = "import-" + std::to_string(index);
+    setup.metadata.name = "Import " + std::to_string(index);
+    setup.metadata.created_at = "2024-01-01T00:00:00Z";
+    setup.car.make = "BMW";
+    setup.car.model = "M4 GT3";
+    return setup;
+}
+
+void ImportDirectory::write_setups(size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        write("setup_" + std::to_string(i) + ".json", create_import_setup(i).to_json_string());
+    }
+}
+
+} // namespace
+
+TEST_CASE("BoundedQueue is a FIFO with fixed capacity", "[pipeline]") {
+    BoundedQueue<int> queue(5);
+    REQUIRE(queue.capacity() == 8);
+
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(queue.try_push(i));
+    }
+    int extra = 99;
+    REQUIRE_FALSE(queue.try_push(extra));
+    REQUIRE(extra == 99);
+    REQUIRE(queue.size_approx() == 8);
+
+    int value = -1;
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(queue.try_pop(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE_FALSE(queue.try_pop(value));
+
+    BoundedQueue<std::unique_ptr<int>> owning(2);
+    auto pointer = std::make_unique<int>(7);
+    REQUIRE(owning.try_push(pointer));
+    REQUIRE(pointer == nullptr);
+    REQUIRE(owning.try_pop(pointer));
+    REQUIRE(*pointer == 7);
+}
+
+TEST_CASE("BoundedQueue hands every value to exactly one consumer", "[pipeline]") {
+    constexpr uint64_t PER_PRODUCER = 20000;
+    constexpr uint64_t PRODUCERS = 3;
+    BoundedQueue<uint64_t> queue(16);
+    std::atomic<uint64_t> popped{0};
+    std::atomic<uint64_t> sum{0};
+
+    std::vector<std::thread> threads;
+    for (uint64_t p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&queue, p] {
+            for (uint64_t i = 1; i <= PER_PRODUCER; ++i) {
+                uint64_t value = p * PER_PRODUCER + i;
+                while (!queue.try_push(value)) std::this_thread::yield();
+            }
+        });
+    }
+    for (int c = 0; c < 3; ++c) {
+        threads.emplace_back([&] {
+            uint64_t value = 0;
+            while (popped.load() < PRODUCERS * PER_PRODUCER) {
+                if (queue.try_pop(value)) {
+                    sum.fetch_add(value);
+                    popped.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    const uint64_t n = PRODUCERS * PER_PRODUCER;
+    REQUIRE(popped.load() == n);
+    REQUIRE(sum.load() == n * (n + 1) / 2);
+}
+
+TEST_CASE("ImportPipeline reads, parses, validates and transforms files", "[pipeline]") {
+    ImportDirectory directory("import");
+    directory.write_setups(20);
+    ORSF invalid = create_import_setup(20);
+    invalid.metadata.name = "";
+    directory.write("invalid.json", invalid.to_json_string());
+    directory.write("broken.json", "{\"metadata\": ");
+    directory.write("empty.json", "");
+    directory.files.push_back((directory.path / "missing.json").string());
+
+    // Room for three parse workers next to the other stages
+    set_default_executor(std::make_shared<ThreadPoolExecutor>(6));
+
+    for (bool use_mmap : {true, false}) {
+        ImportOptions options;
+        options.use_mmap = use_mmap;
+        options.parse_workers = 3;
+        options.transform = [](ImportItem& item) { item.setup.metadata.tags = std::vector<std::string>{"imported"}; };
+
+        // Sinks run on pipeline threads; collect there, check here
+        std::mutex mutex;
+        std::vector<std::string> errors(directory.files.size());
+        std::set<uint64_t> seen;
+        size_t unexpected = 0;
+        options.sink = [&](ImportItem& item) {
+            std::lock_guard<std::mutex> lock(mutex);
+            seen.insert(item.index);
+            errors[item.index] = item.error;
+            if (!item.data.empty() || item.storage) ++unexpected;
+            if (item.ok() && !item.invalid() &&
+                (item.setup.metadata.id != "import-" + std::to_string(item.index) ||
+                 item.setup.metadata.tags != std::vector<std::string>{"imported"})) {
+                ++unexpected;
+            }
+        };
+
+        ImportStats stats = ImportPipeline(options).run(directory.files);
+        REQUIRE(seen.size() == directory.files.size());
+        REQUIRE(unexpected == 0);
+        REQUIRE(stats.items == directory.files.size());
+        REQUIRE(stats.failed == 3);
+        REQUIRE(stats.invalid == 1);
+        REQUIRE_FALSE(stats.cancelled);
+        REQUIRE(stats.bytes > 20 * 100);
+
+        REQUIRE(errors[21].find("Failed to parse JSON") != std::string::npos);
+        REQUIRE_FALSE(errors[22].empty());
+        REQUIRE(errors[23].find("missing.json") != std::string::npos);
+
+        REQUIRE(stats.stages.size() == 5);
+        REQUIRE(stats.stages[0].name == "read");
+        REQUIRE(stats.stages[1].workers == 3);
+        for (const auto& stage : stats.stages) {
+            REQUIRE(stage.items == directory.files.size());
+            REQUIRE(stage.utilization(stats.elapsed) >= 0.0);
+            REQUIRE(stage.utilization(stats.elapsed) <= 1.0);
+        }
+        REQUIRE(stats.to_json()["stages"][4]["name"] == "sink");
+    }
+
+    set_default_executor(nullptr);
+}
+
+TEST_CASE("ImportPipeline keeps compute stages within the shared executor", "[pipeline]") {
+    ImportDirectory directory("budget");
+    directory.write_setups(10);
+    set_default_executor(std::make_shared<ThreadPoolExecutor>(5));
+
+    auto compute_workers = [](const ImportStats& stats) {
+        size_t total = 0;
+        for (size_t s = 1; s < stats.stages.size(); ++s) {
+            REQUIRE(stats.stages[s].workers >= 1);
+            total += stats.stages[s].workers;
+        }
+        return total;
+    };
+
+    ImportOptions options;
+    options.sink = [](ImportItem&) {};
+
+    SECTION("Automatic parse workers take the remainder") {
+        ImportStats stats = ImportPipeline(options).run(directory.files);
+        REQUIRE(stats.items == 10);
+        REQUIRE(stats.stages[1].workers == 2);
+        REQUIRE(compute_workers(stats) == 5);
+    }
+
+    SECTION("Explicit counts over the budget are trimmed") {
+        options.parse_workers = 4;
+        options.validate_workers = 8;
+        ImportStats stats = ImportPipeline(options).run(directory.files);
+        REQUIRE(stats.items == 10);
+        REQUIRE(compute_workers(stats) == 5);
+    }
+
+    SECTION("Read workers are not counted") {
+        options.read_workers = 3;
+        ImportStats stats = ImportPipeline(options).run(directory.files);
+        REQUIRE(stats.stages[0].workers == 3);
+        REQUIRE(compute_workers(stats) == 5);
+    }
+
+    set_default_executor(nullptr);
+}
+
+TEST_CASE("ImportPipeline decodes native files with an adapter", "[pipeline]") {
+    auto adapter = std::make_shared<ExampleAdapter>();
+    ImportDirectory directory("native");
+    for (size_t i = 0; i < 4; ++i) {
+        ByteBuffer native;
+        adapter->encode_native(create_import_setup(i), native);
+        directory.write("setup_" + std::to_string(i) + ".example", std::string(native.span().as_chars()));
+    }
+
+    ImportOptions options;
+    options.adapter = adapter;
+    options.validate = false;
+    std::atomic<size_t> decoded{0};
+    options.sink = [&](ImportItem& item) {
+        if (item.ok() && item.findings.empty()) decoded.fetch_add(1);
+    };
+
+    ImportStats stats = ImportPipeline(options).run(directory.files);
+    REQUIRE(stats.failed == 0);
+    REQUIRE(decoded.load() == 4);
+}
+
+TEST_CASE("ImportPipeline bounds items in flight with backpressure", "[pipeline]") {
+    ImportDirectory directory("backpressure");
+    directory.write_setups(40);
+
+    ImportOptions options;
+    options.queue_capacity = 2;
+    options.parse_workers = 2;
+    std::atomic<int> in_flight{0};
+    std::atomic<int> peak{0};
+    options.transform = [&](ImportItem&) {
+        int now = in_flight.fetch_add(1) + 1;
+        int previous = peak.load();
+        while (now > previous && !peak.compare_exchange_weak(previous, now)) {}
+    };
+    options.sink = [&](ImportItem&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        in_flight.fetch_sub(1);
+    };
+
+    ImportStats stats = ImportPipeline(options).run(directory.files);
+    REQUIRE(stats.items == 40);
+
+    // One item in each of transform and sink, plus the queue between them
+    REQUIRE(peak.load() <= 4);
+    REQUIRE(stats.stages[3].blocked.count() > 0);
+}
+
+TEST_CASE("ImportPipeline stops on cancel and on sink errors", "[pipeline]") {
+    ImportDirectory directory("cancel");
+    directory.write_setups(60);
+
+    ImportOptions options;
+    options.queue_capacity = 4;
+    std::atomic<size_t> received{0};
+    ImportPipeline* running = nullptr;
+    options.sink = [&](ImportItem&) {
+        if (received.fetch_add(1) + 1 == 5) running->cancel();
+    };
+
+    ImportPipeline pipeline(options);
+    running = &pipeline;
+    ImportStats stats = pipeline.run(directory.files);
+    REQUIRE(stats.cancelled);
+    REQUIRE(received.load() >= 5);
+    REQUIRE(received.load() < 60);
+
+    options.sink = [](ImportItem& item) {
+        if (item.index == 3) throw std::runtime_error("index full");
+    };
+    std::string message;
+    try {
+        ImportPipeline(options).run(directory.files);
+    } catch (const std::runtime_error& e) {
+        message = e.what();
+    }
+    REQUIRE(message == "index full");
+
+    ImportOptions no_sink;
+    REQUIRE_THROWS_AS(ImportPipeline(no_sink), std::runtime_error);
+}
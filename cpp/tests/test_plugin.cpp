@@ -0,0 +1,189 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace orsf;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Plugin directory removed at the end of the test
+struct PluginDirectory {
+    fs::path path;
+
+    explicit PluginDirectory(const std::string& name)
+        : path(fs::temp_directory_path() / ("orsf_test_plugins_" + name)) {
+        fs::remove_all(path);
+        fs::create_directories(path);
+    }
+
+    ~PluginDirectory() {
+        std::error_code ignored;
+        fs::remove_all(path, ignored);
+    }
+
+    void write_manifest(const std::string& name, const std::string& library) const {
+        json manifest = {
+            {"format", PluginManifest::FORMAT},
+            {"name", name},
+            {"library", library},
+            {"adapters", json::array({
+                {{"id", "plugsim"}, {"version", "1.0"}, {"car_keys", {"gt3", "gt4"}},
+                 {"file_extension", "plug"}, {"signatures", json::array({{{"bytes", "PLUGSIM"}, {"offset", 0}}})}}
+            })}
+        };
+        std::ofstream(path / (name + PluginManifest::SUFFIX)) << manifest.dump(2);
+    }
+};
+
+} // namespace
+
+TEST_CASE("PluginManifest parses JSON", "[plugin]") {
+    json j = json::parse(R"({
+        "format": "orsf-plugin/v1",
+        "name": "acme",
+        "library": "lib/libacme.so",
+        "adapters": [{"id": "acme", "version": "2.1", "car_keys": ["gt3", "gt4"], "file_extension": "ACM"}]
+    })");
+
+    PluginManifest manifest = PluginManifest::from_json(j, "/opt/plugins");
+    REQUIRE(manifest.name == "acme");
+    REQUIRE(manifest.library == "/opt/plugins/lib/libacme.so");
+    REQUIRE(manifest.adapters.size() == 1);
+    REQUIRE(manifest.adapters[0].car_keys == std::vector<std::string>{"gt3", "gt4"});
+    REQUIRE(manifest.adapters[0].file_extension == "ACM");
+
+    j["library"] = "/usr/lib/libacme.so";
+    REQUIRE(PluginManifest::from_json(j, "/opt/plugins").library == "/usr/lib/libacme.so");
+
+    json wrong_format = j;
+    wrong_format["format"] = "orsf-plugin/v0";
+    REQUIRE_THROWS_AS(PluginManifest::from_json(wrong_format, "/opt"), std::runtime_error);
+
+    json no_cars = j;
+    no_cars["adapters"][0]["car_keys"] = json::array();
+    REQUIRE_THROWS_AS(PluginManifest::from_json(no_cars, "/opt"), std::runtime_error);
+
+    json missing = j;
+    missing.erase("adapters");
+    REQUIRE_THROWS_AS(PluginManifest::from_json(missing, "/opt"), std::runtime_error);
+}
+
+TEST_CASE("Plugins are indexed without loading", "[plugin]") {
+    PluginDirectory dir("index");
+    dir.write_manifest("missing", "libmissing_plugin.so");
+    std::ofstream(dir.path / "notes.json") << "not a manifest";
+
+    AdapterRegistry registry;
+    REQUIRE(registry.register_plugins(dir.path.string()) == 2);
+    REQUIRE(registry.get_all_adapters().size() == 2);
+
+    auto report = registry.plugin_report();
+    REQUIRE(report.plugins.size() == 1);
+    REQUIRE(report.loaded_count() == 0);
+    REQUIRE(report.plugins[0].name == "missing");
+
+    auto adapters = registry.get_adapters_for_game("plugsim");
+    REQUIRE(adapters.size() == 2);
+    auto proxy = std::dynamic_pointer_cast<PluginAdapter>(adapters[0]);
+    REQUIRE(proxy != nullptr);
+    REQUIRE_FALSE(proxy->is_loaded());
+    REQUIRE(proxy->get_file_extension() == "plug");
+
+    // Detection matches the manifest signature without opening the library
+    auto detected = registry.detect(ByteSpan(std::string_view("PLUGSIM gt3 Monza")));
+    REQUIRE(std::dynamic_pointer_cast<PluginAdapter>(detected) != nullptr);
+    REQUIRE_FALSE(std::static_pointer_cast<PluginAdapter>(detected)->is_loaded());
+    REQUIRE(registry.plugin_report().loaded_count() == 0);
+}
+
+TEST_CASE("Plugin load failures are reported on resolve", "[plugin]") {
+    PluginDirectory dir("failure");
+    dir.write_manifest("missing", "libmissing_plugin.so");
+
+    AdapterRegistry registry;
+    registry.register_plugins(dir.path.string());
+
+    REQUIRE_THROWS_AS(registry.resolve("plugsim", "1.0", "gt3"), std::runtime_error);
+    // The failure is remembered rather than retried
+    REQUIRE_THROWS_AS(registry.resolve("plugsim", "1.0", "gt4"), std::runtime_error);
+
+    auto report = registry.plugin_report();
+    REQUIRE(report.loaded_count() == 0);
+    REQUIRE_FALSE(report.plugins[0].error.empty());
+
+    REQUIRE(registry.resolve("othersim", "1.0", "gt3") == nullptr);
+    REQUIRE_THROWS_AS(registry.register_plugins((dir.path / "no_such_dir").string()), std::runtime_error);
+}
+
+#ifdef ORSF_TEST_PLUGIN_PATH
+
+TEST_CASE("Plugins load on first resolve", "[plugin]") {
+    PluginDirectory dir("load");
+    dir.write_manifest("plugsim", ORSF_TEST_PLUGIN_PATH);
+
+    AdapterRegistry registry;
+    registry.register_plugins(dir.path.string());
+    REQUIRE(registry.plugin_report().loaded_count() == 0);
+
+    auto adapter = registry.resolve("plugsim", "1.0", "gt4");
+    REQUIRE(adapter != nullptr);
+    REQUIRE(std::static_pointer_cast<PluginAdapter>(adapter)->is_loaded());
+
+    ORSF setup;
+    setup.metadata.name = "Monza";
+    auto bytes = adapter->orsf_to_native(setup);
+    REQUIRE(std::string(bytes.begin(), bytes.end()) == "PLUGSIM gt4 Monza");
+    REQUIRE(adapter->native_to_orsf(bytes).metadata.name == "PLUGSIM gt4 Monza");
+    REQUIRE(adapter->get_suggested_filename() == "setup.plug");
+
+    auto report = registry.plugin_report();
+    REQUIRE(report.loaded_count() == 1);
+    REQUIRE(report.plugins[0].error.empty());
+    REQUIRE(report.total_load_time().count() > 0);
+
+    // Detection uses the manifest signature
+    REQUIRE(registry.detect(ByteSpan(bytes)) != nullptr);
+}
+
+TEST_CASE("Plugins load once under concurrent resolves", "[plugin]") {
+    PluginDirectory dir("concurrent");
+    dir.write_manifest("plugsim", ORSF_TEST_PLUGIN_PATH);
+
+    AdapterRegistry registry;
+    registry.register_plugins(dir.path.string());
+    registry.freeze();
+
+    std::vector<std::shared_ptr<Adapter>> resolved(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < resolved.size(); ++i) {
+        threads.emplace_back([&, i] { resolved[i] = registry.resolve("plugsim", "1.0", i % 2 ? "gt3" : "gt4"); });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (size_t i = 0; i < resolved.size(); ++i) {
+        REQUIRE(resolved[i] == resolved[i % 2]);
+        auto bytes = resolved[i]->orsf_to_native(ORSF{});
+        REQUIRE(std::string(bytes.begin(), bytes.end()).rfind(i % 2 ? "PLUGSIM gt3" : "PLUGSIM gt4", 0) == 0);
+    }
+    REQUIRE(registry.plugin_report().loaded_count() == 1);
+}
+
+TEST_CASE("Plugin adapters outlive the registry", "[plugin]") {
+    PluginDirectory dir("lifetime");
+    dir.write_manifest("plugsim", ORSF_TEST_PLUGIN_PATH);
+
+    std::shared_ptr<Adapter> adapter;
+    {
+        AdapterRegistry registry;
+        registry.register_plugins(dir.path.string());
+        adapter = registry.resolve("plugsim", "1.0", "gt3");
+    }
+
+    auto bytes = adapter->orsf_to_native(ORSF{});
+    REQUIRE(std::string(bytes.begin(), bytes.end()).rfind("PLUGSIM gt3", 0) == 0);
+}
+
+#endif
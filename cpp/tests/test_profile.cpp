@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_profile_setup(const std::string& car_class, double pressure_kpa) {
+    ORSF setup;
+    setup.metadata.id = "profile-1";
+    setup.metadata.name = "Profile Setup";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Generic";
+    setup.car.model = "Racer";
+    setup.car.car_class = car_class;
+    setup.setup.tires = Tires{};
+    setup.setup.tires->pressure_fl_kpa = pressure_kpa;
+    return setup;
+}
+
+bool has_error_on(const std::vector<ValidationError>& errors, const std::string& field) {
+    for (const auto& error : errors) {
+        if (error.field == field) return true;
+    }
+    return false;
+}
+
+class StrictAdapter : public ExampleAdapter {
+public:
+    std::optional<ValidationProfile> get_validation_profile() const override {
+        ValidationProfile profile;
+        profile.extra_rules.push_back([](const ORSF& orsf, std::vector<ValidationError>& errors) {
+            if (!orsf.context.has_value() || !orsf.context->track.has_value()) {
+                errors.push_back(ValidationError(
+                    ValidationSeverity::Error, ValidationCode::Required,
+                    "context.track", "Track is required by this adapter"));
+            }
+        });
+        return profile;
+    }
+};
+
+} // namespace
+
+TEST_CASE("RuleProgram applies car class range overrides", "[profile]") {
+    std::map<std::string, ValidationProfile> class_profiles;
+    class_profiles["F1"].overrides.push_back(
+        ColumnRule::range("setup.tires.pressure_fl_kpa", 120.0, 200.0, ValidationSeverity::Warning));
+
+    auto program = RuleProgram::compile(class_profiles, nullptr);
+    REQUIRE(program->has_class("F1"));
+
+    // 300 kPa is fine for the standard range but not for F1
+    REQUIRE_FALSE(has_error_on(program->validate(create_profile_setup("GT3", 300.0)), "setup.tires.pressure_fl_kpa"));
+    REQUIRE(has_error_on(program->validate(create_profile_setup("F1", 300.0)), "setup.tires.pressure_fl_kpa"));
+
+    // Override replaces the standard rule instead of adding to it
+    auto errors = program->validate(create_profile_setup("F1", 450.0));
+    size_t count = 0;
+    for (const auto& error : errors) {
+        if (error.field == "setup.tires.pressure_fl_kpa") ++count;
+    }
+    REQUIRE(count == 1);
+}
+
+TEST_CASE("RuleProgram without profiles matches the standard validator", "[profile]") {
+    ORSF setup = create_profile_setup("Kart", 450.0);
+    setup.schema = "orsf://v0";
+    setup.metadata.created_at = "yesterday";
+    setup.context = Context{};
+    setup.context->ambient_temp_c = 35.0;
+    setup.context->track_temp_c = 10.0;
+    setup.context->rubber = "sticky";
+    setup.setup.aero = Aerodynamics{};
+    setup.setup.aero->brake_duct_front_pct = 120.0;
+    setup.setup.suspension = Suspension{};
+    setup.setup.suspension->rear_right = CornerSuspension{};
+    setup.setup.suspension->rear_right->spring_rate_n_mm = -5.0;
+    setup.setup.drivetrain = Drivetrain{};
+    setup.setup.drivetrain->final_drive_ratio = 0.0;
+    setup.setup.drivetrain->lsd_clutch_plates = 0;
+    setup.setup.gearing = Gearing{};
+    setup.setup.gearing->gear_ratios = std::vector<double>{3.0, -1.0};
+    setup.setup.gearing->reverse_ratio = -2.0;
+    setup.setup.fuel = Fuel{};
+    setup.setup.fuel->per_lap_consumption_l = 0.0;
+    setup.setup.fuel->stint_target_laps = -1;
+
+    auto expected = Validator::validate(setup);
+    auto actual = RuleProgram::compile({}, nullptr)->validate(setup);
+    REQUIRE(expected.size() == 14);
+    REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE(actual[i].to_string() == expected[i].to_string());
+    }
+
+    // An override keeps the position of the rule it replaces
+    ValidationProfile profile;
+    profile.overrides.push_back(ColumnRule::range("setup.drivetrain.final_drive_ratio", -1.0, 10.0));
+    profile.overrides.push_back(ColumnRule::positive("setup.drivetrain.lsd_clutch_plates"));
+    actual = RuleProgram::compile({}, &profile)->validate(setup);
+    REQUIRE(actual.size() == expected.size() - 1);
+    for (size_t i = 0, j = 0; i < expected.size(); ++i) {
+        if (expected[i].field == "setup.drivetrain.final_drive_ratio") continue;
+        if (expected[i].field == "setup.drivetrain.lsd_clutch_plates") {
+            REQUIRE(actual[j].message == "Value must be positive");
+        }
+        REQUIRE(actual[j++].field == expected[i].field);
+    }
+}
+
+TEST_CASE("RuleProgram accepts car classes with a profile", "[profile]") {
+    std::map<std::string, ValidationProfile> class_profiles;
+    class_profiles["Hypercar"] = ValidationProfile{};
+
+    auto program = RuleProgram::compile(class_profiles, nullptr);
+    REQUIRE(has_error_on(Validator::validate(create_profile_setup("Hypercar", 170.0)), "car.class"));
+    REQUIRE_FALSE(has_error_on(program->validate(create_profile_setup("Hypercar", 170.0)), "car.class"));
+}
+
+TEST_CASE("RuleProgram rejects unknown override fields", "[profile]") {
+    ValidationProfile profile;
+    profile.overrides.push_back(ColumnRule::positive("setup.does_not_exist"));
+    REQUIRE_THROWS_AS(RuleProgram::compile({}, &profile), std::runtime_error);
+}
+
+TEST_CASE("AdapterRegistry compiles profiles at registration", "[profile][adapter]") {
+    auto& registry = AdapterRegistry::instance();
+    registry.clear();
+
+    ValidationProfile gt3;
+    gt3.overrides.push_back(ColumnRule::range("setup.tires.pressure_fl_kpa", 150.0, 200.0));
+    registry.register_class_profile("GT3", gt3);
+
+    auto adapter = std::make_shared<StrictAdapter>();
+    registry.register_adapter(adapter);
+    REQUIRE(adapter->get_rule_program() != nullptr);
+
+    SECTION("Class and adapter profile rules apply") {
+        auto errors = adapter->validate_orsf(create_profile_setup("GT3", 250.0));
+        REQUIRE(has_error_on(errors, "setup.tires.pressure_fl_kpa"));
+        REQUIRE(has_error_on(errors, "context.track"));
+    }
+
+    SECTION("Registered adapter profile takes precedence") {
+        registry.register_adapter_profile("example", "1.0", "generic", ValidationProfile{});
+        auto errors = adapter->validate_orsf(create_profile_setup("GT3", 170.0));
+        REQUIRE_FALSE(has_error_on(errors, "context.track"));
+    }
+
+    SECTION("Class profiles registered later recompile adapters") {
+        ValidationProfile f4;
+        f4.overrides.push_back(ColumnRule::range("setup.tires.pressure_fl_kpa", 100.0, 140.0));
+        registry.register_class_profile("F4", f4);
+
+        auto errors = adapter->validate_orsf(create_profile_setup("F4", 170.0));
+        REQUIRE(has_error_on(errors, "setup.tires.pressure_fl_kpa"));
+    }
+
+    registry.clear();
+}
@@ -0,0 +1,207 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <cstdio>
+#include <functional>
+#include <unistd.h>
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_sink_setup() {
+    ORSF setup;
+    setup.metadata.id = "sink-1";
+    setup.metadata.name = "Sink Setup";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.setup.aero = Aerodynamics{};
+    setup.setup.aero->front_wing = 4.0;
+    setup.setup.brakes = Brakes{};
+    setup.setup.brakes->brake_bias_pct = 56.5;
+    return setup;
+}
+
+// Adapter streaming key=value lines through the BaseAdapter helpers
+class KeyValueAdapter : public BaseAdapter {
+public:
+    KeyValueAdapter() : BaseAdapter("kv", "1.0", "generic") {}
+
+    std::vector<uint8_t> orsf_to_native(const ORSF& orsf) const override {
+        ByteBuffer out;
+        ByteBufferSink sink(out);
+        write_native(orsf, sink);
+        return out.release();
+    }
+
+    void write_native(const ORSF& orsf, OutputSink& sink) const override {
+        TextWriter writer(sink);
+        writer.section("Setup");
+        write_key_values(orsf_to_flat(orsf), writer);
+        writer.flush();
+    }
+
+    ORSF native_to_orsf(const std::vector<uint8_t>&) const override { return ORSF{}; }
+    std::string get_suggested_filename() const override { return "setup.ini"; }
+    std::string get_file_extension() const override { return "ini"; }
+    std::optional<std::string> get_install_path() const override { return std::nullopt; }
+
+    std::vector<FieldMapping> get_field_mappings() const override {
+        return {
+            FieldMapping("setup.aero.front_wing", "aero_front", std::nullopt, std::nullopt, false),
+            FieldMapping("setup.brakes.brake_bias_pct", "brake_balance",
+                Transform::percent_to_ratio(), Transform::ratio_to_percent(), false),
+        };
+    }
+};
+
+} // namespace
+
+TEST_CASE("TextWriter formats key=value lines", "[sink]") {
+    std::string out;
+    StringSink sink(out);
+    {
+        TextWriter writer(sink);
+        writer.section("Tires");
+        writer.key_value("pressure", 172.5);
+        writer.key_value("laps", 12);
+        writer.key_value("compound", "soft");
+        writer.key_value("ratio", 0.1);
+        writer.flush();
+    }
+    REQUIRE(out == "[Tires]\npressure=172.5\nlaps=12\ncompound=soft\nratio=0.1\n");
+}
+
+TEST_CASE("TextWriter forwards large output in chunks", "[sink]") {
+    std::vector<size_t> chunks;
+    size_t total = 0;
+    CallbackSink sink([&](const uint8_t*, size_t size) {
+        chunks.push_back(size);
+        total += size;
+    });
+
+    TextWriter writer(sink);
+    for (int i = 0; i < 5000; ++i) {
+        writer.key_value("key", i);
+    }
+    writer.write(std::string(TextWriter::BUFFER_SIZE * 2, 'x'));
+    writer.flush();
+
+    REQUIRE(chunks.size() > 2);
+    for (size_t chunk : chunks) {
+        REQUIRE(chunk <= TextWriter::BUFFER_SIZE * 2);
+    }
+
+    size_t expected = TextWriter::BUFFER_SIZE * 2;
+    for (int i = 0; i < 5000; ++i) expected += 5 + std::to_string(i).size();
+    REQUIRE(total == expected);
+}
+
+TEST_CASE("FixedBufferSink rejects overflow", "[sink]") {
+    char buffer[8];
+    FixedBufferSink sink(buffer, sizeof(buffer));
+
+    sink.write(std::string_view("12345"));
+    REQUIRE(sink.span().as_chars() == "12345");
+    REQUIRE_THROWS_AS(sink.write(std::string_view("6789")), std::runtime_error);
+    REQUIRE(sink.size() == 5);
+}
+
+TEST_CASE("FdSink writes to a file descriptor", "[sink]") {
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+
+    {
+        FdSink sink(fds[1]);
+        sink.write(std::string_view("brake_balance=0.565\n"));
+    }
+    ::close(fds[1]);
+
+    char buffer[64] = {};
+    auto read_bytes = ::read(fds[0], buffer, sizeof(buffer));
+    ::close(fds[0]);
+
+    REQUIRE(std::string(buffer, static_cast<size_t>(read_bytes)) == "brake_balance=0.565\n");
+}
+
+TEST_CASE("Adapters stream native output to a sink", "[sink]") {
+    ORSF setup = create_sink_setup();
+
+    SECTION("Key-value adapter") {
+        KeyValueAdapter adapter;
+        std::string out;
+        StringSink sink(out);
+        adapter.write_native(setup, sink);
+
+        REQUIRE(out == "[Setup]\naero_front=4\nbrake_balance=0.565\n");
+        auto bytes = adapter.orsf_to_native(setup);
+        REQUIRE(std::string(bytes.begin(), bytes.end()) == out);
+    }
+
+    SECTION("ExampleAdapter streams the same bytes as orsf_to_native") {
+        ExampleAdapter adapter;
+        std::string out;
+        StringSink sink(out);
+        adapter.write_native(setup, sink);
+
+        auto bytes = adapter.orsf_to_native(setup);
+        REQUIRE(std::string(bytes.begin(), bytes.end()) == out);
+    }
+
+    SECTION("Default write_native bridges to orsf_to_native") {
+        struct VectorOnlyAdapter : KeyValueAdapter {
+            std::vector<uint8_t> orsf_to_native(const ORSF&) const override { return {'o', 'k'}; }
+            void write_native(const ORSF& orsf, OutputSink& sink) const override {
+                Adapter::write_native(orsf, sink);
+            }
+        };
+
+        VectorOnlyAdapter adapter;
+        std::string out;
+        StringSink sink(out);
+        adapter.write_native(setup, sink);
+        REQUIRE(out == "ok");
+    }
+}
+
+TEST_CASE("write_orsf_json streams the same text as to_json_string", "[sink]") {
+    ORSF setup = create_sink_setup();
+
+    for (int indent : {-1, 0, 2}) {
+        std::string out;
+        StringSink sink(out);
+        write_orsf_json(setup, sink, indent);
+        REQUIRE(out == setup.to_json_string(indent));
+    }
+}
+
+TEST_CASE("write_orsf_json passes sink errors to the caller", "[sink]") {
+    struct FailingSink : OutputSink {
+        size_t written = 0;
+        void write(const void*, size_t size) override {
+            if (written + size > 100) throw std::runtime_error("disk full");
+            written += size;
+        }
+        using OutputSink::write;
+    };
+
+    auto error_of = [](const std::function<void()>& write) {
+        try {
+            write();
+        } catch (const std::exception& e) {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+
+    ORSF setup = create_sink_setup();
+    setup.metadata.notes = std::string(20000, 'n');
+
+    for (int indent : {-1, 2}) {
+        FailingSink sink;
+        REQUIRE(error_of([&] { write_orsf_json(setup, sink, indent); }) == "disk full");
+    }
+
+    FailingSink sink;
+    REQUIRE(error_of([&] { ExampleAdapter().write_native(setup, sink); }) == "disk full");
+}
@@ -0,0 +1,261 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "orsf/orsf.hpp"
+#include <cstdio>
+#include <fstream>
+
+using namespace orsf;
+using Catch::Approx;
+
+namespace {
+
+const char* SPEC_JSON = R"({
+    "format": "orsf-adapter-spec/v1",
+    "id": "specsim",
+    "version": "2024.1",
+    "car_key": "gt3_992",
+    "description": "Spec-driven test adapter",
+    "file_extension": "cfg",
+    "signatures": [{"bytes": "; specsim setup", "offset": 0}],
+    "layout": {"separator": " = ", "header": ["; specsim setup"]},
+    "fields": [
+        {"orsf": "setup.brakes.brake_bias_pct", "native": "bias",
+         "to_native": [{"op": "percent_to_ratio"}], "to_orsf": [{"op": "ratio_to_percent"}]},
+        {"orsf": "setup.aero.front_wing", "native": "front_wing", "section": "aero", "required": true},
+        {"orsf": "setup.aero.rear_wing", "native": "rear_wing", "section": "aero",
+         "to_native": [{"op": "lookup", "table": [[0, 0], [10, 100]]}],
+         "to_orsf": [{"op": "reverse_lookup", "table": [[0, 0], [10, 100]]}]},
+        {"orsf": "setup.tires.pressure_fl_kpa", "native": "tyre_fl", "section": "tyres",
+         "to_native": [{"op": "unit", "from": "kpa", "to": "PSI"}, {"op": "round", "step": 0.5}],
+         "to_orsf": [{"op": "unit", "from": "psi", "to": "kpa"}]}
+    ]
+})";
+
+ORSF create_spec_setup() {
+    ORSF setup;
+    setup.metadata.id = "spec-test";
+    setup.metadata.name = "Spec Test";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    setup.setup.aero = Aerodynamics{};
+    setup.setup.aero->front_wing = 4.0;
+    setup.setup.aero->rear_wing = 5.0;
+    setup.setup.brakes = Brakes{};
+    setup.setup.brakes->brake_bias_pct = 56.0;
+    setup.setup.tires = Tires{};
+    setup.setup.tires->pressure_fl_kpa = 180.0;
+    return setup;
+}
+
+std::string native_text(const Adapter& adapter, const ORSF& setup) {
+    auto bytes = adapter.orsf_to_native(setup);
+    return std::string(bytes.begin(), bytes.end());
+}
+
+} // namespace
+
+TEST_CASE("MappingSpec parses JSON", "[spec]") {
+    MappingSpec spec = MappingSpec::from_json(std::string(SPEC_JSON));
+
+    REQUIRE(spec.metadata.id == "specsim");
+    REQUIRE(spec.metadata.car_key == "gt3_992");
+    REQUIRE(spec.file_extension == "cfg");
+    REQUIRE(spec.signatures.size() == 1);
+    REQUIRE(spec.signatures[0].offset == std::optional<size_t>(0));
+    REQUIRE(spec.layout.separator == " = ");
+    REQUIRE(spec.fields.size() == 4);
+    REQUIRE(spec.fields[1].required);
+    REQUIRE(spec.fields[3].to_native.size() == 2);
+    REQUIRE(spec.fields[3].to_native[0].op == TransformOp::UnitConvert);
+    REQUIRE(spec.fields[3].to_native[0].to_unit == Unit::PSI);
+}
+
+TEST_CASE("MappingSpec JSON round trip", "[spec]") {
+    MappingSpec spec = MappingSpec::from_json(std::string(SPEC_JSON));
+    MappingSpec copy = MappingSpec::from_json(spec.to_json());
+    REQUIRE(copy == spec);
+}
+
+TEST_CASE("MappingSpec binary round trip", "[spec]") {
+    MappingSpec first = MappingSpec::from_json(std::string(SPEC_JSON));
+    MappingSpec second = first;
+    second.metadata.car_key = "m4_gt3";
+    second.signatures.clear();
+    second.layout.header.clear();
+
+    ByteBuffer out;
+    MappingSpec::encode_binary({first, second}, out);
+
+    auto specs = MappingSpec::decode_binary(out.span());
+    REQUIRE(specs.size() == 2);
+    REQUIRE(specs[0] == first);
+    REQUIRE(specs[1] == second);
+}
+
+TEST_CASE("MappingSpec rejects malformed binary bundles", "[spec]") {
+    MappingSpec spec = MappingSpec::from_json(std::string(SPEC_JSON));
+    ByteBuffer out;
+    MappingSpec::encode_binary({spec}, out);
+
+    REQUIRE_THROWS_AS(MappingSpec::decode_binary(ByteSpan(std::string_view("not a bundle"))), std::runtime_error);
+
+    for (size_t size : {size_t(8), size_t(12), out.size() / 2, out.size() - 1}) {
+        REQUIRE_THROWS_AS(MappingSpec::decode_binary(out.span().subspan(0, size)), std::runtime_error);
+    }
+}
+
+TEST_CASE("MappingSpec validation", "[spec]") {
+    auto with_fields = [](const std::string& fields) {
+        return std::string(R"({"format": "orsf-adapter-spec/v1", "id": "x", "version": "1", "car_key": "c", "fields": )") +
+               fields + "}";
+    };
+
+    REQUIRE_NOTHROW(MappingSpec::from_json(with_fields(R"([{"orsf": "setup.aero.front_wing", "native": "fw"}])")));
+
+    // Unknown ORSF field
+    REQUIRE_THROWS_AS(MappingSpec::from_json(with_fields(R"([{"orsf": "setup.aero.front_wng", "native": "fw"}])")),
+                      std::runtime_error);
+
+    // Duplicate native key
+    REQUIRE_THROWS_AS(MappingSpec::from_json(with_fields(
+        R"([{"orsf": "setup.aero.front_wing", "native": "w"}, {"orsf": "setup.aero.rear_wing", "native": "w"}])")),
+        std::runtime_error);
+
+    // Unknown op and unit
+    REQUIRE_THROWS_AS(MappingSpec::from_json(with_fields(
+        R"([{"orsf": "setup.aero.front_wing", "native": "fw", "to_native": [{"op": "sqrt"}]}])")),
+        std::runtime_error);
+    REQUIRE_THROWS_AS(MappingSpec::from_json(with_fields(
+        R"([{"orsf": "setup.aero.front_wing", "native": "fw", "to_native": [{"op": "unit", "from": "kpa", "to": "atm"}]}])")),
+        std::runtime_error);
+
+    // Unit conversion across quantities, clamp with min > max
+    REQUIRE_THROWS_AS(MappingSpec::from_json(with_fields(
+        R"([{"orsf": "setup.aero.front_wing", "native": "fw", "to_native": [{"op": "unit", "from": "kpa", "to": "mm"}]}])")),
+        std::runtime_error);
+    REQUIRE_NOTHROW(MappingSpec::from_json(with_fields(
+        R"([{"orsf": "setup.aero.front_wing", "native": "fw", "to_native": [{"op": "unit", "from": "kpa", "to": "psi"}]}])")));
+    REQUIRE_THROWS_AS(MappingSpec::from_json(with_fields(
+        R"([{"orsf": "setup.aero.front_wing", "native": "fw", "to_native": [{"op": "clamp", "min": 10, "max": 0}]}])")),
+        std::runtime_error);
+
+    // Missing operand, wrong format tag, invalid JSON
+    REQUIRE_THROWS_AS(MappingSpec::from_json(with_fields(
+        R"([{"orsf": "setup.aero.front_wing", "native": "fw", "to_native": [{"op": "scale"}]}])")),
+        std::runtime_error);
+    REQUIRE_THROWS_AS(MappingSpec::from_json(std::string(R"({"format": "v0", "id": "x", "version": "1", "car_key": "c", "fields": []})")),
+                      std::runtime_error);
+    REQUIRE_THROWS_AS(MappingSpec::from_json(std::string("{")), std::runtime_error);
+}
+
+TEST_CASE("SpecAdapter writes the spec text layout", "[spec]") {
+    SpecAdapter adapter(MappingSpec::from_json(std::string(SPEC_JSON)));
+
+    // 180 kPa = 26.1 psi, rounded to 26
+    REQUIRE(native_text(adapter, create_spec_setup()) ==
+        "; specsim setup\n"
+        "bias = 0.56\n"
+        "[aero]\n"
+        "front_wing = 4\n"
+        "rear_wing = 50\n"
+        "[tyres]\n"
+        "tyre_fl = 26\n");
+
+    REQUIRE(adapter.get_suggested_filename() == "setup.cfg");
+    REQUIRE(adapter.get_file_extension() == "cfg");
+    REQUIRE(adapter.id() == "specsim");
+}
+
+TEST_CASE("SpecAdapter reads native text", "[spec]") {
+    SpecAdapter adapter(MappingSpec::from_json(std::string(SPEC_JSON)));
+    ORSF original = create_spec_setup();
+
+    std::string text = native_text(adapter, original);
+    ORSF parsed = adapter.decode_native(ByteSpan(std::string_view(text)));
+    REQUIRE(parsed.setup.aero->front_wing == Approx(4.0));
+    REQUIRE(parsed.setup.aero->rear_wing == Approx(5.0));
+    REQUIRE(parsed.setup.brakes->brake_bias_pct == Approx(56.0));
+    REQUIRE(parsed.setup.tires->pressure_fl_kpa == Approx(26.0 * 6.89476));
+
+    std::string edited = "# comment\n[aero]\n  front_wing =  6.5 \r\nunknown = 1\nno separator\n";
+    FlatSetup flat = adapter.parse_native(ByteSpan(edited));
+    REQUIRE(flat.at("front_wing") == 6.5);
+    REQUIRE(flat.size() == 2);
+
+    std::string invalid = "front_wing = wide\n";
+    REQUIRE_THROWS_AS(adapter.decode_native(ByteSpan(invalid)), std::runtime_error);
+
+    // front_wing is required
+    std::string missing = "bias = 0.5\n";
+    REQUIRE_THROWS_AS(adapter.decode_native(ByteSpan(missing)), std::runtime_error);
+}
+
+TEST_CASE("SpecAdapter matches hand-written mappings", "[spec]") {
+    SpecAdapter adapter(MappingSpec::from_json(std::string(SPEC_JSON)));
+    std::vector<FieldMapping> mappings = {
+        FieldMapping("setup.brakes.brake_bias_pct", "bias", Transform::percent_to_ratio(), Transform::ratio_to_percent()),
+        FieldMapping("setup.aero.front_wing", "front_wing", std::nullopt, std::nullopt, true),
+        FieldMapping("setup.aero.rear_wing", "rear_wing",
+            Transform::lookup_table(LookupTableConverter({{0, 0}, {10, 100}}))),
+    };
+
+    FlatSetup expected = MappingEngine::map_to_native(create_spec_setup(), mappings);
+    FlatSetup actual = adapter.mapping_plan()->to_native(create_spec_setup());
+    for (const auto& [key, value] : expected) {
+        REQUIRE(actual.at(key) == Approx(value));
+    }
+}
+
+TEST_CASE("SpecAdapter loads JSON arrays and binary bundles", "[spec]") {
+    MappingSpec spec = MappingSpec::from_json(std::string(SPEC_JSON));
+    MappingSpec other = spec;
+    other.metadata.car_key = "m4_gt3";
+
+    std::string array = json::array({spec.to_json(), other.to_json()}).dump();
+    auto from_json = SpecAdapter::load(ByteSpan(array));
+    REQUIRE(from_json.size() == 2);
+    REQUIRE(from_json[1]->get_car_key() == "m4_gt3");
+
+    ByteBuffer bundle;
+    MappingSpec::encode_binary({spec, other}, bundle);
+    auto from_binary = SpecAdapter::load(bundle.span());
+    REQUIRE(from_binary.size() == 2);
+    REQUIRE(native_text(*from_binary[0], create_spec_setup()) == native_text(*from_json[0], create_spec_setup()));
+
+    std::string path = "orsf_test_specs.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bundle.data()), static_cast<std::streamsize>(bundle.size()));
+    }
+    REQUIRE(SpecAdapter::load_file(path).size() == 2);
+    std::remove(path.c_str());
+
+    REQUIRE_THROWS_AS(SpecAdapter::load_file("missing_spec_file.json"), std::runtime_error);
+}
+
+TEST_CASE("SpecAdapters register, resolve and detect", "[spec]") {
+    MappingSpec base = MappingSpec::from_json(std::string(SPEC_JSON));
+    std::vector<MappingSpec> specs;
+    for (int i = 0; i < 1000; ++i) {
+        MappingSpec spec = base;
+        spec.metadata.car_key = "car_" + std::to_string(i);
+        specs.push_back(std::move(spec));
+    }
+
+    ByteBuffer bundle;
+    MappingSpec::encode_binary(specs, bundle);
+
+    AdapterRegistry registry;
+    registry.register_adapters(SpecAdapter::load(bundle.span()));
+    REQUIRE(registry.get_all_adapters().size() == 1000);
+
+    auto adapter = registry.resolve("specsim", "2024.1", "car_417");
+    REQUIRE(adapter != nullptr);
+    REQUIRE(adapter->get_car_key() == "car_417");
+
+    std::string text = native_text(*adapter, create_spec_setup());
+    auto detected = registry.detect(ByteSpan(text), "monza.cfg");
+    REQUIRE(detected != nullptr);
+    REQUIRE(detected->get_id() == "specsim");
+}
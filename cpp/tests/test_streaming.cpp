@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <algorithm>
+
+using namespace orsf;
+
+namespace {
+
+ORSF create_streaming_setup() {
+    ORSF setup;
+    setup.metadata.id = "stream-1";
+    setup.metadata.name = "Streaming Setup";
+    setup.metadata.created_at = "2024-01-01T12:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    return setup;
+}
+
+// Sorted "field|code|message" keys (streaming reports in document order)
+std::vector<std::string> error_keys(const std::vector<ValidationError>& errors) {
+    std::vector<std::string> keys;
+    for (const auto& error : errors) {
+        keys.push_back(error.to_string() + "|" + std::to_string(static_cast<int>(error.code)));
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+} // namespace
+
+TEST_CASE("StreamingValidator accepts valid ORSF", "[streaming]") {
+    auto result = StreamingValidator::validate(create_streaming_setup().to_json_string());
+    REQUIRE(result.complete);
+    REQUIRE(result.errors.empty());
+    REQUIRE(result.is_valid());
+}
+
+TEST_CASE("StreamingValidator reports the same findings as Validator", "[streaming]") {
+    ORSF setup = create_streaming_setup();
+    setup.metadata.updated_at = "2023-01-01";
+    setup.car.car_class = "Kart";
+    setup.context = Context{};
+    setup.context->ambient_temp_c = 30.0;
+    setup.context->track_temp_c = 10.0;
+    setup.context->rubber = "sticky";
+    setup.setup.suspension = Suspension{};
+    setup.setup.suspension->rear_left = CornerSuspension{};
+    setup.setup.suspension->rear_left->camber_deg = -12.0;
+    setup.setup.suspension->rear_left->spring_rate_n_mm = 0.0;
+    setup.setup.tires = Tires{};
+    setup.setup.tires->pressure_rr_kpa = 20.0;
+    setup.setup.gearing = Gearing{};
+    setup.setup.gearing->gear_ratios = std::vector<double>{3.1, -2.0, 1.5};
+    setup.setup.drivetrain = Drivetrain{};
+    setup.setup.drivetrain->lsd_clutch_plates = 0;
+    setup.setup.fuel = Fuel{};
+    setup.setup.fuel->stint_target_laps = -1;
+
+    auto result = StreamingValidator::validate(setup.to_json_string(2));
+    REQUIRE(result.complete);
+    REQUIRE(error_keys(result.errors) == error_keys(Validator::validate(setup)));
+}
+
+TEST_CASE("StreamingValidator reports missing required sections", "[streaming]") {
+    auto result = StreamingValidator::validate(R"({"schema": "orsf://v1"})");
+    REQUIRE(result.complete);
+
+    std::vector<std::string> fields;
+    for (const auto& error : result.errors) {
+        REQUIRE(error.code == ValidationCode::Required);
+        fields.push_back(error.field);
+    }
+    REQUIRE(fields == std::vector<std::string>{
+        "metadata.id", "metadata.name", "metadata.created_at", "car.make", "car.model"});
+}
+
+TEST_CASE("StreamingValidator stops early", "[streaming]") {
+    ORSF setup = create_streaming_setup();
+    setup.setup.brakes = Brakes{};
+    setup.setup.brakes->brake_bias_pct = 150.0;
+    setup.setup.fuel = Fuel{};
+    setup.setup.fuel->per_lap_consumption_l = -1.0;
+
+    std::string text = setup.to_json_string();
+
+    StreamingValidationOptions options;
+    options.stop_on_error = true;
+    auto result = StreamingValidator::validate(text, options);
+
+    REQUIRE_FALSE(result.complete);
+    REQUIRE(result.errors.size() == 1);
+    REQUIRE(result.errors[0].field == "setup.brakes.brake_bias_pct");
+    REQUIRE(result.bytes_scanned < text.size());
+}
+
+TEST_CASE("StreamingValidator reports malformed input", "[streaming]") {
+    SECTION("Syntax error") {
+        auto result = StreamingValidator::validate(R"({"metadata": {"id": )");
+        REQUIRE(result.syntax_error);
+        REQUIRE_FALSE(result.complete);
+        REQUIRE_FALSE(result.is_valid());
+    }
+
+    SECTION("Wrong value type") {
+        auto result = StreamingValidator::validate(
+            R"({"setup": {"tires": {"pressure_fl_kpa": "high"}}})");
+        REQUIRE(result.complete);
+        bool found = false;
+        for (const auto& error : result.errors) {
+            if (error.field == "setup.tires.pressure_fl_kpa" &&
+                error.code == ValidationCode::InvalidFormat) {
+                found = true;
+            }
+        }
+        REQUIRE(found);
+    }
+}
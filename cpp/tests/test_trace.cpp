@@ -0,0 +1,177 @@
+#include <catch2/catch_test_macros.hpp>
+#include "orsf/orsf.hpp"
+#include <map>
+#include <set>
+#include <thread>
+
+using namespace orsf;
+
+namespace {
+
+/// Registers a tracer for the lifetime of a test
+class TracerScope {
+public:
+    explicit TracerScope(TraceOptions options = {}) : tracer_(std::make_shared<Tracer>(options)) {
+        Instrumentation::add_sink(tracer_);
+    }
+    ~TracerScope() { Instrumentation::remove_sink(tracer_); }
+
+    Tracer& operator*() const { return *tracer_; }
+    Tracer* operator->() const { return tracer_.get(); }
+
+private:
+    std::shared_ptr<Tracer> tracer_;
+};
+
+std::vector<json> complete_events(const Tracer& tracer) {
+    json trace = json::parse(tracer.to_json_string());
+    std::vector<json> events;
+    for (const auto& event : trace.at("traceEvents")) {
+        if (event.at("ph") == "X") events.push_back(event);
+    }
+    return events;
+}
+
+} // namespace
+
+TEST_CASE("Tracer exports Chrome trace events", "[trace]") {
+    TracerScope tracer;
+
+    {
+        ScopedItem item(17);
+        ScopedStage encode(Stage::AdapterEncode);
+        encode.add_bytes(42);
+        ScopedStage lookup(Stage::LookupTable);
+    }
+    { ScopedStage parse(Stage::Parse); }
+
+    json trace = json::parse(tracer->to_json_string());
+    REQUIRE(trace["displayTimeUnit"] == "ns");
+    REQUIRE(trace["otherData"]["recorded"] == 3);
+
+    auto events = complete_events(*tracer);
+    REQUIRE(events.size() == 3);
+
+    // Inner stages end first
+    REQUIRE(events[0]["name"] == "lookup_table");
+    REQUIRE(events[1]["name"] == "adapter_encode");
+    REQUIRE(events[1]["cat"] == "orsf");
+    REQUIRE(events[1]["args"]["setup"] == 17);
+    REQUIRE(events[1]["args"]["bytes"] == 42);
+    REQUIRE(events[1]["ts"].get<double>() <= events[0]["ts"].get<double>());
+    REQUIRE(events[1]["dur"].get<double>() >= events[0]["dur"].get<double>());
+    REQUIRE_FALSE(events[2]["args"].contains("setup"));
+
+    bool named = false;
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["ph"] == "M" && event["name"] == "thread_name") named = true;
+    }
+    REQUIRE(named);
+}
+
+TEST_CASE("Tracer rings keep the newest events per thread", "[trace]") {
+    TraceOptions options;
+    options.events_per_thread = 4;
+    TracerScope tracer(options);
+
+    for (uint64_t i = 0; i < 10; ++i) {
+        ScopedItem item(i);
+        ScopedStage stage(Stage::Validate);
+    }
+
+    TraceStats stats = tracer->stats();
+    REQUIRE(stats.recorded == 10);
+    REQUIRE(stats.overwritten == 6);
+    REQUIRE(stats.retained() == 4);
+    REQUIRE(stats.threads == 1);
+
+    auto events = complete_events(*tracer);
+    REQUIRE(events.size() == 4);
+    for (size_t i = 0; i < events.size(); ++i) {
+        REQUIRE(events[i]["args"]["setup"] == 6 + i);
+    }
+
+    tracer->clear();
+    REQUIRE(tracer->stats().recorded == 0);
+    REQUIRE(complete_events(*tracer).empty());
+}
+
+TEST_CASE("Tracer samples by item and duration", "[trace]") {
+    TraceOptions options;
+    options.sample_every = 4;
+    options.keep_untagged = false;
+    TracerScope tracer(options);
+
+    for (uint64_t i = 0; i < 12; ++i) {
+        ScopedItem item(i);
+        ScopedStage map(Stage::MapToNative);
+        ScopedStage lookup(Stage::LookupTable);
+    }
+    { ScopedStage untagged(Stage::Parse); }
+
+    auto events = complete_events(*tracer);
+    REQUIRE(events.size() == 6);
+    for (const auto& event : events) {
+        REQUIRE(event["args"]["setup"].get<uint64_t>() % 4 == 0);
+    }
+    REQUIRE(tracer->stats().sampled_out == 19);
+
+    options = TraceOptions{};
+    options.min_duration = std::chrono::hours(1);
+    TracerScope slow_only(options);
+    { ScopedStage stage(Stage::Parse); }
+    REQUIRE(slow_only->stats().recorded == 0);
+    REQUIRE(slow_only->stats().sampled_out == 1);
+}
+
+TEST_CASE("Tracer separates threads", "[trace]") {
+    TracerScope tracer;
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < 3; ++t) {
+        threads.emplace_back([t] {
+            for (uint64_t i = 0; i < 5; ++i) {
+                ScopedItem item(t * 100 + i);
+                ScopedStage stage(Stage::AdapterDecode);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    REQUIRE(tracer->stats().threads == 3);
+
+    // Each trace thread holds the setups of exactly one worker
+    std::map<int, std::set<uint64_t>> workers_by_tid;
+    auto events = complete_events(*tracer);
+    REQUIRE(events.size() == 15);
+    for (const auto& event : events) {
+        workers_by_tid[event["tid"].get<int>()].insert(event["args"]["setup"].get<uint64_t>() / 100);
+    }
+    REQUIRE(workers_by_tid.size() == 3);
+    for (const auto& entry : workers_by_tid) {
+        REQUIRE(entry.second.size() == 1);
+    }
+}
+
+#ifdef ORSF_ENABLE_INSTRUMENTATION
+TEST_CASE("Tracer tags batch conversions by setup", "[trace]") {
+    ORSF setup;
+    setup.metadata.id = "traced";
+    setup.metadata.name = "Traced";
+    setup.metadata.created_at = "2024-01-01T00:00:00Z";
+    setup.car.make = "Porsche";
+    setup.car.model = "911 GT3 R";
+    std::vector<ORSF> setups(3, setup);
+    std::vector<std::shared_ptr<Adapter>> adapters = {std::make_shared<ExampleAdapter>()};
+
+    TracerScope tracer;
+    InlineExecutor executor;
+    convert_batch(setups, adapters, executor);
+
+    std::set<uint64_t> traced;
+    for (const auto& event : complete_events(*tracer)) {
+        if (event["name"] == "adapter_encode") traced.insert(event["args"]["setup"].get<uint64_t>());
+    }
+    REQUIRE(traced == std::set<uint64_t>{0, 1, 2});
+}
+#endif
@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "orsf/orsf.hpp"
+
+using namespace orsf;
+using Catch::Approx;
+
+namespace {
+
+std::shared_ptr<const MappingPlan> sim_a_plan() {
+    return std::make_shared<const MappingPlan>(std::vector<FieldMapping>{
+        FieldMapping("setup.aero.front_wing", "FrontWing",
+            Transform::scale(0.5), Transform::scale(2.0), false),
+        FieldMapping("setup.tires.pressure_fl_kpa", "PressureFL",
+            Transform::unit_convert(Unit::KPA, Unit::PSI), Transform::unit_convert(Unit::PSI, Unit::KPA), false),
+        FieldMapping("setup.brakes.brake_bias_pct", "BrakeBias",
+            Transform::percent_to_ratio(), Transform::ratio_to_percent(), false),
+        FieldMapping("setup.electronics.tc_level", "TC"),
+    });
+}
+
+std::shared_ptr<const MappingPlan> sim_b_plan() {
+    return std::make_shared<const MappingPlan>(std::vector<FieldMapping>{
+        FieldMapping("setup.aero.front_wing", "wing_front"),
+        FieldMapping("setup.tires.pressure_fl_kpa", "tyre_fl_bar",
+            Transform::unit_convert(Unit::KPA, Unit::BAR), Transform::unit_convert(Unit::BAR, Unit::KPA), false),
+        FieldMapping("setup.brakes.brake_bias_pct", "bias_pct"),
+        FieldMapping("setup.electronics.tc_level", "traction_control"),
+        FieldMapping("setup.aero.rear_wing", "wing_rear"),
+    });
+}
+
+ORSF template_setup() {
+    ORSF setup;
+    setup.setup.aero = Aerodynamics{};
+    setup.setup.aero->rear_wing = 7.0;
+    setup.setup.electronics = Electronics{};
+    setup.setup.electronics->tc_level = 3;
+    return setup;
+}
+
+void require_same(const FlatSetup& actual, const FlatSetup& expected) {
+    REQUIRE(actual.size() == expected.size());
+    for (const auto& [key, value] : expected) {
+        REQUIRE(actual.count(key) == 1);
+        REQUIRE(actual.at(key) == Approx(value).margin(1e-9));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Transcoder matches the ORSF pivot", "[transcode]") {
+    auto from = sim_a_plan();
+    auto to = sim_b_plan();
+    Transcoder transcoder(from, to);
+    ORSF tmpl = template_setup();
+
+    FlatSetup native = {{"FrontWing", 2.5}, {"PressureFL", 26.5}, {"BrakeBias", 0.56}, {"TC", 4.0}};
+    FlatSetup expected = to->to_native(from->to_orsf(native, tmpl));
+
+    require_same(transcoder.transcode(native, tmpl), expected);
+    REQUIRE(transcoder.transcode(native, tmpl).at("wing_front") == Approx(5.0).margin(1e-9));
+}
+
+TEST_CASE("Transcoder fuses round-trippable fields only", "[transcode]") {
+    Transcoder transcoder(sim_a_plan(), sim_b_plan());
+
+    // electronics.tc_level is stored as an int and is read from the pivot
+    REQUIRE(transcoder.pivot_count() == 1);
+    REQUIRE(transcoder.fused_count() == 4);
+}
+
+TEST_CASE("Transcoder reads unmapped and missing fields from the template", "[transcode]") {
+    auto from = sim_a_plan();
+    auto to = sim_b_plan();
+    Transcoder transcoder(from, to);
+    ORSF tmpl = template_setup();
+    tmpl.setup.brakes = Brakes{};
+    tmpl.setup.brakes->brake_bias_pct = 54.0;
+
+    FlatSetup native = {{"FrontWing", 1.0}};
+    FlatSetup out = transcoder.transcode(native, tmpl);
+
+    require_same(out, to->to_native(from->to_orsf(native, tmpl)));
+    REQUIRE(out.at("wing_rear") == Approx(7.0).margin(1e-9));
+    REQUIRE(out.at("bias_pct") == Approx(54.0).margin(1e-9));
+    REQUIRE(out.count("tyre_fl_bar") == 0);
+}
+
+TEST_CASE("Transcoder uses the last present source mapping", "[transcode]") {
+    auto from = std::make_shared<const MappingPlan>(std::vector<FieldMapping>{
+        FieldMapping("setup.aero.front_wing", "wing"),
+        FieldMapping("setup.aero.front_wing", "wing_legacy"),
+    });
+    auto to = std::make_shared<const MappingPlan>(std::vector<FieldMapping>{
+        FieldMapping("setup.aero.front_wing", "fw"),
+    });
+    Transcoder transcoder(from, to);
+
+    REQUIRE(transcoder.transcode({{"wing", 3.0}, {"wing_legacy", 4.0}}).at("fw") == 4.0);
+    REQUIRE(transcoder.transcode({{"wing", 3.0}}).at("fw") == 3.0);
+}
+
+TEST_CASE("Transcoder enforces required fields on both sides", "[transcode]") {
+    auto from = std::make_shared<const MappingPlan>(std::vector<FieldMapping>{
+        FieldMapping("setup.aero.front_wing", "wing", std::nullopt, std::nullopt, true),
+    });
+    auto to = std::make_shared<const MappingPlan>(std::vector<FieldMapping>{
+        FieldMapping("setup.aero.front_wing", "fw"),
+        FieldMapping("setup.brakes.brake_bias_pct", "bias", std::nullopt, std::nullopt, true),
+    });
+    Transcoder transcoder(from, to);
+
+    REQUIRE_THROWS_AS(transcoder.transcode({}), std::runtime_error);
+    REQUIRE_THROWS_AS(transcoder.transcode({{"wing", 2.0}}), std::runtime_error);
+
+    ORSF tmpl;
+    tmpl.setup.brakes = Brakes{};
+    tmpl.setup.brakes->brake_bias_pct = 55.0;
+    REQUIRE(transcoder.transcode({{"wing", 2.0}}, tmpl).at("bias") == 55.0);
+}
+
+TEST_CASE("Transcoder between BaseAdapters", "[transcode]") {
+    ExampleAdapter a;
+    ExampleAdapter b;
+    Transcoder transcoder(a, b);
+
+    REQUIRE(transcoder.fused_count() + transcoder.pivot_count() == b.get_field_mappings().size());
+}
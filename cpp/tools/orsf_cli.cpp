@@ -0,0 +1,772 @@
+#include "orsf/orsf.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+using namespace orsf;
+namespace fs = std::filesystem;
+
+/// orsf: batch command-line tool
+///
+/// Usage: orsf <command> [options] <inputs...>
+///
+/// Commands:
+///   validate              Validate setups; list Error findings (--warnings for all)
+///   convert --to ID       Convert with adapter ID (--version v, --car key);
+///                         more than one setup needs --out DIR
+///   normalize             Rewrite setups as canonical JSON (--indent n)
+///   stats                 Summarize setups as JSON (counts, classes, findings, sizes)
+///   pack --out FILE       Write setups into a .orsfpack archive (--raw keeps JSON as is)
+///   unpack                Expand entries to files (--out DIR) or NDJSON
+///   diff A B              Compare setups field by field, paired by name
+///
+/// Inputs are JSON files, NDJSON files (.ndjson/.jsonl, one setup per
+/// line), archives (.orsfpack), directories (searched recursively for
+/// those) or - for NDJSON on stdin. Output streams in input order.
+///
+/// Options:
+///   -j N                  Worker threads (default: hardware concurrency)
+///   --out PATH            Output file, or directory for per-setup files
+///   --progress            Report progress on stderr
+///   --quiet               No summary on stderr
+///   --spec FILE           Load SpecAdapters from a mapping spec (convert)
+///   --plugins DIR         Register adapter plugins from a directory (convert)
+///
+/// Exit codes: 0 success, 1 findings (invalid setups or differences),
+/// 2 usage error, 3 unreadable or unconvertible input.
+
+namespace {
+
+constexpr int EXIT_FINDINGS = 1;
+constexpr int EXIT_USAGE = 2;
+constexpr int EXIT_INPUT = 3;
+
+int usage(const std::string& problem) {
+    std::cerr << "orsf: " << problem << "\n"
+              << "Usage: orsf validate|convert|normalize|stats|pack|unpack|diff [options] <inputs...>\n"
+              << "  -j N, --out PATH, --progress, --quiet\n"
+              << "  validate [--warnings] [--format text|ndjson]\n"
+              << "  convert --to ID [--version v] [--car key] [--spec FILE] [--plugins DIR]\n"
+              << "  normalize [--indent n]\n"
+              << "  pack --out FILE [--raw]\n"
+              << "  diff A B\n";
+    return EXIT_USAGE;
+}
+
+struct Options {
+    std::string command;
+    std::vector<std::string> inputs;
+    size_t jobs = 0;
+    std::string out;
+    bool progress = false;
+    bool quiet = false;
+
+    bool warnings = false;
+    std::string format = "text";
+    std::string to;
+    std::string version;
+    std::string car;
+    std::vector<std::string> specs;
+    std::vector<std::string> plugin_dirs;
+    int indent = -1;
+    bool indent_set = false;
+    bool raw = false;
+};
+
+// ============================================================================
+// Inputs
+// ============================================================================
+
+/// One setup to process
+struct Record {
+    std::string name;       ///< Shown in messages ("dir/a.json", "runs.ndjson:12")
+    std::string key;        ///< Pairs records across inputs in diff
+    std::string stem;       ///< Base name for per-setup output files
+    std::string path;       ///< JSON file still to be read by a worker (empty if text is set)
+    std::string text;
+};
+
+bool has_extension(const fs::path& path, std::initializer_list<const char*> extensions) {
+    std::string extension = normalize_extension(file_extension(path.filename().string()));
+    for (const char* candidate : extensions) {
+        if (extension == candidate) return true;
+    }
+    return false;
+}
+
+bool is_ndjson(const fs::path& path) { return has_extension(path, {"ndjson", "jsonl"}); }
+bool is_archive(const fs::path& path) { return has_extension(path, {ArchiveWriter::EXTENSION}); }
+
+std::string read_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("cannot open " + path);
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) throw std::runtime_error("cannot read " + path);
+    return text;
+}
+
+std::string stem_of(std::string_view name) {
+    std::string stem = fs::path(std::string(name)).stem().string();
+    return stem.empty() ? "setup" : stem;
+}
+
+/// Reads records from all inputs in order, a chunk at a time
+///
+/// JSON files are only listed here and read by the workers; NDJSON lines
+/// and archive entries are read sequentially.
+class InputReader {
+public:
+    explicit InputReader(const std::vector<std::string>& inputs) {
+        for (const auto& input : inputs) {
+            if (input == "-" || !fs::is_directory(input)) {
+                sources_.push_back(Source{input, fs::path(input).filename().string()});
+                continue;
+            }
+
+            std::vector<fs::path> files;
+            for (const auto& entry : fs::recursive_directory_iterator(input)) {
+                const fs::path& path = entry.path();
+                if (entry.is_regular_file() && (has_extension(path, {"json"}) || is_ndjson(path) || is_archive(path))) {
+                    files.push_back(path);
+                }
+            }
+            std::sort(files.begin(), files.end());
+            for (const auto& file : files) {
+                sources_.push_back(Source{file.string(), file.lexically_relative(input).generic_string()});
+            }
+        }
+    }
+
+    /// Fill chunk with up to max records; false when all inputs are exhausted
+    bool next_chunk(std::vector<Record>& chunk, size_t max) {
+        chunk.clear();
+        while (chunk.size() < max) {
+            if (lines_) {
+                if (!next_line(chunk)) {
+                    lines_ = nullptr;
+                    owned_stream_.reset();
+                }
+                continue;
+            }
+            if (archive_) {
+                if (!next_entry(chunk)) archive_.reset();
+                continue;
+            }
+            if (next_source_ >= sources_.size()) break;
+            open(sources_[next_source_++], chunk);
+        }
+        return !chunk.empty();
+    }
+
+private:
+    struct Source {
+        std::string path;
+        std::string key;
+    };
+
+    std::vector<Source> sources_;
+    size_t next_source_ = 0;
+
+    Source current_;
+    std::unique_ptr<std::istream> owned_stream_;
+    std::istream* lines_ = nullptr;
+    uint64_t line_number_ = 0;
+    std::string archive_data_;
+    std::unique_ptr<ArchiveReader> archive_;
+
+    void open(const Source& source, std::vector<Record>& chunk) {
+        current_ = source;
+        line_number_ = 0;
+
+        if (source.path == "-") {
+            lines_ = &std::cin;
+            return;
+        }
+        if (is_ndjson(source.path)) {
+            auto stream = std::make_unique<std::ifstream>(source.path, std::ios::binary);
+            if (!*stream) throw std::runtime_error("cannot open " + source.path);
+            owned_stream_ = std::move(stream);
+            lines_ = owned_stream_.get();
+            return;
+        }
+        if (is_archive(source.path)) {
+            archive_data_ = read_file(source.path);
+            archive_ = std::make_unique<ArchiveReader>(ByteSpan(std::string_view(archive_data_)));
+            return;
+        }
+
+        Record record;
+        record.name = source.path;
+        record.key = source.key;
+        record.stem = stem_of(source.key);
+        record.path = source.path;
+        chunk.push_back(std::move(record));
+    }
+
+    bool next_line(std::vector<Record>& chunk) {
+        std::string line;
+        while (std::getline(*lines_, line)) {
+            ++line_number_;
+            if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+
+            Record record;
+            record.name = current_.path + ":" + std::to_string(line_number_);
+            // "runs/a.ndjson" line 12 packs and unpacks as "runs/a-12.json"
+            record.stem = stem_of(current_.key) + "-" + std::to_string(line_number_);
+            record.key = (fs::path(current_.key).parent_path() / (record.stem + ".json")).generic_string();
+            record.text = std::move(line);
+            chunk.push_back(std::move(record));
+            return true;
+        }
+        if (lines_->bad()) throw std::runtime_error("cannot read " + current_.path);
+        return false;
+    }
+
+    bool next_entry(std::vector<Record>& chunk) {
+        ArchiveEntry entry;
+        if (!archive_->next(entry)) return false;
+
+        Record record;
+        record.name = current_.path + ":" + std::string(entry.name);
+        record.key = std::string(entry.name);
+        record.stem = stem_of(entry.name);
+        record.text = std::string(entry.json);
+        chunk.push_back(std::move(record));
+        return true;
+    }
+};
+
+// ============================================================================
+// Output
+// ============================================================================
+
+/// Stdout or a file, as an OutputSink
+class Output {
+public:
+    explicit Output(const std::string& path) {
+        if (path.empty() || path == "-") {
+            sink_ = std::make_unique<FdSink>(1);
+            return;
+        }
+        file_.open(path, std::ios::binary);
+        if (!file_) throw std::runtime_error("cannot open " + path);
+        sink_ = std::make_unique<CallbackSink>([this, path](const uint8_t* data, size_t size) {
+            if (!file_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size))) {
+                throw std::runtime_error("cannot write " + path);
+            }
+        });
+    }
+
+    OutputSink& sink() { return *sink_; }
+
+private:
+    std::ofstream file_;
+    std::unique_ptr<OutputSink> sink_;
+};
+
+void write_file(const fs::path& path, std::string_view data) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+        throw std::runtime_error("cannot write " + path.string());
+    }
+}
+
+// ============================================================================
+// Pipeline
+// ============================================================================
+
+/// Result of processing one record on a worker
+struct Outcome {
+    std::string output;     ///< Written to the output stream in input order
+    std::string error;      ///< Input or conversion error (exit code 3)
+    bool finding = false;   ///< Invalid setup or difference (exit code 1)
+    uint64_t bytes = 0;     ///< Input bytes
+    json summary;           ///< Per-record data for commands that aggregate
+};
+
+struct Totals {
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+    uint64_t findings = 0;
+    uint64_t errors = 0;
+};
+
+using Process = std::function<void(Record& record, Outcome& outcome)>;
+using Consume = std::function<void(const Record& record, Outcome& outcome)>;
+
+/// Run process on every record in parallel and consume the outcomes in order
+///
+/// Records go through in chunks so memory stays bounded however large the
+/// input; the pool's range stealing balances uneven setups within a chunk.
+Totals run_pipeline(const Options& options, const std::vector<std::string>& inputs,
+                    const Process& process, const Consume& consume) {
+    InputReader reader(inputs);
+    ThreadPoolExecutor pool(options.jobs);
+    const size_t chunk_size = 256 * pool.concurrency();
+    const auto start = std::chrono::steady_clock::now();
+
+    Totals totals;
+    std::vector<Record> chunk;
+    std::vector<Outcome> outcomes;
+    auto report = [&](const char* end) {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double rate = seconds > 0.0 ? static_cast<double>(totals.records) / seconds : 0.0;
+        double mb = static_cast<double>(totals.bytes) / 1e6;
+        std::fprintf(stderr, "\r%llu setups, %.1f MB in %.2f s: %.0f setups/s, %.1f MB/s%s",
+                     static_cast<unsigned long long>(totals.records), mb, seconds, rate,
+                     seconds > 0.0 ? mb / seconds : 0.0, end);
+    };
+
+    while (reader.next_chunk(chunk, chunk_size)) {
+        outcomes.assign(chunk.size(), Outcome{});
+        pool.parallel_for(chunk.size(), [&](size_t index, size_t) {
+            Record& record = chunk[index];
+            Outcome& outcome = outcomes[index];
+            try {
+                if (!record.path.empty()) record.text = read_file(record.path);
+                outcome.bytes = record.text.size();
+                process(record, outcome);
+            } catch (const std::exception& e) {
+                outcome.error = e.what();
+            }
+        });
+
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            Outcome& outcome = outcomes[i];
+            if (!outcome.error.empty()) {
+                std::cerr << chunk[i].name << ": " << outcome.error << "\n";
+                ++totals.errors;
+            }
+            if (outcome.finding) ++totals.findings;
+            ++totals.records;
+            totals.bytes += outcome.bytes;
+            consume(chunk[i], outcome);
+        }
+        if (options.progress) report("");
+    }
+
+    if (!options.quiet) {
+        report("\n");
+        std::fprintf(stderr, "%llu with findings, %llu failed\n",
+                     static_cast<unsigned long long>(totals.findings), static_cast<unsigned long long>(totals.errors));
+    }
+    return totals;
+}
+
+const char* severity_name(ValidationSeverity severity) {
+    switch (severity) {
+        case ValidationSeverity::Error:   return "error";
+        case ValidationSeverity::Warning: return "warning";
+        case ValidationSeverity::Info:    return "info";
+    }
+    return "unknown";
+}
+
+int exit_code(const Totals& totals) {
+    if (totals.errors > 0) return EXIT_INPUT;
+    return totals.findings > 0 ? EXIT_FINDINGS : 0;
+}
+
+/// Per-setup output files go to --out when it is a directory
+bool output_to_directory(const Options& options) {
+    if (options.out.empty() || options.out == "-") return false;
+    if (fs::is_directory(options.out)) return true;
+    if (options.out.back() != '/') return false;
+    fs::create_directories(options.out);
+    return true;
+}
+
+// ============================================================================
+// Commands
+// ============================================================================
+
+int run_validate(const Options& options) {
+    Output out(options.out);
+    const bool ndjson = options.format == "ndjson";
+
+    auto totals = run_pipeline(options, options.inputs, [&](Record& record, Outcome& outcome) {
+        auto errors = Validator::validate(ORSF::from_json(record.text));
+
+        json list = json::array();
+        for (const auto& error : errors) {
+            bool is_error = error.severity == ValidationSeverity::Error;
+            outcome.finding = outcome.finding || is_error;
+            if (!is_error && !options.warnings) continue;
+
+            if (ndjson) {
+                list.push_back({{"severity", severity_name(error.severity)}, {"path", error.field}, {"message", error.message}});
+            } else {
+                outcome.output += record.name + ": " + severity_name(error.severity) + " " + error.field + ": " + error.message + "\n";
+            }
+        }
+        if (ndjson) {
+            outcome.output = json{{"name", record.name}, {"valid", !outcome.finding}, {"findings", list}}.dump() + "\n";
+        }
+    }, [&](const Record& record, Outcome& outcome) {
+        if (ndjson && !outcome.error.empty()) {
+            outcome.output = json{{"name", record.name}, {"error", outcome.error}}.dump() + "\n";
+        }
+        out.sink().write(outcome.output);
+    });
+    out.sink().flush();
+    return exit_code(totals);
+}
+
+int run_convert(const Options& options) {
+    if (options.to.empty()) return usage("convert needs --to <adapter>");
+
+    AdapterRegistry registry;
+    registry.register_static_adapters();
+    registry.register_adapter(std::make_shared<ExampleAdapter>());
+    for (const auto& spec : options.specs) registry.register_adapters(SpecAdapter::load_file(spec));
+    for (const auto& directory : options.plugin_dirs) registry.register_plugins(directory);
+
+    auto adapter = registry.resolve(options.to, options.version, options.car);
+    if (!adapter) {
+        std::cerr << "orsf: no adapter " << options.to << "; available:";
+        for (const auto& candidate : registry.get_all_adapters()) {
+            std::cerr << " " << candidate->get_id() << "@" << candidate->get_version() << "/" << candidate->get_car_key();
+        }
+        std::cerr << "\n";
+        return EXIT_USAGE;
+    }
+
+    const bool to_directory = output_to_directory(options);
+    const std::string extension = adapter->get_file_extension();
+
+    // Native files have no framing, so without a directory the output is one
+    // setup, written once the input is known to hold no other
+    std::atomic<bool> several{false};
+    std::string single;
+    uint64_t records = 0;
+
+    auto totals = run_pipeline(options, options.inputs, [&](Record& record, Outcome& outcome) {
+        if (several.load(std::memory_order_relaxed)) return;
+        ORSF setup = ORSF::from_json(record.text);
+        ByteBuffer native;
+        adapter->encode_native(setup, native);
+
+        if (to_directory) {
+            write_file(fs::path(options.out) / (record.stem + "." + extension), native.span().as_chars());
+        } else {
+            outcome.output.assign(native.span().as_chars());
+        }
+    }, [&](const Record&, Outcome& outcome) {
+        if (to_directory) return;
+        if (++records > 1) {
+            several.store(true, std::memory_order_relaxed);
+            return;
+        }
+        single = std::move(outcome.output);
+    });
+
+    if (several) return usage("convert writes one native file per setup; use --out DIR for more than one setup");
+    if (!to_directory) {
+        Output out(options.out);
+        out.sink().write(single);
+        out.sink().flush();
+    }
+    return exit_code(totals);
+}
+
+int run_normalize(const Options& options) {
+    const bool to_directory = output_to_directory(options);
+    const int indent = options.indent_set ? options.indent : (to_directory ? 2 : -1);
+    std::unique_ptr<Output> out;
+    if (!to_directory) out = std::make_unique<Output>(options.out);
+
+    auto totals = run_pipeline(options, options.inputs, [&](Record& record, Outcome& outcome) {
+        std::string text = ORSF::from_json(record.text).to_json_string(indent);
+        text.push_back('\n');
+        if (to_directory) {
+            write_file(fs::path(options.out) / (record.stem + ".json"), text);
+        } else {
+            outcome.output = std::move(text);
+        }
+    }, [&](const Record&, Outcome& outcome) {
+        if (out) out->sink().write(outcome.output);
+    });
+    if (out) out->sink().flush();
+    return exit_code(totals);
+}
+
+int run_stats(const Options& options) {
+    uint64_t valid = 0;
+    uint64_t min_bytes = UINT64_MAX;
+    uint64_t max_bytes = 0;
+    uint64_t heap_bytes = 0;
+    std::map<std::string, uint64_t> classes;
+    std::map<std::string, uint64_t> simulators;
+    std::map<std::string, uint64_t> findings;
+
+    auto totals = run_pipeline(options, options.inputs, [&](Record& record, Outcome& outcome) {
+        ORSF setup = ORSF::from_json(record.text);
+        json paths = json::array();
+        for (const auto& error : Validator::validate(setup)) {
+            if (error.severity != ValidationSeverity::Error) continue;
+            outcome.finding = true;
+            paths.push_back(error.field);
+        }
+        outcome.summary = {
+            {"class", setup.car.car_class.value_or("")},
+            {"sim", setup.metadata.origin_sim.value_or("")},
+            {"heap", memory_footprint(setup).heap().heap_bytes},
+            {"paths", std::move(paths)},
+        };
+    }, [&](const Record&, Outcome& outcome) {
+        if (!outcome.error.empty()) return;
+        if (!outcome.finding) ++valid;
+        min_bytes = std::min(min_bytes, outcome.bytes);
+        max_bytes = std::max(max_bytes, outcome.bytes);
+        heap_bytes += outcome.summary["heap"].get<uint64_t>();
+        ++classes[outcome.summary["class"].get<std::string>()];
+        ++simulators[outcome.summary["sim"].get<std::string>()];
+        for (const auto& path : outcome.summary["paths"]) ++findings[path.get<std::string>()];
+    });
+
+    uint64_t parsed = totals.records - totals.errors;
+    json report = {
+        {"setups", totals.records},
+        {"valid", valid},
+        {"invalid", totals.findings},
+        {"unreadable", totals.errors},
+        {"bytes", {
+            {"total", totals.bytes},
+            {"min", parsed > 0 ? min_bytes : 0},
+            {"max", max_bytes},
+            {"mean", parsed > 0 ? static_cast<double>(totals.bytes) / static_cast<double>(parsed) : 0.0},
+        }},
+        {"mean_heap_bytes", parsed > 0 ? static_cast<double>(heap_bytes) / static_cast<double>(parsed) : 0.0},
+        {"car_classes", classes},
+        {"origin_sims", simulators},
+        {"error_paths", findings},
+    };
+
+    Output out(options.out);
+    out.sink().write(report.dump(2) + "\n");
+    out.sink().flush();
+
+    // Invalid setups are what stats reports, not a failure of the command
+    return totals.errors > 0 ? EXIT_INPUT : 0;
+}
+
+int run_pack(const Options& options) {
+    if (options.out.empty()) return usage("pack needs --out <file." + std::string(ArchiveWriter::EXTENSION) + "> (or - for stdout)");
+
+    Output out(options.out);
+    ArchiveWriter writer(out.sink());
+    auto totals = run_pipeline(options, options.inputs, [&](Record& record, Outcome& outcome) {
+        // Normalized compact JSON unless --raw; parsing also rejects bad input
+        outcome.output = options.raw ? std::move(record.text) : ORSF::from_json(record.text).to_json_string();
+    }, [&](const Record& record, Outcome& outcome) {
+        if (outcome.error.empty()) writer.add(record.key, outcome.output);
+    });
+    writer.finish();
+    return exit_code(totals);
+}
+
+int run_unpack(const Options& options) {
+    const bool to_directory = output_to_directory(options);
+    std::unique_ptr<Output> out;
+    if (!to_directory) out = std::make_unique<Output>(options.out);
+
+    auto totals = run_pipeline(options, options.inputs, [&](Record& record, Outcome& outcome) {
+        if (to_directory) {
+            // Entry names are relative paths; keep only safe components
+            fs::path target = fs::path(options.out) / fs::path(record.key).lexically_normal().relative_path();
+            if (target.filename().empty() || record.key.find("..") != std::string::npos) {
+                target = fs::path(options.out) / (record.stem + ".json");
+            }
+            fs::create_directories(target.parent_path());
+            write_file(target, record.text);
+        } else {
+            outcome.output = record.text;
+            if (outcome.output.find('\n') != std::string::npos) {
+                outcome.output = json::parse(outcome.output).dump();
+            }
+            outcome.output.push_back('\n');
+        }
+    }, [&](const Record&, Outcome& outcome) {
+        if (out) out->sink().write(outcome.output);
+    });
+    if (out) out->sink().flush();
+    return exit_code(totals);
+}
+
+/// JSON pointer "/setup/aero/front_wing" as "setup.aero.front_wing"
+std::string dotted(const std::string& pointer) {
+    std::string path = pointer.empty() ? pointer : pointer.substr(1);
+    std::replace(path.begin(), path.end(), '/', '.');
+    return path;
+}
+
+int run_diff(const Options& options) {
+    if (options.inputs.size() != 2) return usage("diff needs exactly two inputs");
+
+    // Side A is held in memory by key; side B streams through the pool
+    std::unordered_map<std::string, std::string> left;
+    {
+        InputReader reader({options.inputs[0]});
+        std::vector<Record> chunk;
+        while (reader.next_chunk(chunk, 1024)) {
+            for (auto& record : chunk) {
+                if (!record.path.empty()) record.text = read_file(record.path);
+                left.emplace(record.key, std::move(record.text));
+            }
+        }
+    }
+    // Two single files compare with each other whatever their names
+    bool single = left.size() == 1 && !fs::is_directory(options.inputs[0]) && !fs::is_directory(options.inputs[1]) &&
+                  !is_ndjson(options.inputs[1]) && !is_archive(options.inputs[1]);
+
+    Output out(options.out);
+    std::mutex seen_mutex;
+    std::unordered_map<std::string, bool> seen;
+
+    auto totals = run_pipeline(options, {options.inputs[1]}, [&](Record& record, Outcome& outcome) {
+        const std::string& key = single ? left.begin()->first : record.key;
+        auto match = left.find(key);
+        if (match == left.end()) {
+            outcome.finding = true;
+            outcome.output = record.name + ": only in " + options.inputs[1] + "\n";
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(seen_mutex);
+            seen[key] = true;
+        }
+
+        json a = ORSF::from_json(match->second).to_json().flatten();
+        json b = ORSF::from_json(record.text).to_json().flatten();
+        for (auto it = a.begin(); it != a.end(); ++it) {
+            auto other = b.find(it.key());
+            if (other == b.end()) {
+                outcome.output += record.name + ": " + dotted(it.key()) + ": " + it.value().dump() + " -> (none)\n";
+            } else if (*other != it.value()) {
+                outcome.output += record.name + ": " + dotted(it.key()) + ": " + it.value().dump() + " -> " + other->dump() + "\n";
+            }
+        }
+        for (auto it = b.begin(); it != b.end(); ++it) {
+            if (!a.contains(it.key())) {
+                outcome.output += record.name + ": " + dotted(it.key()) + ": (none) -> " + it.value().dump() + "\n";
+            }
+        }
+        outcome.finding = !outcome.output.empty();
+    }, [&](const Record&, Outcome& outcome) {
+        out.sink().write(outcome.output);
+    });
+
+    uint64_t only_left = 0;
+    std::vector<std::string> missing;
+    for (const auto& entry : left) {
+        if (!seen.count(entry.first)) missing.push_back(entry.first);
+    }
+    std::sort(missing.begin(), missing.end());
+    for (const auto& key : missing) {
+        out.sink().write(key + ": only in " + options.inputs[0] + "\n");
+        ++only_left;
+    }
+    out.sink().flush();
+
+    if (totals.errors > 0) return EXIT_INPUT;
+    return totals.findings + only_left > 0 ? EXIT_FINDINGS : 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) return usage("missing command");
+
+    Options options;
+    options.command = argv[1];
+    if (options.command == "--help" || options.command == "-h" || options.command == "help") {
+        usage("ORSF batch tool");
+        return 0;
+    }
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-" || arg.empty() || arg[0] != '-') {
+            options.inputs.push_back(arg);
+            continue;
+        }
+        if (arg == "--progress") {
+            options.progress = true;
+            continue;
+        }
+        if (arg == "--quiet" || arg == "-q") {
+            options.quiet = true;
+            continue;
+        }
+        if (arg == "--warnings") {
+            options.warnings = true;
+            continue;
+        }
+        if (arg == "--raw") {
+            options.raw = true;
+            continue;
+        }
+        if (arg == "--help" || arg == "-h") {
+            usage("ORSF batch tool");
+            return 0;
+        }
+
+        if (i + 1 >= argc) return usage("missing value for " + arg);
+        std::string value = argv[++i];
+        char* end = nullptr;
+        if (arg == "-j" || arg == "--jobs") {
+            unsigned long long jobs = std::strtoull(value.c_str(), &end, 10);
+            if (end == value.c_str() || *end != '\0' || value[0] == '-') return usage("invalid value for -j: " + value);
+            options.jobs = static_cast<size_t>(jobs);
+        } else if (arg == "--out" || arg == "-o") {
+            options.out = value;
+        } else if (arg == "--format") {
+            if (value != "text" && value != "ndjson") return usage("invalid value for --format: " + value);
+            options.format = value;
+        } else if (arg == "--to") {
+            options.to = value;
+        } else if (arg == "--version") {
+            options.version = value;
+        } else if (arg == "--car") {
+            options.car = value;
+        } else if (arg == "--spec") {
+            options.specs.push_back(value);
+        } else if (arg == "--plugins") {
+            options.plugin_dirs.push_back(value);
+        } else if (arg == "--indent") {
+            long indent = std::strtol(value.c_str(), &end, 10);
+            if (end == value.c_str() || *end != '\0' || indent < -1 || indent > 16) {
+                return usage("invalid value for --indent: " + value);
+            }
+            options.indent = static_cast<int>(indent);
+            options.indent_set = true;
+        } else {
+            return usage("unknown option " + arg);
+        }
+    }
+    if (options.inputs.empty()) return usage("no inputs");
+
+    try {
+        if (options.command == "validate") return run_validate(options);
+        if (options.command == "convert") return run_convert(options);
+        if (options.command == "normalize") return run_normalize(options);
+        if (options.command == "stats") return run_stats(options);
+        if (options.command == "pack") return run_pack(options);
+        if (options.command == "unpack") return run_unpack(options);
+        if (options.command == "diff") return run_diff(options);
+    } catch (const std::exception& e) {
+        std::cerr << "orsf: " << e.what() << std::endl;
+        return EXIT_INPUT;
+    }
+    return usage("unknown command " + options.command);
+}
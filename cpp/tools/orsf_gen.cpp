@@ -0,0 +1,155 @@
+#include "orsf/orsf.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+using namespace orsf;
+
+/// orsf-gen: write a deterministic synthetic setup corpus
+///
+/// Usage: orsf-gen [options]
+///   --count n            Number of setups (default 1000)
+///   --first n            Index of the first setup (default 0)
+///   --seed n             Corpus seed (default 1)
+///   --format f           ndjson (default), json (one array) or files
+///   --out path           Output file, or directory for --format files (default stdout)
+///   --dense-share r      Share of dense setups
+///   --dense-fill r       Field fill rate of dense setups
+///   --sparse-fill r      Field fill rate of sparse setups
+///   --context-rate r     Share of setups with a context section
+///   --strategy-rate r    Share of setups with a strategy custom map
+///   --compat-rate r      Share of setups with compat blobs
+///   --compat-bytes n     Approximate maximum compat blob size
+///   --gears min,max      Gear count range
+///   --error-rate r       Share of setups with injected invalid values
+///   --max-errors n       Maximum injected errors per invalid setup
+
+namespace {
+
+int usage(const std::string& problem) {
+    std::cerr << "orsf-gen: " << problem << "\n"
+              << "Usage: orsf-gen [--count n] [--first n] [--seed n] [--format ndjson|json|files] [--out path]\n"
+              << "                [--dense-share r] [--dense-fill r] [--sparse-fill r] [--context-rate r]\n"
+              << "                [--strategy-rate r] [--compat-rate r] [--compat-bytes n] [--gears min,max]\n"
+              << "                [--error-rate r] [--max-errors n]\n";
+    return 2;
+}
+
+bool parse_rate(const std::string& text, double& rate) {
+    char* end = nullptr;
+    rate = std::strtod(text.c_str(), &end);
+    return end != text.c_str() && *end == '\0' && rate >= 0.0 && rate <= 1.0;
+}
+
+bool parse_count(const std::string& text, uint64_t& count) {
+    char* end = nullptr;
+    count = std::strtoull(text.c_str(), &end, 10);
+    return end != text.c_str() && *end == '\0' && text[0] != '-';
+}
+
+void write_corpus(const SetupGenerator& generator, const std::string& format,
+                  uint64_t first, size_t count, OutputSink& sink) {
+    if (format == "ndjson") {
+        generator.write_ndjson(first, count, sink);
+        return;
+    }
+
+    // JSON array, one setup at a time
+    sink.write(std::string_view("["));
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) sink.write(std::string_view(",\n"));
+        sink.write(generator.generate(first + i).to_json_string());
+    }
+    sink.write(std::string_view("]\n"));
+    sink.flush();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    GeneratorOptions options;
+    uint64_t count = 1000;
+    uint64_t first = 0;
+    std::string format = "ndjson";
+    std::string out;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            usage("synthetic ORSF setup generator");
+            return 0;
+        }
+        if (i + 1 >= argc) return usage("missing value for " + arg);
+        std::string value = argv[++i];
+
+        uint64_t number = 0;
+        bool ok = true;
+        if (arg == "--count") {
+            ok = parse_count(value, count);
+        } else if (arg == "--first") {
+            ok = parse_count(value, first);
+        } else if (arg == "--seed") {
+            ok = parse_count(value, options.seed);
+        } else if (arg == "--format") {
+            format = value;
+            ok = format == "ndjson" || format == "json" || format == "files";
+        } else if (arg == "--out") {
+            out = value;
+        } else if (arg == "--dense-share") {
+            ok = parse_rate(value, options.dense_share);
+        } else if (arg == "--dense-fill") {
+            ok = parse_rate(value, options.dense_fill_rate);
+        } else if (arg == "--sparse-fill") {
+            ok = parse_rate(value, options.sparse_fill_rate);
+        } else if (arg == "--context-rate") {
+            ok = parse_rate(value, options.context_rate);
+        } else if (arg == "--strategy-rate") {
+            ok = parse_rate(value, options.strategy_rate);
+        } else if (arg == "--compat-rate") {
+            ok = parse_rate(value, options.compat_rate);
+        } else if (arg == "--compat-bytes") {
+            ok = parse_count(value, number);
+            options.max_compat_bytes = static_cast<size_t>(number);
+        } else if (arg == "--gears") {
+            size_t comma = value.find(',');
+            uint64_t min = 0;
+            uint64_t max = 0;
+            ok = comma != std::string::npos && parse_count(value.substr(0, comma), min) &&
+                 parse_count(value.substr(comma + 1), max) && min >= 1 && min <= max;
+            options.min_gears = static_cast<size_t>(min);
+            options.max_gears = static_cast<size_t>(max);
+        } else if (arg == "--error-rate") {
+            ok = parse_rate(value, options.error_rate);
+        } else if (arg == "--max-errors") {
+            ok = parse_count(value, number) && number >= 1;
+            options.max_errors = static_cast<size_t>(number);
+        } else {
+            return usage("unknown option " + arg);
+        }
+        if (!ok) return usage("invalid value for " + arg + ": " + value);
+    }
+
+    SetupGenerator generator(options);
+    try {
+        if (format == "files") {
+            if (out.empty()) return usage("--format files needs --out directory");
+            generator.write_files(out, first, static_cast<size_t>(count));
+        } else if (out.empty()) {
+            FdSink sink(1);
+            write_corpus(generator, format, first, static_cast<size_t>(count), sink);
+        } else {
+            std::ofstream file(out, std::ios::binary);
+            if (!file) throw std::runtime_error("Failed to open " + out);
+            CallbackSink sink([&file, &out](const uint8_t* data, size_t size) {
+                if (!file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size))) {
+                    throw std::runtime_error("Failed to write " + out);
+                }
+            });
+            write_corpus(generator, format, first, static_cast<size_t>(count), sink);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "orsf-gen: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}